@@ -0,0 +1,524 @@
+/*\
+ *
+ * LGFXMeter Benchmarks
+ *
+ * Micro benchmarks for the LGFXMeter helpers, results are printed on the serial console
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+#include <M5Unified.h>
+#include <LGFXMeter.h>
+
+
+// keep the compiler from optimizing the benchmarked calls away
+static volatile float sink = 0;
+
+static const uint32_t easingIterations = 10000;
+
+
+void benchEasing()
+{
+  const size_t count = sizeof(easing::functions)/sizeof(easing::easingFuncDesc_t);
+
+  Serial.printf("\n[easing] %d calls per function, LUT size=%d\n", int(easingIterations), int(easing::lut_size) );
+  Serial.printf("%-18s %12s %12s %10s %8s\n", "function", "analytic ns", "lut ns", "max error", "at t" );
+
+  for( size_t i=0; i<count; i++ ) {
+    easing::easingFunc_t analytic = easing::functions[i].func;
+    easing::easingFunc_t lut      = easing::lut_functions[i].func;
+
+    uint32_t start = micros();
+    for( uint32_t n=0; n<easingIterations; n++ ) sink += analytic( float(n)/easingIterations );
+    uint32_t analyticUs = micros() - start;
+
+    start = micros();
+    for( uint32_t n=0; n<easingIterations; n++ ) sink += lut( float(n)/easingIterations );
+    uint32_t lutUs = micros() - start;
+
+    float at  = 0;
+    float err = easing::maxError( analytic, lut, 4096, &at );
+
+    Serial.printf("%-18s %12.1f %12.1f %10.6f %8.3f\n",
+      easing::functions[i].name,
+      analyticUs*1000.0f/easingIterations,
+      lutUs*1000.0f/easingIterations,
+      err,
+      at
+    );
+  }
+}
+
+
+
+
+// channel stress test: a task on the other core pushes a sequence, every value must be received exactly once
+static channel::Value_Channel<int32_t> stressChannel;
+static volatile bool stressDone = false;
+static const uint32_t stressCount = 200000;
+
+
+void stressProducer( void *param )
+{
+  for( int32_t i=1; i<=int32_t(stressCount); i++ ) stressChannel.push( i );
+  stressDone = true;
+  vTaskDelete( nullptr );
+}
+
+
+void benchChannel()
+{
+  Serial.printf("\n[channel] SPSC stress test, %u values pushed from core %d\n", unsigned(stressCount), 1-xPortGetCoreID() );
+
+  channel::value_stats_t<int32_t> frame;
+  uint32_t received = 0, frames = 0, errors = 0;
+  int32_t lastMax = 0;
+
+  stressDone = false;
+  uint32_t start = micros();
+  xTaskCreatePinnedToCore( stressProducer, "stress", 4096, nullptr, 1, nullptr, 1-xPortGetCoreID() );
+
+  while( true ) {
+    bool done = stressDone; // read before take() so the final publish can't be missed
+    while( stressChannel.take( frame ) ) {
+      // values since last frame must be the next contiguous range
+      if( frame.min != lastMax+1 || frame.max != frame.last || frame.max-frame.min+1 != int32_t(frame.count) ) errors++;
+      lastMax   = frame.max;
+      received += frame.count;
+      frames++;
+    }
+    if( done ) break;
+    delay( 1 ); // simulated frame
+  }
+
+  uint32_t elapsed = micros() - start;
+  Serial.printf("%u values in %u frames, last=%d, errors=%u, %.0f pushes/s => %s\n",
+    unsigned(received), unsigned(frames), int(lastMax), unsigned(errors),
+    stressCount*1000000.0f/elapsed,
+    ( received == stressCount && lastMax == int32_t(stressCount) && errors == 0 ) ? "PASS" : "FAIL"
+  );
+}
+
+
+// stereo int16 kernels: the selected kernel must match the scalar reference, then both are timed on a speaker tri-buffer
+static const size_t   dspFrames     = 768; // 1536 samples
+static const uint32_t dspIterations = 2000;
+static int16_t dspBuffer[dspFrames*2];
+
+
+bool dspMatches( const int16_t *in, size_t frames )
+{
+  dsp::stereo_stats_t ref, vec;
+  ref.reset();
+  vec.reset();
+  dsp::stereoStatsScalar( in, frames, &ref );
+  dsp::stereoStats( in, frames, &vec );
+  for( int c=0; c<2; c++ ) {
+    if( ref.peak[c] != vec.peak[c] || ref.sum_squares[c] != vec.sum_squares[c] || ref.sum[c] != vec.sum[c] ) return false;
+  }
+  return ref.frames == vec.frames;
+}
+
+
+void benchDsp()
+{
+  Serial.printf("\n[dsp] stereo stats, %s kernel, %d frames per block\n", dsp::kernelName(), int(dspFrames) );
+
+  // random blocks with full scale extremes, every length to exercise the tails
+  uint32_t errors = 0;
+  for( size_t frames=0; frames<=dspFrames; frames++ ) {
+    for( size_t i=0; i<frames*2; i++ ) {
+      uint32_t r = esp_random();
+      dspBuffer[i] = ( r & 0xf ) == 0 ? -32768 : ( r & 0xf ) == 1 ? 32767 : int16_t( r >> 16 );
+    }
+    if( !dspMatches( dspBuffer, frames ) ) errors++;
+  }
+  for( size_t i=0; i<dspFrames*2; i++ ) dspBuffer[i] = -32768;
+  if( !dspMatches( dspBuffer, dspFrames ) ) errors++;
+  Serial.printf("reference check: %d errors => %s\n", int(errors), errors == 0 ? "PASS" : "FAIL" );
+
+  dsp::stereo_stats_t stats;
+  for( int k=0; k<2; k++ ) {
+    uint32_t start = micros();
+    for( uint32_t n=0; n<dspIterations; n++ ) {
+      stats.reset();
+      if( k == 0 ) dsp::stereoStatsScalar( dspBuffer, dspFrames, &stats );
+      else         dsp::stereoStats( dspBuffer, dspFrames, &stats );
+      sink += stats.sum[0];
+    }
+    uint32_t elapsed = micros() - start;
+    Serial.printf("%-8s %10.2f Msamples/s\n", k == 0 ? "scalar" : dsp::kernelName(), float(dspIterations)*dspFrames*2/elapsed );
+  }
+}
+
+
+
+// real input FFT against the complex FFT previously used by the VUMeter example (kept below as is)
+#define LEGACY_FFT_SIZE 256
+class legacy_fft_t
+{
+  float _wr[LEGACY_FFT_SIZE + 1];
+  float _wi[LEGACY_FFT_SIZE + 1];
+  float _fr[LEGACY_FFT_SIZE + 1];
+  float _fi[LEGACY_FFT_SIZE + 1];
+  uint16_t _br[LEGACY_FFT_SIZE + 1];
+  size_t _ie;
+
+public:
+  legacy_fft_t(void)
+  {
+#ifndef M_PI
+#define M_PI 3.141592653
+#endif
+    _ie = logf( (float)LEGACY_FFT_SIZE ) / log(2.0) + 0.5;
+    static constexpr float omega = 2.0f * M_PI / LEGACY_FFT_SIZE;
+    static constexpr int s4 = LEGACY_FFT_SIZE / 4;
+    static constexpr int s2 = LEGACY_FFT_SIZE / 2;
+    for ( int i = 1 ; i < s4 ; ++i)
+    {
+    float f = cosf(omega * i);
+      _wi[s4 + i] = f;
+      _wi[s4 - i] = f;
+      _wr[     i] = f;
+      _wr[s2 - i] = -f;
+    }
+    _wi[s4] = _wr[0] = 1;
+
+    size_t je = 1;
+    _br[0] = 0;
+    _br[1] = LEGACY_FFT_SIZE / 2;
+    for ( size_t i = 0 ; i < _ie - 1 ; ++i )
+    {
+      _br[ je << 1 ] = _br[ je ] >> 1;
+      je = je << 1;
+      for ( size_t j = 1 ; j < je ; ++j )
+      {
+        _br[je + j] = _br[je] + _br[j];
+      }
+    }
+  }
+
+  void exec(const int16_t* in)
+  {
+    memset(_fi, 0, sizeof(_fi));
+    for ( size_t j = 0 ; j < LEGACY_FFT_SIZE / 2 ; ++j )
+    {
+      float basej = 0.25 * (1.0-_wr[j]);
+      size_t r = LEGACY_FFT_SIZE - j - 1;
+
+      /// perform han window and stereo to mono convert.
+      _fr[_br[j]] = basej * (in[j * 2] + in[j * 2 + 1]);
+      _fr[_br[r]] = basej * (in[r * 2] + in[r * 2 + 1]);
+    }
+
+    size_t s = 1;
+    size_t i = 0;
+    do
+    {
+      size_t ke = s;
+      s <<= 1;
+      size_t je = LEGACY_FFT_SIZE / s;
+      size_t j = 0;
+      do
+      {
+        size_t k = 0;
+        do
+        {
+          size_t l = s * j + k;
+          size_t m = ke * (2 * j + 1) + k;
+          size_t p = je * k;
+          float Wxmr = _fr[m] * _wr[p] + _fi[m] * _wi[p];
+          float Wxmi = _fi[m] * _wr[p] - _fr[m] * _wi[p];
+          _fr[m] = _fr[l] - Wxmr;
+          _fi[m] = _fi[l] - Wxmi;
+          _fr[l] += Wxmr;
+          _fi[l] += Wxmi;
+        } while ( ++k < ke) ;
+      } while ( ++j < je );
+    } while ( ++i < _ie );
+  }
+
+  uint32_t get(size_t index)
+  {
+    return (index < LEGACY_FFT_SIZE / 2) ? (uint32_t)sqrtf(_fr[ index ] * _fr[ index ] + _fi[ index ] * _fi[ index ]) : 0u;
+  }
+};
+
+static const uint32_t fftIterations = 1000;
+static int16_t fftInput[LEGACY_FFT_SIZE*2];
+
+
+void benchFFT()
+{
+  static legacy_fft_t legacy; // ~5KB, keep it off the stack
+  fft::Real_FFT real( LEGACY_FFT_SIZE );
+  if( !real.ready() ) return;
+
+  for( size_t i=0; i<LEGACY_FFT_SIZE*2; i++ ) {
+    fftInput[i] = 8000*sinf( i*0.37f ) + 3000*sinf( i*1.9f ) + int16_t( esp_random() % 2000 ) - 1000;
+  }
+
+  Serial.printf("\n[fft] %d points, %d iterations\n", LEGACY_FFT_SIZE, int(fftIterations) );
+
+  // same window and scaling: bins must match up to the legacy integer truncation
+  legacy.exec( fftInput );
+  real.exec( fftInput );
+  float maxError = 0, maxMagnitude = 0;
+  for( size_t k=0; k<real.bins(); k++ ) {
+    float a = legacy.get( k ), b = real.magnitude( k );
+    if( fabsf( a-b ) > maxError ) maxError = fabsf( a-b );
+    if( a > maxMagnitude ) maxMagnitude = a;
+  }
+  Serial.printf("max bin error: %.3f (max bin %.0f) => %s\n", maxError, maxMagnitude, maxError <= 1.0f + maxMagnitude*1e-5f ? "PASS" : "FAIL" );
+
+  uint32_t start = micros();
+  for( uint32_t n=0; n<fftIterations; n++ ) { legacy.exec( fftInput ); sink += legacy.get( 3 ); }
+  uint32_t legacyUs = micros() - start;
+
+  start = micros();
+  for( uint32_t n=0; n<fftIterations; n++ ) { real.exec( fftInput ); sink += real.power( 3 ); }
+  uint32_t realUs = micros() - start;
+
+  Serial.printf("%-8s %8.1f us/exec\n", "complex", float(legacyUs)/fftIterations );
+  Serial.printf("%-8s %8.1f us/exec (x%.2f)\n", "real", float(realUs)/fftIterations, float(legacyUs)/realUs );
+}
+
+
+
+// fixed point FFT: SNR against the float transform at several input levels, and throughput in bins/s
+void benchFFTFixed()
+{
+  fft::Real_FFT     real( LEGACY_FFT_SIZE );
+  fft::Real_FFT_Q15 fixed( LEGACY_FFT_SIZE );
+  if( !real.ready() || !fixed.ready() ) return;
+
+  Serial.printf("\n[fft q15] %d points\n", LEGACY_FFT_SIZE );
+  Serial.printf("%8s %8s %6s\n", "level", "SNR dB", "exp" );
+
+  const float levels[] = { 32767.0f, 3276.0f, 327.0f, 32.0f };
+  for( size_t l=0; l<sizeof(levels)/sizeof(float); l++ ) {
+    for( size_t i=0; i<LEGACY_FFT_SIZE*2; i++ ) {
+      fftInput[i] = levels[l] * ( 0.7f*sinf( i*0.37f ) + 0.3f*sinf( i*1.9f + ( i&1 ) ) );
+    }
+    real.exec( fftInput );
+    fixed.exec( fftInput );
+    double signal = 0, noise = 0;
+    for( size_t k=0; k<real.bins(); k++ ) {
+      double a = real.magnitude( k ), b = fixed.magnitude( k );
+      signal += a*a;
+      noise  += (a-b)*(a-b);
+    }
+    Serial.printf("%8.0f %8.1f %6d\n", levels[l], noise > 0 ? 10*log10( signal/noise ) : 99.0, fixed.exponent() );
+  }
+
+  uint32_t start = micros();
+  for( uint32_t n=0; n<fftIterations; n++ ) { real.exec( fftInput ); sink += real.power( 3 ); }
+  uint32_t floatUs = micros() - start;
+
+  start = micros();
+  for( uint32_t n=0; n<fftIterations; n++ ) { fixed.exec( fftInput ); sink += fixed.powerQ( 3 ); }
+  uint32_t fixedUs = micros() - start;
+
+  float bins = float( fftIterations ) * real.bins() * 1000000.0f;
+  Serial.printf("%-8s %12.0f bins/s\n", "float", bins/floatUs );
+  Serial.printf("%-8s %12.0f bins/s\n", "q15", bins/fixedUs );
+}
+
+
+
+// packed images: an 8bpp and a 4bpp asset are copied into sprites of the same depth, the indexes and
+// palette colors read back must match the asset (13px wide rows are not byte aligned at 4bpp)
+bool packedMatches( uint8_t bpp )
+{
+  const int32_t w = 13, h = 5;
+  const uint16_t colors = 1 << bpp;
+  const uint32_t stride = ( w*bpp + 7 ) / 8;
+  uint32_t len = utils::PACKED_HEADER_SIZE + colors*4 + stride*h;
+  uint8_t *data = (uint8_t*)calloc( 1, len );
+  if( !data ) return false;
+
+  memcpy( data, "LGPK", 4 );
+  data[4] = utils::PACKED_VERSION;
+  data[5] = bpp;
+  data[6] = colors & 0xff; data[7] = colors >> 8;
+  data[8] = w;             data[10] = h;
+  uint8_t *palette = data + utils::PACKED_HEADER_SIZE;
+  for( uint16_t i=0; i<colors; i++ ) {
+    palette[i*4] = i*37; palette[i*4+1] = 255-i*11; palette[i*4+2] = i*73;
+  }
+  uint8_t *pixels = palette + colors*4;
+  for( int32_t y=0; y<h; y++ ) {
+    for( int32_t x=0; x<w; x++ ) {
+      uint8_t index = ( x*3 + y*5 ) % colors;
+      int32_t bit = x*bpp;
+      pixels[y*stride + bit/8] |= index << ( 8 - bpp - bit%8 );
+    }
+  }
+
+  const image_t img = { bpp, data, len, IMAGE_PACKED, w, h };
+  ICS_Sprite sprite( &M5.Display );
+  sprite.setColorDepth( bpp );
+  bool ok = sprite.createSprite( w, h ) && utils::loadPacked( &sprite, &img );
+  for( int32_t y=0; ok && y<h; y++ ) {
+    for( int32_t x=0; ok && x<w; x++ ) {
+      uint8_t index = ( x*3 + y*5 ) % colors;
+      const uint8_t *c = palette + index*4;
+      ok = sprite.readPixelValue( x, y ) == index && sprite.readPixel( x, y ) == sprite.color565( c[0], c[1], c[2] );
+    }
+  }
+  sprite.deleteSprite();
+  free( data );
+  return ok;
+}
+
+
+void checkPacked()
+{
+  Serial.printf("\n[packed] sprite load without conversion\n");
+  for( uint8_t bpp : { 8, 4 } ) {
+    Serial.printf("%dbpp => %s\n", bpp, packedMatches( bpp ) ? "PASS" : "FAIL" );
+  }
+}
+
+
+
+// needle frame rate for each push mode, the same sweep is drawn every time
+static const uint32_t pipelineFrames = 500;
+
+
+void benchPipeline()
+{
+  gauge_cfg_t cfg = gauge::cfg;
+  cfg.display     = &M5.Display;
+  Gauge_Class *gauge = new Gauge_Class( cfg );
+  if( !gauge ) return;
+
+  const pipeline::push_mode_t modes[] = { pipeline::PUSH_SYNC, pipeline::PUSH_TASK, pipeline::PUSH_DMA };
+  const char *names[]                 = { "sync", "task", "dma" };
+
+  Serial.printf("\n[pipeline] %d needle frames per push mode\n", int(pipelineFrames) );
+
+  for( size_t m=0; m<3; m++ ) {
+    gauge->setPushMode( modes[m] );
+    gauge->pushGauge();
+    float range = cfg.gauge.end - cfg.gauge.start;
+    uint32_t start = micros();
+    for( uint32_t n=0; n<pipelineFrames; n++ ) {
+      float t = float(n%100)/100.0f;
+      gauge->drawNeedle( cfg.gauge.start + range*( n%200 < 100 ? t : 1.0f-t ) );
+    }
+    gauge->waitIdle();
+    uint32_t elapsed = micros() - start;
+    Serial.printf("%-6s %8.1f us/frame %8.2f fps\n", names[m], float(elapsed)/pipelineFrames, pipelineFrames*1000000.0f/elapsed );
+  }
+
+  delete gauge;
+}
+
+
+
+// record/replay round trip with the spring motion: replaying a capture must feed the same calls and
+// read the same clock values, so recording the replay gives back the capture; the fake clock moves
+// 4ms per read so the capture does not depend on the render speed
+static uint32_t replayTestNow = 0;
+static uint32_t replayTestClock() { return replayTestNow += 4; }
+
+
+static void resetNeedle( Gauge_Class *gauge, float angle )
+{
+  timing::recorder = nullptr;
+  gauge->setNeedleEasing();
+  gauge->setNeedle( angle );
+  gauge->animateNeedle( angle );
+}
+
+
+bool replayMatches()
+{
+  gauge_cfg_t cfg = gauge::cfg;
+  cfg.display     = &M5.Display;
+  Gauge_Class *gauge = new Gauge_Class( cfg );
+  timing::Input_Recorder capture( 2048 ), again( 2048 );
+
+  gauge->setClock( replayTestClock );
+  resetNeedle( gauge, cfg.gauge.start );
+  timing::recorder = &capture;
+  capture.begin();
+  gauge->setNeedleSpring( 300 );
+  for( uint32_t n=0; n<20; n++ ) {
+    gauge->animateNeedle( cfg.gauge.start + ( n%10 < 5 ? n%10 : 10-n%10 )*4.0f );
+  }
+  gauge->setNeedleEasing();
+  gauge->setNeedle( cfg.gauge.start );
+  gauge->easeNeedle( 300 );
+  capture.end();
+
+  resetNeedle( gauge, cfg.gauge.start ); // a capture replays from the state it was recorded in
+  timing::recorder = &again;
+  again.begin();
+  bool ok = timing::replay( gauge, capture.getEvents(), capture.getCount() );
+  again.end();
+  timing::recorder = nullptr;
+
+  ok = ok && !capture.overflowed() && again.getCount() == capture.getCount();
+  for( size_t i=0; ok && i<capture.getCount(); i++ ) {
+    const timing::input_event_t *a = &capture.getEvents()[i], *b = &again.getEvents()[i];
+    ok = a->type == b->type && a->flags == b->flags && a->value == b->value && a->angle == b->angle;
+  }
+  delete gauge;
+  return ok;
+}
+
+
+void checkReplay()
+{
+  Serial.printf("\n[replay] spring session round trip => %s\n", replayMatches() ? "PASS" : "FAIL" );
+}
+
+
+
+void setup()
+{
+  M5.begin();
+  Serial.begin( 115200 );
+  delay( 1000 );
+
+  benchEasing();
+  benchChannel();
+  benchDsp();
+  benchFFT();
+  benchFFTFixed();
+  checkPacked();
+  benchPipeline();
+  checkReplay();
+}
+
+
+
+void loop()
+{
+  delay( 1000 );
+}
+
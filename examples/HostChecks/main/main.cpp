@@ -0,0 +1,403 @@
+/*\
+ *
+ * LGFXMeter Host Checks
+ *
+ * Pass/fail checks of the LGFXMeter helpers that can run on a PC
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("LGFXMeter"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+// Host checks, built natively against LovyanGFX, a LGFX_Sprite stands in for the panel:
+//
+//   - pipeline: every frame submitted to the push pipeline reaches the panel, in order (sync, push thread, DMA)
+//   - channel:  every value pushed by a producer thread is taken once and in order, min/max/count included
+//   - levels:   the level snapshots of every audio block reach the renderer, no block or peak lost
+//   - dsp:      the SSE2/NEON kernels give the same results as the scalar ones
+//   - easing:   the easing functions are finite, the generated tables match them
+//   - planner:  planner::fit() keeps every buffer in DRAM when the budget has no PSRAM
+//
+// Run them from this folder:
+//
+//   pio run -e native -t exec
+//
+// Every check prints PASS/FAIL, the exit code is the number of failures.
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if !defined ARDUINO
+  // the few Arduino symbols used by the library
+  using std::min;
+  using std::max;
+  #ifndef PI
+    #define PI 3.1415926535897932384626433832795
+  #endif
+  #define log_e(format, ...) fprintf( stderr, "[E] " format "\n", ##__VA_ARGS__ )
+  #define log_w(format, ...) fprintf( stderr, "[W] " format "\n", ##__VA_ARGS__ )
+  #define log_i(format, ...)
+  #define log_d(format, ...)
+  #define log_v(format, ...)
+  static const auto hostStart = std::chrono::steady_clock::now();
+  static uint32_t micros() { return std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - hostStart ).count(); }
+  static uint32_t millis() { return micros()/1000; }
+  static bool hostPsram = false; // checks can pretend to run on a board with psram
+  static bool psramInit() { return hostPsram; }
+  struct host_esp_t
+  {
+    uint32_t getFreeHeap()      { return 0; }
+    uint32_t getMinFreeHeap()   { return 0; }
+    uint32_t getMaxAllocHeap()  { return 0; }
+    uint32_t getFreePsram()     { return hostPsram ? 4*1024*1024 : 0; }
+    uint32_t getMinFreePsram()  { return getFreePsram(); }
+    uint32_t getMaxAllocPsram() { return getFreePsram(); }
+  } ESP;
+  struct Print
+  {
+    size_t printf( const char *format, ... ) { va_list args; va_start( args, format ); int n = vprintf( format, args ); va_end( args ); return n; }
+  };
+#endif
+
+#include <LGFXMeter.h>
+
+using namespace LGFXMeter;
+
+
+static int failures = 0;
+
+
+static void report( const char *name, bool ok )
+{
+  printf( "%-48s %s\n", name, ok ? "PASS" : "FAIL" );
+  if( !ok ) failures++;
+}
+
+
+// frames composited on the main thread are pushed by the pipeline into a panel stand-in, the panel must
+// end up identical to the same frames drawn directly, every frame must be reported once and in order
+static std::atomic<uint32_t> pipelineDone;
+static std::atomic<uint32_t> pipelineOrder;
+
+
+static void pipelineFrameDone( clipRect_t rect, void *ctx )
+{
+  uint32_t n = pipelineDone++;
+  if( uint32_t( rect.x ) != n%100 ) pipelineOrder++; // frame n was submitted at x = n%100
+}
+
+
+bool pipelineMatches( pipeline::push_mode_t mode )
+{
+  const int32_t  panel_w = 160, panel_h = 120, max_w = 40, max_h = 30;
+  const uint32_t frames  = 2000;
+
+  LGFX_Sprite panel, reference;
+  panel.setColorDepth( 16 );
+  reference.setColorDepth( 16 );
+  if( !panel.createSprite( panel_w, panel_h ) || !reference.createSprite( panel_w, panel_h ) ) return false;
+  panel.fillSprite( 0 );
+  reference.fillSprite( 0 );
+
+  pipelineDone  = 0;
+  pipelineOrder = 0;
+  bool ok = true;
+
+  pipeline::Push_Pipeline *pusher = new pipeline::Push_Pipeline( &panel, 16, mode, 0, max_w, max_h );
+  pusher->onFrameDone( pipelineFrameDone );
+  ok = ok && pusher->ready() && pusher->getMode() == mode;
+  ok = ok && pusher->acquire( max_w+1, max_h ) == nullptr; // larger than reserved
+
+  for( uint32_t n=0; n<frames && ok; n++ ) {
+    int32_t  w = 1 + n%max_w, h = 1 + (n*7)%max_h;
+    uint16_t color = 1 + n%0xfffe;
+    clipRect_t rect = { int32_t( n%100 ), int32_t( (n*3)%( panel_h-h ) ), w, h };
+    ICS_Sprite *frame = pusher->acquire( w, h );
+    if( !frame || frame->width() != w || frame->height() != h ) { ok = false; break; }
+    frame->fillSprite( color );
+    pusher->submit( rect );
+    reference.fillRect( rect.x, rect.y, w, h, color );
+  }
+  pusher->waitIdle();
+  ok = ok && pipelineDone == frames && pipelineOrder == 0;
+  delete pusher; // stops the push thread
+
+  for( int32_t y=0; y<panel_h && ok; y++ ) {
+    for( int32_t x=0; x<panel_w && ok; x++ ) {
+      ok = panel.readPixel( x, y ) == reference.readPixel( x, y );
+    }
+  }
+  return ok;
+}
+
+
+void checkPipeline()
+{
+  report( "pipeline: sync push", pipelineMatches( pipeline::PUSH_SYNC ) );
+  report( "pipeline: push thread", pipelineMatches( pipeline::PUSH_TASK ) );
+  report( "pipeline: dma push", pipelineMatches( pipeline::PUSH_DMA ) );
+}
+
+
+// SPSC channel: a thread pushes a sequence while the consumer takes at random intervals,
+// every value must be received exactly once and in order
+bool channelMatches( uint32_t count, uint32_t consumer_sleep_us )
+{
+  channel::Value_Channel<int32_t> values;
+  std::atomic<bool> done { false };
+  std::thread producer( [&]() {
+    for( int32_t i=1; i<=int32_t(count); i++ ) values.push( i );
+    done = true;
+  } );
+
+  channel::value_stats_t<int32_t> frame;
+  uint32_t received = 0, errors = 0, frames = 0;
+  int32_t lastMax = 0;
+  while( true ) {
+    bool finished = done; // read before take() so the final publish can't be missed
+    while( values.take( frame ) ) {
+      if( frame.min != lastMax+1 || frame.max != frame.last || frame.max-frame.min+1 != int32_t(frame.count) ) errors++;
+      lastMax   = frame.max;
+      received += frame.count;
+      frames++;
+    }
+    if( finished ) break;
+    if( consumer_sleep_us ) std::this_thread::sleep_for( std::chrono::microseconds( ( frames * 7919 ) % consumer_sleep_us ) );
+  }
+  producer.join();
+  return received == count && lastMax == int32_t(count) && errors == 0;
+}
+
+
+void checkChannel()
+{
+  report( "channel: busy consumer", channelMatches( 2000000, 0 ) );
+  report( "channel: slow consumer", channelMatches( 2000000, 200 ) );
+}
+
+
+// levels snapshots go through the same channel: every block is counted once and no peak is lost,
+// the block peaks are placed so the loudest one lands at a random point of the sequence
+bool levelsMatch( uint32_t blocks, uint32_t consumer_sleep_us )
+{
+  const size_t frames = 64;
+  levels::Level_Meter meter( levels::default_cfg );
+  std::atomic<bool> done { false };
+  std::thread producer( [&]() {
+    int16_t block[frames*2];
+    for( uint32_t b=0; b<blocks; b++ ) {
+      memset( block, 0, sizeof(block) );
+      block[( b%frames )*2]     = int16_t( ( b*7919 ) % 32768 );
+      block[( b%frames )*2 + 1] = int16_t( -int32_t( ( b*104729 ) % 32768 ) );
+      meter.process( block, frames );
+    }
+    done = true;
+  } );
+
+  levels::level_t frame = levels::level_t();
+  uint64_t samples = 0;
+  float peaks[2] = { 0, 0 };
+  uint32_t frames_taken = 0;
+  while( true ) {
+    bool finished = done;
+    while( meter.take( frame ) ) {
+      samples += frame.samples;
+      for( int c=0; c<2; c++ ) if( frame.peak[c] > peaks[c] ) peaks[c] = frame.peak[c];
+      frames_taken++;
+    }
+    if( finished ) break;
+    if( consumer_sleep_us ) std::this_thread::sleep_for( std::chrono::microseconds( ( frames_taken * 7919 ) % consumer_sleep_us ) );
+  }
+  producer.join();
+
+  float expected[2] = { 0, 0 };
+  for( uint32_t b=0; b<blocks; b++ ) {
+    expected[0] = max( expected[0], float( ( b*7919 ) % 32768 )/32768.0f );
+    expected[1] = max( expected[1], float( ( b*104729 ) % 32768 )/32768.0f );
+  }
+  return samples == uint64_t( blocks )*frames && peaks[0] == expected[0] && peaks[1] == expected[1] && frame.channels == 2;
+}
+
+
+void checkLevels()
+{
+  report( "levels: busy consumer", levelsMatch( 200000, 0 ) );
+  report( "levels: slow consumer", levelsMatch( 200000, 200 ) );
+}
+
+
+// the vector kernel must give the exact scalar results, tail and 32 bits lane flushes included
+static bool statsEqual( const dsp::stereo_stats_t &a, const dsp::stereo_stats_t &b )
+{
+  for( int c=0; c<2; c++ ) {
+    if( a.peak[c] != b.peak[c] || a.sum_squares[c] != b.sum_squares[c] || a.sum[c] != b.sum[c] ) return false;
+  }
+  return a.frames == b.frames;
+}
+
+
+bool dspMatches( void (*kernel)( const int16_t*, size_t, dsp::stereo_stats_t* ), bool extremes )
+{
+  const size_t max_frames = 16384*4*2 + 7; // crosses two lane flushes, odd tail
+  int16_t *buffer = (int16_t*)malloc( max_frames * 2 * sizeof(int16_t) );
+  if( !buffer ) return false;
+
+  uint32_t seed = 0x12345678;
+  for( size_t i=0; i<max_frames*2; i++ ) {
+    seed = seed * 1664525 + 1013904223;
+    buffer[i] = extremes ? ( seed & 0x10000 ? -32768 : ( seed & 0x20000 ? 32767 : int16_t(seed >> 16) ) ) : int16_t(seed >> 16);
+  }
+  if( extremes ) {
+    for( size_t i=0; i<256; i++ ) buffer[i] = -32768; // full scale block on both channels
+  }
+
+  bool ok = true;
+  size_t lengths[] = { 1, 2, 3, 5, 7, 9, 15, 17, 33, 767, 769, 16384*4 - 1, 16384*4 + 3, max_frames };
+  for( size_t frames : lengths ) {
+    dsp::stereo_stats_t ref, vec;
+    ref.reset();
+    vec.reset();
+    dsp::stereoStatsScalar( buffer, frames, &ref );
+    kernel( buffer, frames, &vec );
+    ok = ok && statsEqual( ref, vec );
+    // accumulating over two calls, starting on an odd frame
+    vec.reset();
+    kernel( buffer, 1, &vec );
+    kernel( buffer + 2, frames - 1, &vec );
+    ok = ok && statsEqual( ref, vec );
+  }
+  for( size_t frames=0; frames<64; frames++ ) {
+    dsp::stereo_stats_t ref, vec;
+    ref.reset();
+    vec.reset();
+    dsp::stereoStatsScalar( buffer, frames, &ref );
+    kernel( buffer, frames, &vec );
+    ok = ok && statsEqual( ref, vec );
+  }
+
+  free( buffer );
+  return ok;
+}
+
+
+void checkDsp()
+{
+  #if defined LGFXMETER_DSP_SSE2
+    report( "dsp: sse2 vs scalar", dspMatches( dsp::stereoStatsSSE2, false ) );
+    report( "dsp: sse2 vs scalar, -32768 and full scale", dspMatches( dsp::stereoStatsSSE2, true ) );
+  #elif defined LGFXMETER_DSP_NEON
+    report( "dsp: neon vs scalar", dspMatches( dsp::stereoStatsNEON, false ) );
+    report( "dsp: neon vs scalar, -32768 and full scale", dspMatches( dsp::stereoStatsNEON, true ) );
+  #else
+    printf( "dsp: no vector kernel on this target, skipped\n" );
+  #endif
+  report( "dsp: stereoStats vs scalar", dspMatches( dsp::stereoStats, true ) );
+}
+
+
+
+// every easing function must stay finite over [0...1] (the needle renders its angle), and the
+// generated tables must match the analytic functions on their sample points
+void checkEasing()
+{
+  const size_t count = sizeof(easing::functions)/sizeof(easing::easingFuncDesc_t);
+  bool finite = true, matches = true;
+  for( size_t i=0; i<count; i++ ) {
+    for( size_t n=0; n<=4096; n++ ) {
+      float t = float(n)/4096.0f;
+      float y = easing::functions[i].func( t );
+      if( !std::isfinite( y ) ) {
+        printf( "  %s( %g ) = %g\n", easing::functions[i].name, t, y );
+        finite = false;
+        break;
+      }
+    }
+    for( size_t n=0; n<=easing::lut_size; n++ ) {
+      float t   = float(n)/float(easing::lut_size);
+      float err = fabsf( easing::functions[i].func( t ) - easing::lut_functions[i].func( t ) );
+      if( !( err <= 1e-4f ) || strcmp( easing::functions[i].name, easing::lut_functions[i].name ) != 0 ) {
+        printf( "  %s: table off by %g at t=%g\n", easing::functions[i].name, err, t );
+        matches = false;
+        break;
+      }
+    }
+  }
+  report( "easing: analytic functions finite over [0...1]", finite );
+  report( "easing: generated tables vs analytic", matches );
+}
+
+
+
+static bool plannedInDram( const planner::budget_plan_t &result )
+{
+  if( !result.feasible || result.psram_bytes != 0 ) return false;
+  for( size_t i=0; i<result.report.allocs_count; i++ ) {
+    if( result.report.allocs[i].psram ) return false;
+  }
+  return true;
+}
+
+
+// a dram only budget must be met on a board with psram too: nothing may be planned in psram
+void checkPlanner()
+{
+  static const ruler_t      ruler   = { 0.0f, 90.0f, 120, 6, nullptr, 0 };
+  static const ruler_item_t items[] = { { &ruler, 1 } };
+
+  gauge_cfg_t cfg   = gauge::cfg;
+  cfg.gauge.items       = items;
+  cfg.gauge.items_count = 1;
+  cfg.bit_depth         = 16;
+
+  hostPsram = true;
+  planner::budget_plan_t dram_only = planner::fit( cfg, { 256*1024, 0 } );
+  planner::budget_plan_t dma_only  = planner::fit( cfg, { 512*1024, 0 }, pipeline::PUSH_DMA );
+  planner::budget_plan_t both      = planner::fit( cfg, { 256*1024, 4*1024*1024 } );
+  hostPsram = false;
+
+  report( "planner: dram only budget on a psram board", plannedInDram( dram_only ) && dram_only.dram_bytes <= 256*1024 );
+  report( "planner: dram only budget, dma frames", plannedInDram( dma_only ) && dma_only.dram_bytes <= 512*1024 );
+  report( "planner: psram budget", both.feasible && both.dram_bytes <= 256*1024 );
+}
+
+
+
+int main()
+{
+  checkPipeline();
+  checkChannel();
+  checkLevels();
+  checkDsp();
+  checkEasing();
+  checkPlanner();
+  printf( "%d failure(s)\n", failures );
+  return failures;
+}
@@ -85,6 +85,15 @@ void setup()
   //
   // cfg.zoomAA = psramInit() ? 0.5 : 1.0;
   //cfg.zoomAA = 1.0;
+  //
+  // The memory plan can be checked without allocating anything:
+  //
+  // auto gaugePlan = LGFXMeter::plan( cfg );
+  // memory::printReport( &gaugePlan );
+  //
+  // Or let the planner pick zoomAA and bit depths for the available ram:
+  //
+  // cfg = planner::fit( cfg, planner::available() ).cfg;
 
   // Optionally use pre-rendered arrow and custom shadow
   // - Image can be any size (scale will constrained) but smaller is faster, transparent png works
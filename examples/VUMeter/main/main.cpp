@@ -55,6 +55,9 @@ const image_t vuMeterShadow = { 16, clock_arrow_shadow_png, clock_arrow_shadow_p
 
 Gauge_Class  *VUMeterGauge    = nullptr;
 
+// audio levels, fed by the audio output at audio rate, read once per frame
+static levels::Level_Meter levelMeter;
+
 /// set M5Speaker virtual channel (0-7)
 static constexpr uint8_t m5spk_virtual_channel = 0;
 
@@ -97,6 +100,8 @@ class AudioOutputM5Speaker : public AudioOutput
       if (_tri_buffer_index)
       {
         _m5sound->playRaw(_tri_buffer[_tri_index], _tri_buffer_index, hertz, true, 1, _virtual_ch);
+        levelMeter.setSampleRate(hertz);
+        levelMeter.process(_tri_buffer[_tri_index], _tri_buffer_index / 2);
         _tri_index = _tri_index < 2 ? _tri_index + 1 : 0;
         _tri_buffer_index = 0;
       }
@@ -109,6 +114,7 @@ class AudioOutputM5Speaker : public AudioOutput
     }
 
     const int16_t* getBuffer(void) const { return _tri_buffer[(_tri_index + 2) % 3]; }
+    uint32_t getRate(void) const { return hertz; }
 
   protected:
     m5::Speaker_Class* _m5sound;
@@ -121,108 +127,17 @@ class AudioOutputM5Speaker : public AudioOutput
 
 
 #define FFT_SIZE 256
-class fft_t
-{
-  float _wr[FFT_SIZE + 1];
-  float _wi[FFT_SIZE + 1];
-  float _fr[FFT_SIZE + 1];
-  float _fi[FFT_SIZE + 1];
-  uint16_t _br[FFT_SIZE + 1];
-  size_t _ie;
-
-public:
-  fft_t(void)
-  {
-#ifndef M_PI
-#define M_PI 3.141592653
-#endif
-    _ie = logf( (float)FFT_SIZE ) / log(2.0) + 0.5;
-    static constexpr float omega = 2.0f * M_PI / FFT_SIZE;
-    static constexpr int s4 = FFT_SIZE / 4;
-    static constexpr int s2 = FFT_SIZE / 2;
-    for ( int i = 1 ; i < s4 ; ++i)
-    {
-    float f = cosf(omega * i);
-      _wi[s4 + i] = f;
-      _wi[s4 - i] = f;
-      _wr[     i] = f;
-      _wr[s2 - i] = -f;
-    }
-    _wi[s4] = _wr[0] = 1;
-
-    size_t je = 1;
-    _br[0] = 0;
-    _br[1] = FFT_SIZE / 2;
-    for ( size_t i = 0 ; i < _ie - 1 ; ++i )
-    {
-      _br[ je << 1 ] = _br[ je ] >> 1;
-      je = je << 1;
-      for ( size_t j = 1 ; j < je ; ++j )
-      {
-        _br[je + j] = _br[je] + _br[j];
-      }
-    }
-  }
-
-  void exec(const int16_t* in)
-  {
-    memset(_fi, 0, sizeof(_fi));
-    for ( size_t j = 0 ; j < FFT_SIZE / 2 ; ++j )
-    {
-      float basej = 0.25 * (1.0-_wr[j]);
-      size_t r = FFT_SIZE - j - 1;
 
-      /// perform han window and stereo to mono convert.
-      _fr[_br[j]] = basej * (in[j * 2] + in[j * 2 + 1]);
-      _fr[_br[r]] = basej * (in[r * 2] + in[r * 2 + 1]);
-    }
-
-    size_t s = 1;
-    size_t i = 0;
-    do
-    {
-      size_t ke = s;
-      s <<= 1;
-      size_t je = FFT_SIZE / s;
-      size_t j = 0;
-      do
-      {
-        size_t k = 0;
-        do
-        {
-          size_t l = s * j + k;
-          size_t m = ke * (2 * j + 1) + k;
-          size_t p = je * k;
-          float Wxmr = _fr[m] * _wr[p] + _fi[m] * _wi[p];
-          float Wxmi = _fi[m] * _wr[p] - _fr[m] * _wi[p];
-          _fr[m] = _fr[l] - Wxmr;
-          _fi[m] = _fi[l] - Wxmi;
-          _fr[l] += Wxmr;
-          _fi[l] += Wxmi;
-        } while ( ++k < ke) ;
-      } while ( ++j < je );
-    } while ( ++i < _ie );
-  }
-
-  uint32_t get(size_t index)
-  {
-    return (index < FFT_SIZE / 2) ? (uint32_t)sqrtf(_fr[ index ] * _fr[ index ] + _fi[ index ] * _fi[ index ]) : 0u;
-  }
-};
-
-static constexpr size_t WAVE_SIZE = 320;
 static AudioFileSourceSD file;
 static AudioOutputM5Speaker out(&M5.Speaker, m5spk_virtual_channel);
 static AudioGeneratorMP3 mp3;
 static AudioFileSourceID3* id3 = nullptr;
-static fft_t fft;
+static fft::Spectrum_FFT fft_engine(FFT_SIZE); // real input FFT, FFT_SIZE stereo frames per exec(), Q15 when LGFXMETER_FFT_FIXED is defined
 static bool fft_enabled = false;
 static bool wave_enabled = false;
-static uint16_t prev_y[(FFT_SIZE / 2)+1];
-static uint16_t peak_y[(FFT_SIZE / 2)+1];
-static int16_t wave_y[WAVE_SIZE];
-static int16_t wave_h[WAVE_SIZE];
-static int16_t raw_data[WAVE_SIZE * 2];
+static Spectrum_Class *spectrumBars = nullptr;
+static Waveform_Class *scope = nullptr;
+static ICS_Sprite *bottomBg = nullptr; // gradient under the bars and the scope
 static int header_height = 0;
 static size_t fileindex = 0;
 
@@ -265,6 +180,22 @@ void play(const char* fname)
   mp3.begin(id3, &out);
 }
 
+// VU scale ticks (see VUMeter.hpp), 0 VU is aligned to -18 dBFS
+static const float vu_db[]    = { -20.0f, -10.0f, -7.0f, -5.0f, -3.0f, -2.0f, -1.0f,  0.0f,  1.0f,  2.0f,  3.0f };
+static const float vu_angle[] = {   2.0f,  13.0f, 22.0f, 30.0f, 41.0f, 47.0f, 54.0f, 61.0f, 70.0f, 80.0f, 90.0f };
+static constexpr float vu_reference_dbfs = -18.0f;
+
+float vuToAngle(float level)
+{
+  float db = levels::toDb(level) - vu_reference_dbfs;
+  const size_t last = sizeof(vu_db) / sizeof(vu_db[0]) - 1;
+  if (db <= vu_db[0]) { return 0.0f; }
+  if (db >= vu_db[last]) { return vu_angle[last]; }
+  size_t i = 1;
+  while (db > vu_db[i]) { ++i; }
+  return utils::mapFloat(db, vu_db[i-1], vu_db[i], vu_angle[i-1], vu_angle[i]);
+}
+
 uint32_t bgcolor(LGFX_Device* gfx, int y)
 {
   auto h = gfx->height();
@@ -307,6 +238,8 @@ void gfxSetup(LGFX_Device* gfx)
     cfg.needle.axis = { GaugeWidth/2, GaugePosY+GaugeHeight };
     cfg.bgImage    = &bgImg;
     VUMeterGauge = new Gauge_Class( cfg );
+    // VU ballistics: levels arrive on every loop, the spring follows them without restarting
+    VUMeterGauge->setNeedleSpring( 300 );
   }
 
   gfx->setFont(&fonts::lgfxJapanGothic_12);
@@ -327,15 +260,47 @@ void gfxSetup(LGFX_Device* gfx)
     }
   }
 
-  for (int x = 0; x < (FFT_SIZE/2)+1; ++x)
-  {
-    prev_y[x] = INT16_MAX;
-    peak_y[x] = INT16_MAX;
-  }
-  for (int x = 0; x < WAVE_SIZE; ++x)
+  if (fft_enabled)
   {
-    wave_y[x] = gfx->height();
-    wave_h[x] = 0;
+    // spectrum bars and scope below the gauge, both restored from a copy of the gradient
+    clipRect_t area = { 0, GaugePosY + GaugeHeight, gfx->width(), gfx->height() - ( GaugePosY + GaugeHeight ) };
+    bottomBg = new ICS_Sprite(gfx);
+    bottomBg->setColorDepth(16);
+    if (memory::createSprite(bottomBg, area.w, area.h, memory::HEAT_WARM))
+    {
+      for (int y = 0; y < area.h; ++y)
+      {
+        bottomBg->drawFastHLine(0, y, area.w, bgcolor(gfx, area.y + y));
+      }
+    }
+    else
+    {
+      delete bottomBg;
+      bottomBg = nullptr;
+    }
+
+    auto scfg = spectrum::config();
+    scfg.display   = gfx;
+    scfg.clipRect  = area;
+    scfg.bgSprite  = bottomBg;
+    scfg.bgPos     = { area.x, area.y };
+    scfg.bg_color  = bgcolor(gfx, area.y);
+    scfg.bands     = 32;
+
+    if (wave_enabled)
+    { // left half: spectrum, right half: scope
+      scfg.clipRect.w = area.w / 2 - 4;
+      scfg.bands      = 20;
+      auto wcfg = waveform::config();
+      wcfg.display  = gfx;
+      wcfg.clipRect = { area.x + area.w / 2, area.y, area.w / 2, area.h };
+      wcfg.bgSprite = bottomBg;
+      wcfg.bgPos    = { area.x, area.y };
+      wcfg.bg_color = scfg.bg_color;
+      scope = new Waveform_Class(wcfg);
+    }
+
+    spectrumBars = new Spectrum_Class(scfg);
   }
 
   VUMeterGauge->pushGauge(); // render empty gauge (no needle yet)
@@ -362,30 +327,17 @@ void gfxLoop(LGFX_Device* gfx)
   {
     static int prev_x[2];
     static int peak_x[2];
-    float avglevel=0, lastavglevel=0;
 
-    auto buf = out.getBuffer();
-    if (buf)
+    levels::level_t frame;
+    if (levelMeter.take(frame))
     {
-      memcpy(raw_data, buf, WAVE_SIZE * 2 * sizeof(int16_t)); // stereo data copy
       gfx->startWrite();
 
-
-      float levels[2];
-
-      // draw stereo level meter
+      // draw stereo level meter, true peak of every sample since the previous frame
       for (size_t i = 0; i < 2; ++i)
       {
-        int32_t level = 0;
-        for (size_t j = i; j < 640; j += 32)
-        {
-          uint32_t lv = abs(raw_data[j]);
-          if (level < lv) { level = lv; }
-        }
-
-        levels[i] = float(level * 90.0) / INT16_MAX;
-
-        int32_t x = (level * gfx->width()) / INT16_MAX;
+        int32_t x = frame.peak[i] * gfx->width();
+        if (x > gfx->width()) { x = gfx->width(); }
         int32_t px = prev_x[i];
         if (px != x)
         {
@@ -409,16 +361,32 @@ void gfxLoop(LGFX_Device* gfx)
         }
       }
 
-      avglevel = (levels[0]+levels[1])*0.5f;
-      if( avglevel!=lastavglevel ) {
-        VUMeterGauge->drawNeedle( avglevel );
-        lastavglevel = avglevel;
+      VUMeterGauge->setNeedle( vuToAngle( frame.mean( frame.vu ) ) );
+
+      // spectrum of the latest audio buffer
+      auto buf = out.getBuffer();
+      if (buf && spectrumBars)
+      {
+        fft_engine.exec(buf);
+        spectrumBars->setSampleRate(out.getRate());
+        spectrumBars->update(fft_engine);
+      }
+      if (buf && scope)
+      {
+        scope->update(buf, 320); // 320 stereo frames of the latest buffer
       }
 
       gfx->display();
       gfx->endWrite();
     }
   }
+
+  // let the needle settle, no frame is drawn once it stands still
+  if( VUMeterGauge->needleMoving() && !gfx->displayBusy() ) {
+    gfx->startWrite();
+    VUMeterGauge->easeNeedle();
+    gfx->endWrite();
+  }
 }
 
 
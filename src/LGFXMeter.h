@@ -3,6 +3,17 @@
 #ifdef __cplusplus
 
   #include "lgfx_meter/Gauge_Class.hpp"
+  #include "lgfx_meter/lgfxmeter_replay.hpp"
+  #include "lgfx_meter/lgfxmeter_planner.hpp"
+  #include "lgfx_meter/lgfxmeter_channel.hpp"
+  #include "lgfx_meter/lgfxmeter_levels.hpp"
+  #include "lgfx_meter/lgfxmeter_dsp.hpp"
+  #include "lgfx_meter/lgfxmeter_fft.hpp"
+  #include "lgfx_meter/Spectrum_Class.hpp"
+  #include "lgfx_meter/Waveform_Class.hpp"
+  #include "lgfx_meter/BarMeter_Class.hpp"
+  #include "lgfx_meter/Readout_Class.hpp"
+  #include "lgfx_meter/lgfxmeter_assets.hpp"
 
 #else
 
@@ -0,0 +1,346 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_memory.hpp"
+#include "lgfxmeter_spans.hpp"
+#include "Gauge_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+
+  namespace barmeter
+  {
+
+    using namespace utils;
+
+    bar_cfg_t cfg =
+    {
+      .display     = nullptr,
+      .clipRect    = {0,0,0,0},
+      .barRect     = {0,0,0,0},
+      .orientation = BAR_HORIZONTAL,
+      .items       = nullptr,
+      .items_count = 0,
+      .palette     = &gauge::default_palette,
+      .min         = 0.0f,
+      .max         = 100.0f,
+      .bgSprite    = nullptr,
+      .bgPos       = {0,0},
+      .bg_color    = 0x000000U,
+      .track_color = 0x222222U,
+      .bar_color   = 0x22cc44U,
+      .peak_color  = 0xffffffU,
+      .peak_hold   = 20,   // updates, 0 = no marker
+      .peak_decay  = 1.0f, // px per update
+      .zoomAA      = 0.5f,
+      .bit_depth   = 16
+    };
+
+    bar_cfg_t config() { return cfg; }
+
+
+   /*
+    * Bar meter.
+    *
+    * The face (background, empty track, rulers) is rendered once: rulers are drawn in a
+    * 4bpp mask at 1/zoomAA scale and antialiased into the face sprite, as the gauge does.
+    * setValue() only sends the part of the track whose color changed since the previous
+    * update: bar growth is filled, shrinking is restored from the face, same for the
+    * peak marker (see spans::drawChanges()).
+    *
+    *   bar_cfg_t bcfg = barmeter::config();
+    *   bcfg.display  = &M5.Display;
+    *   bcfg.clipRect = { 0, 200, 320, 40 };
+    *   bcfg.barRect  = { 10, 4, 300, 10 };
+    *   bcfg.items    = barRulers; // ruler_t angles are values relative to min
+    *   bcfg.items_count = 1;
+    *   BarMeter_Class *bar = new BarMeter_Class( bcfg );
+    *   bar->pushBar();
+    *   bar->setValue( 42 );
+    *
+    */
+
+    class BarMeter_Class
+    {
+    public:
+
+      BarMeter_Class( bar_cfg_t _cfg = barmeter::cfg )
+      {
+        assert( _cfg.display );
+        cfg = _cfg;
+        if( !cfg.palette ) cfg.palette = &gauge::default_palette;
+        length = cfg.orientation == BAR_HORIZONTAL ? cfg.barRect.w : cfg.barRect.h;
+        if( length < 1 || cfg.max == cfg.min ) {
+          log_e("Invalid bar geometry/range");
+          return;
+        }
+        _ready = renderFace();
+      };
+
+      ~BarMeter_Class()
+      {
+        if( dash ) dash->removeWidget( widgetId );
+        if( faceSprite ) { faceSprite->deleteSprite(); delete faceSprite; }
+      }
+
+      bool ready() { return _ready; }
+
+      void setValue( float value );
+      // push the whole face + bar, e.g. after the background was pushed again
+      void pushBar();
+      void resetPeak() { track.peak = track.bar; track.age = 0; }
+      ICS_Sprite *getFaceSprite() { return faceSprite; }
+      // let a dashboard composite this bar instead of pushing it
+      void attach( dashboard::Dashboard_Class *_dash );
+
+    private:
+
+      bar_cfg_t  cfg;
+      ICS_Sprite *faceSprite = nullptr;
+      int32_t    length     = 0; // track length, px
+
+      spans::peak_bar_t track = { 0, 0, 0, 0, 0 };
+      bool       _ready     = false;
+
+      dashboard::Dashboard_Class *dash = nullptr;
+      int8_t     widgetId   = -1;
+      clipRect_t dirty      = {0,0,0,0}; // changed spans of the update, submitted at once
+
+      bool renderFace();
+      void drawRuler( ICS_Sprite *mask, const ruler_t *ruler, uint32_t color_index, float scale );
+      int32_t valueToPx( float value );
+      clipRect_t spanRect( int32_t pos0, int32_t pos1 );
+      void drawSpan( int32_t pos0, int32_t pos1, spans::pixel_t kind );
+      void drawTrack();
+      static void compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    };
+
+
+    bool BarMeter_Class::renderFace()
+    {
+      faceSprite = new ICS_Sprite( cfg.display );
+      faceSprite->setColorDepth( cfg.bit_depth );
+      // read for every shrinking span
+      if( !memory::createSprite( faceSprite, cfg.clipRect.w, cfg.clipRect.h, memory::HEAT_WARM ) ) {
+        log_e("Can't create %dx%d bar face", cfg.clipRect.w, cfg.clipRect.h );
+        delete faceSprite;
+        faceSprite = nullptr;
+        return false;
+      }
+      if( cfg.bgSprite ) cfg.bgSprite->pushSprite( faceSprite, cfg.bgPos.x-cfg.clipRect.x, cfg.bgPos.y-cfg.clipRect.y );
+      else faceSprite->fillSprite( cfg.bg_color );
+      faceSprite->fillRect( cfg.barRect.x, cfg.barRect.y, cfg.barRect.w, cfg.barRect.h, cfg.track_color );
+
+      if( !cfg.items || cfg.items_count == 0 || cfg.zoomAA <= 0 ) return true;
+
+      float scale = 1.0f/cfg.zoomAA;
+      ICS_Sprite *mask = new ICS_Sprite();
+      mask->setColorDepth( 4 );
+      // discarded after rendering
+      if( !memory::createSprite( mask, cfg.clipRect.w*scale, cfg.clipRect.h*scale, memory::HEAT_COLD, nullptr, nullptr, true ) ) {
+        log_e("Not enough ram to create bar mask, rendering without rulers. Hint: set cfg.zoomAA to 1.0.");
+        delete mask;
+        return true;
+      }
+      mask->setPaletteColor( 0, cfg.palette->transparent_color );
+      mask->setPaletteColor( 1, cfg.palette->fill_color );
+      mask->setPaletteColor( 2, cfg.palette->warn_color );
+      mask->setPaletteColor( 3, cfg.palette->ok_color );
+      mask->fillSprite( 0 );
+      for( size_t i=0; i<cfg.items_count; i++ ) {
+        drawRuler( mask, cfg.items[i].ruler, cfg.items[i].color_index, scale );
+      }
+      mask->pushRotateZoomWithAA( faceSprite, cfg.clipRect.w/2, cfg.clipRect.h/2, 0.0, cfg.zoomAA, cfg.zoomAA, cfg.palette->transparent_color );
+      mask->deleteSprite();
+      delete mask;
+      return true;
+    }
+
+
+    // straight axis version of Gauge_Class::drawRuler(), coords relative to clipRect then scaled
+    void BarMeter_Class::drawRuler( ICS_Sprite *mask, const ruler_t *ruler, uint32_t color_index, float scale )
+    {
+      bool horizontal = cfg.orientation == BAR_HORIZONTAL;
+      float pxPerUnit = length / ( cfg.max - cfg.min );
+      // ruler baseline, ticks and labels grow away from the bar
+      int32_t base    = horizontal ? cfg.barRect.y + cfg.barRect.h + ruler->radius : cfg.barRect.x - ruler->radius;
+      int32_t dir     = horizontal ? 1 : -1;
+      int32_t start   = horizontal ? cfg.barRect.x : cfg.barRect.y + cfg.barRect.h;
+
+      auto fillZone = [&]( float pos0, float pos1, int32_t depth0, int32_t depth1 ) {
+        // pos along the axis, depth away from the bar
+        float a0 = start + pos0*( horizontal ? 1 : -1 ), a1 = start + pos1*( horizontal ? 1 : -1 );
+        float d0 = base + depth0*dir, d1 = base + depth1*dir;
+        float x0 = horizontal ? a0 : d0, x1 = horizontal ? a1 : d1;
+        float y0 = horizontal ? d0 : a0, y1 = horizontal ? d1 : a1;
+        if( x1 < x0 ) { float t = x0; x0 = x1; x1 = t; }
+        if( y1 < y0 ) { float t = y0; y0 = y1; y1 = t; }
+        mask->fillRect( x0*scale, y0*scale, max( 1, int32_t((x1-x0)*scale) ), max( 1, int32_t((y1-y0)*scale) ), color_index );
+      };
+
+      fillZone( ruler->angleStart*pxPerUnit, ruler->angleEnd*pxPerUnit, 0, ruler->width ); // initial line
+
+      for( size_t i=0; i<ruler->units_count; i++ ) {
+        const ruler_unit_t *unit = &ruler->units[i];
+        float pos = ( ruler->angleStart + unit->angle )*pxPerUnit;
+        if( unit->size != 0 ) {
+          fillZone( pos-0.5f, pos+0.5f, 0, ruler->width*unit->size );
+        }
+        if( unit->label != nullptr ) {
+          mask->setTextDatum( unit->textDatum );
+          mask->setFont( unit->fontFace );
+          mask->setTextSize( unit->fontSize );
+          float depth = unit->distance + float( mask->fontHeight()/2.0 ) * ( unit->distance>0?1.0:-1.0 );
+          mask->setTextSize( scale * unit->fontSize );
+          mask->setTextColor( color_index );
+          float along = start + pos*( horizontal ? 1 : -1 );
+          float away  = base + depth*dir;
+          float x = horizontal ? along : away;
+          float y = horizontal ? away  : along;
+          mask->drawString( unit->label, x*scale, y*scale );
+        }
+      }
+    }
+
+
+    int32_t BarMeter_Class::valueToPx( float value )
+    {
+      float px = ( value - cfg.min ) * length / ( cfg.max - cfg.min );
+      if( px <= 0 ) return 0;
+      if( px >= length ) return length;
+      return int32_t( px );
+    }
+
+
+    // display rect of the track between two positions
+    clipRect_t BarMeter_Class::spanRect( int32_t pos0, int32_t pos1 )
+    {
+      int32_t x = cfg.clipRect.x + cfg.barRect.x;
+      int32_t y = cfg.clipRect.y + cfg.barRect.y;
+      if( cfg.orientation == BAR_HORIZONTAL ) return { x+pos0, y, pos1-pos0, cfg.barRect.h };
+      return { x, y+cfg.barRect.h-pos1, cfg.barRect.w, pos1-pos0 };
+    }
+
+
+    void BarMeter_Class::drawSpan( int32_t pos0, int32_t pos1, spans::pixel_t kind )
+    {
+      clipRect_t span = spanRect( pos0, pos1 );
+      if( dash ) {
+        dirty = dirty.w ? getBoundingRect( dirty, span ) : span;
+        return;
+      }
+      switch( kind ) {
+        case spans::PIXEL_BAR:  cfg.display->fillRect( span.x, span.y, span.w, span.h, cfg.bar_color );  break;
+        case spans::PIXEL_PEAK: cfg.display->fillRect( span.x, span.y, span.w, span.h, cfg.peak_color ); break;
+        case spans::PIXEL_BG:   restoreRect( cfg.display, faceSprite, cfg.clipRect.x, cfg.clipRect.y, span ); break;
+      }
+      bus::record( span );
+    }
+
+
+    // send only the positions whose color changed, grouped in spans
+    void BarMeter_Class::drawTrack()
+    {
+      spans::drawChanges( &track, length, cfg.peak_hold, [this]( int32_t pos0, int32_t pos1, spans::pixel_t kind ) {
+        drawSpan( pos0, pos1, kind );
+      });
+      if( dash && dirty.w ) {
+        dash->invalidate( widgetId, dirty );
+        dirty = {0,0,0,0};
+      }
+    }
+
+
+    void BarMeter_Class::setValue( float value )
+    {
+      if( !_ready ) return;
+      spans::setBar( &track, valueToPx( value ), cfg.peak_hold, cfg.peak_decay );
+      if( dash ) { drawTrack(); return; }
+      cfg.display->startWrite();
+      drawTrack();
+      cfg.display->endWrite();
+    }
+
+
+    void BarMeter_Class::pushBar()
+    {
+      if( !_ready ) return;
+      if( dash ) { dash->invalidate( widgetId ); return; }
+      cfg.display->startWrite();
+      faceSprite->pushSprite( cfg.display, cfg.clipRect.x, cfg.clipRect.y );
+      bus::record( cfg.clipRect );
+      track.drawnBar  = 0;
+      track.drawnPeak = 0;
+      drawTrack();
+      cfg.display->endWrite();
+    }
+
+
+    void BarMeter_Class::attach( dashboard::Dashboard_Class *_dash )
+    {
+      if( !_ready || !_dash ) return;
+      dash     = _dash;
+      widgetId = dash->addWidget( cfg.clipRect, compose, this );
+    }
+
+
+    // face, bar and peak marker, dst (0,0) is at originX/originY on the display
+    void BarMeter_Class::compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      BarMeter_Class *self = (BarMeter_Class*)ctx;
+      self->faceSprite->pushSprite( dst, self->cfg.clipRect.x-originX, self->cfg.clipRect.y-originY );
+      const spans::peak_bar_t *track = &self->track;
+      if( track->drawnBar > 0 ) {
+        clipRect_t span = self->spanRect( 0, track->drawnBar );
+        dst->fillRect( span.x-originX, span.y-originY, span.w, span.h, self->cfg.bar_color );
+      }
+      int32_t pos0, pos1;
+      if( spans::drawnPeakSpan( track, self->length, self->cfg.peak_hold, &pos0, &pos1 ) ) {
+        clipRect_t span = self->spanRect( pos0, pos1 );
+        dst->fillRect( span.x-originX, span.y-originY, span.w, span.h, self->cfg.peak_color );
+      }
+    }
+
+
+  }; // end namespace barmeter
+
+
+  using BarMeter_Class = barmeter::BarMeter_Class;
+
+}; // end namespace LGFXMeter
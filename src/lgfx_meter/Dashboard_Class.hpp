@@ -0,0 +1,313 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_memory.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace dashboard
+  {
+
+    using namespace utils;
+
+   /*
+    * Dashboard compositor.
+    *
+    * The dashboard owns the display: widgets don't push anything, they register a
+    * render callback for their bounds and submit dirty rectangles. Once per frame
+    * overlapping dirty rectangles are merged (an area is never sent twice), then the
+    * others are merged whenever the bus cost model predicts that one bigger window
+    * is cheaper than two separate ones, then each merged rectangle is
+    * composited once (every widget it intersects renders into it, in registration
+    * order) and pushed in a single window.
+    *
+    *   dashboard::Dashboard_Class dash( { &M5.Display, 16, 40, 0x000000U, bus::default_cost } );
+    *   ICSGauge->attach( &dash );
+    *   int8_t label = dash.addWidget( { 0, 200, 320, 40 }, drawLabel, nullptr );
+    *
+    *   // loop
+    *   ICSGauge->drawNeedle( angle ); // only submits the needle dirty rect
+    *   dash.invalidate( label );
+    *   dash.pushFrame();
+    *
+    * Gauge_Class, BarMeter_Class, Readout_Class, Spectrum_Class and Waveform_Class all
+    * have attach(): their updates then only submit dirty rectangles. They remove their
+    * widget when deleted.
+    *
+    */
+
+    // dst (0,0) is at originX/originY on the display, dst clip is the area being composited
+    typedef void (*renderCallback_t)( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    const uint8_t max_widgets = 16;
+    const uint8_t max_dirty   = 32;
+
+    struct dashboard_cfg_t
+    {
+      ICS_Display    *display;
+      uint8_t        bit_depth; // composite buffer depth
+      int32_t        max_lines; // composite buffer height, taller rects are composited in bands
+      uint32_t       bg_color;  // cleared before widgets render
+      bus::bus_cost_t cost;     // used to decide which rects are merged
+    };
+
+    struct widget_t
+    {
+      clipRect_t       bounds; // display coords
+      renderCallback_t render;
+      void             *ctx;
+    };
+
+
+    class Dashboard_Class
+    {
+    public:
+
+      Dashboard_Class( dashboard_cfg_t _cfg )
+      {
+        assert( _cfg.display );
+        cfg = _cfg;
+        if( cfg.max_lines <= 0 ) cfg.max_lines = 1;
+      };
+
+      ~Dashboard_Class()
+      {
+        if( canvas ) { canvas->deleteSprite(); delete canvas; }
+      }
+
+      // returns the widget id, or -1
+      int8_t addWidget( clipRect_t bounds, renderCallback_t render, void *ctx = nullptr );
+      // the widget area is redrawn without it, other widget ids are unchanged
+      void removeWidget( int8_t id );
+      // mark a widget (or a part of it) for redraw
+      void invalidate( int8_t id );
+      void invalidate( int8_t id, clipRect_t rect );
+      // mark a display area for redraw
+      void invalidateRect( clipRect_t rect );
+      // composite and push the dirty areas
+      void pushFrame();
+
+      // merged rects of the last frame
+      const clipRect_t *getRects() { return rects; }
+      uint8_t getRectsCount() { return rectsCount; }
+
+    private:
+
+      dashboard_cfg_t cfg;
+      ICS_Sprite *canvas = nullptr; // composite buffer, display width x max_lines
+
+      widget_t   widgets[max_widgets];
+      uint8_t    widgetsCount = 0;
+
+      clipRect_t rects[max_dirty];  // dirty rects, merged in place by pushFrame()
+      uint8_t    rectsCount = 0;
+      bool       pending = false;   // rects hold a frame not pushed yet
+
+      static bool intersect( clipRect_t a, clipRect_t b, clipRect_t *out );
+      void mergeOverlaps();
+      void mergeRects();
+      bool createCanvas();
+      void composite( clipRect_t rect );
+
+    };
+
+
+    int8_t Dashboard_Class::addWidget( clipRect_t bounds, renderCallback_t render, void *ctx )
+    {
+      if( widgetsCount >= max_widgets || !render ) {
+        log_e("Unable to add widget (%d/%d)", widgetsCount, max_widgets );
+        return -1;
+      }
+      widgets[widgetsCount] = { bounds, render, ctx };
+      invalidateRect( bounds );
+      return widgetsCount++;
+    }
+
+
+    void Dashboard_Class::removeWidget( int8_t id )
+    {
+      if( id < 0 || id >= widgetsCount || !widgets[id].render ) return;
+      invalidateRect( widgets[id].bounds );
+      widgets[id].render = nullptr;
+      widgets[id].ctx    = nullptr;
+      while( widgetsCount > 0 && !widgets[widgetsCount-1].render ) widgetsCount--; // trailing slots are reused
+    }
+
+
+    void Dashboard_Class::invalidate( int8_t id )
+    {
+      if( id < 0 || id >= widgetsCount || !widgets[id].render ) return;
+      invalidateRect( widgets[id].bounds );
+    }
+
+
+    void Dashboard_Class::invalidate( int8_t id, clipRect_t rect )
+    {
+      if( id < 0 || id >= widgetsCount || !widgets[id].render ) return;
+      clipRect_t clipped;
+      if( intersect( rect, widgets[id].bounds, &clipped ) ) invalidateRect( clipped );
+    }
+
+
+    void Dashboard_Class::invalidateRect( clipRect_t rect )
+    {
+      if( pending ) { rectsCount = 0; pending = false; } // previous frame stats are dropped
+      clipRect_t screen = { 0, 0, cfg.display->width(), cfg.display->height() };
+      if( !intersect( rect, screen, &rect ) ) return;
+      if( rectsCount == max_dirty ) {
+        // out of slots: fold into the last rect
+        rects[max_dirty-1] = getBoundingRect( rects[max_dirty-1], rect );
+        return;
+      }
+      rects[rectsCount++] = rect;
+    }
+
+
+    bool Dashboard_Class::intersect( clipRect_t a, clipRect_t b, clipRect_t *out )
+    {
+      int32_t x0 = max( a.x, b.x ), y0 = max( a.y, b.y );
+      int32_t x1 = min( a.x+a.w, b.x+b.w ), y1 = min( a.y+a.h, b.y+b.h );
+      if( x1 <= x0 || y1 <= y0 ) return false;
+      *out = { x0, y0, x1-x0, y1-y0 };
+      return true;
+    }
+
+
+    // overlapping rects would be composited and sent twice: merge them whatever the cost
+    void Dashboard_Class::mergeOverlaps()
+    {
+      bool merged = true;
+      while( merged ) { // a grown rect may overlap one already checked
+        merged = false;
+        for( int a=0; a<rectsCount; a++ ) {
+          for( int b=a+1; b<rectsCount; b++ ) {
+            clipRect_t common;
+            if( !intersect( rects[a], rects[b], &common ) ) continue;
+            rects[a] = getBoundingRect( rects[a], rects[b] );
+            rects[b] = rects[--rectsCount];
+            b--; // the moved rect is checked too
+            merged = true;
+          }
+        }
+      }
+    }
+
+
+    // greedy: merge the pair with the best predicted saving until no merge saves anything
+    void Dashboard_Class::mergeRects()
+    {
+      mergeOverlaps();
+      while( rectsCount > 1 ) {
+        float bestSaving = 0;
+        int   bestA = -1, bestB = -1;
+        for( int a=0; a<rectsCount; a++ ) {
+          float costA = bus::predict( cfg.cost, rects[a] );
+          for( int b=a+1; b<rectsCount; b++ ) {
+            clipRect_t u = getBoundingRect( rects[a], rects[b] );
+            float saving = costA + bus::predict( cfg.cost, rects[b] ) - bus::predict( cfg.cost, u );
+            if( saving > bestSaving ) {
+              bestSaving = saving;
+              bestA = a;
+              bestB = b;
+            }
+          }
+        }
+        if( bestA < 0 ) break;
+        rects[bestA] = getBoundingRect( rects[bestA], rects[bestB] );
+        rects[bestB] = rects[--rectsCount];
+        mergeOverlaps();
+      }
+    }
+
+
+    bool Dashboard_Class::createCanvas()
+    {
+      if( canvas ) return true;
+      canvas = new ICS_Sprite( cfg.display );
+      canvas->setColorDepth( cfg.bit_depth );
+      if( !memory::createSprite( canvas, cfg.display->width(), cfg.max_lines, memory::HEAT_HOT ) ) {
+        log_e("Unable to create %dx%d composite buffer", cfg.display->width(), cfg.max_lines );
+        delete canvas;
+        canvas = nullptr;
+        return false;
+      }
+      return true;
+    }
+
+
+    // render every widget intersecting the rect, band by band, and push each band once
+    void Dashboard_Class::composite( clipRect_t rect )
+    {
+      for( int32_t y=rect.y; y<rect.y+rect.h; y+=cfg.max_lines ) {
+        clipRect_t band = { rect.x, y, rect.w, min( cfg.max_lines, rect.y+rect.h-y ) };
+        canvas->setClipRect( 0, 0, band.w, band.h );
+        canvas->fillRect( 0, 0, band.w, band.h, cfg.bg_color );
+        for( uint8_t i=0; i<widgetsCount; i++ ) {
+          clipRect_t area;
+          if( !widgets[i].render || !intersect( band, widgets[i].bounds, &area ) ) continue;
+          canvas->setClipRect( area.x-band.x, area.y-band.y, area.w, area.h );
+          widgets[i].render( canvas, band.x, band.y, widgets[i].ctx );
+        }
+        canvas->clearClipRect();
+        // the buffer is display wide, only the band is sent
+        cfg.display->setClipRect( band.x, band.y, band.w, band.h );
+        canvas->pushSprite( cfg.display, band.x, band.y );
+        cfg.display->clearClipRect();
+        bus::record( band );
+      }
+    }
+
+
+    void Dashboard_Class::pushFrame()
+    {
+      if( pending || rectsCount == 0 ) return;
+      if( !createCanvas() ) return;
+      mergeRects();
+      cfg.display->startWrite();
+      for( uint8_t i=0; i<rectsCount; i++ ) composite( rects[i] );
+      cfg.display->endWrite();
+      pending = true;
+    }
+
+
+  }; // end namespace dashboard
+
+
+  using Dashboard_Class = dashboard::Dashboard_Class;
+
+}; // end namespace LGFXMeter
@@ -33,6 +33,9 @@
 
 #include "lgfxmeter_types.hpp"
 #include "Needle_Class.hpp"
+#include "lgfxmeter_memory.hpp"
+#include "Dashboard_Class.hpp"
+#include "lgfxmeter_layers.hpp"
 
 
 namespace LGFXMeter
@@ -85,10 +88,47 @@ namespace LGFXMeter
       .zoomAA    = 0.5f, // antialias scale value, set to 0.5 or lower for smoothing, 1.0 if ram issues or 2.0 for ugly pixelated result
       .bgImage   = &default_background,
       .needle    = needle::config(),
-      .palette   = &default_gauge_set.palette
+      .palette   = &default_gauge_set.palette,
+      .bit_depth = 0, // use bgImage bit depth
+      .placement = PLACE_DEFAULT, // memory policy
+      .mask_placement = PLACE_DEFAULT // same as placement
     };
 
 
+    // gauge canvas bit depth
+    uint8_t canvasBitDepth( const gauge_cfg_t &_cfg )
+    {
+      if( _cfg.bit_depth ) return _cfg.bit_depth;
+      return _cfg.bgImage ? _cfg.bgImage->bit_depth : default_background.bit_depth;
+    }
+
+
+    placement_t maskPlacement( const gauge_cfg_t &_cfg )
+    {
+      return _cfg.mask_placement != PLACE_DEFAULT ? _cfg.mask_placement : _cfg.placement;
+    }
+
+
+    // keep the layer under the face so a new face doesn't render it again: required with a user canvas
+    // (nothing can re-render its content), otherwise only when psram can hold it
+    bool keepsBackground( const gauge_cfg_t &_cfg, uint32_t snapshot_bytes )
+    {
+      if( !_cfg.gauge.items || _cfg.gauge.items_count == 0 ) return false;
+      if( _cfg.dstCanvas ) return true;
+      return memory::prefersPsram( memory::HEAT_COLD, _cfg.placement ) && memory::freePsram() > 2*snapshot_bytes;
+    }
+
+
+    // angle value readout area, relative to the gauge, see drawAngleValue()
+    clipRect_t valueBounds()
+    {
+      ICS_Sprite measure; // font metrics only, nothing is allocated
+      measure.setFont( &FreeMonoBold9pt7b );
+      measure.setTextSize(1);
+      return { 0, 0, measure.textWidth("<=00.00") + 3, int32_t(measure.fontHeight()*1.3) };
+    }
+
+
     class Gauge_Class
     {
     public:
@@ -101,21 +141,82 @@ namespace LGFXMeter
         setupGauge();
       };
 
+      ~Gauge_Class()
+      {
+        waitIdle();
+        if( dash ) dash->removeWidget( widgetId ); // the dashboard must not call compose() anymore
+        delete pusher; // waits for frames in flight
+        delete Needle;
+        delete layerStack; // drops the snapshots
+        ICS_Sprite *sprites[] = { spriteValue, spriteMask, cfg.dstCanvas ? nullptr : gaugeSprite }; // a user canvas is not ours
+        for( auto sprite : sprites ) {
+          if( !sprite ) continue;
+          sprite->deleteSprite();
+          delete sprite;
+        }
+      }
+
+      // owns its needle, pipeline, layers and sprites
+      Gauge_Class( const Gauge_Class& ) = delete;
+      Gauge_Class& operator=( const Gauge_Class& ) = delete;
+
       void pushGauge();
       void createNeedle();
       void drawNeedle( float angle, bool render_value = false );
       void animateNeedle( float_t angle, bool render_value = false );
       void setNeedle( float_t angle );
       void easeNeedle( uint32_t timeout = 300, easing::easingFunc_t _easingFunc=easing::easeInOutQuart );
+      void setNeedleSpring( uint32_t settle_ms = 300 );
+      void setNeedleEasing();
+      bool needleMoving() { return Needle ? Needle->moving() : false; }
+      void resetPeak() { if( Needle ) Needle->resetPeak(); }
+      void setClock( clockFunc_t _clockFunc ) { if( Needle ) Needle->setClock( _clockFunc ); }
+      void setPushMode( pipeline::push_mode_t mode, int core = 0 );
+      void waitIdle() { if( pusher ) pusher->waitIdle(); }
+      void onFramePushed( pipeline::frameCallback_t cb, void *ctx = nullptr );
+      // let a dashboard composite this gauge instead of pushing it
+      void attach( dashboard::Dashboard_Class *_dash );
+      // replace the background image (nullptr for transparent), rulers are re-rendered over it
+      void setBackground( const image_t *_bgImage );
+      // re-flatten a static layer and the ones above it, then push the gauge
+      void invalidate( layers::layer_id_t layer );
+      // custom overlay drawn over the needle, replaces the angle value readout
+      void setOverlay( layers::layerRender_t render, void *ctx = nullptr );
+      layers::Layer_Stack *getLayers() { return layerStack; }
       ICS_Sprite *getGaugeSprite() { return gaugeSprite; }
+      const gauge_report_t *getReport() { return &report; }
 
     private:
 
       Needle_Class  *Needle      = nullptr;
-      ICS_Sprite    *spriteMask  = nullptr;
+      pipeline::Push_Pipeline *pusher = nullptr; // needle frames pipeline, see setPushMode()
+      pipeline::frameCallback_t frameCallback = nullptr;
+      void *frameCallbackCtx = nullptr;
+
+      dashboard::Dashboard_Class *dash = nullptr;
+      int8_t widgetId = -1;
+      static void compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+      static void needleDirty( clipRect_t rect, void *ctx );
+
+      // background + face are flattened in gaugeSprite, needle + overlay are drawn per region
+      layers::Layer_Stack *layerStack = nullptr;
+      static void renderBackground( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+      static void renderFace( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+      static void renderNeedle( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+      static void renderValue( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+      static void renderOverlay( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+      float      valueAngle = 0;     // angle value readout, see drawAngleValue()
+      bool       valueShown = false;
+      clipRect_t valueRect  = { 0, 0, 0, 0 }; // relative to clipRect
+
+      ICS_Sprite    *spriteMask  = nullptr; // face rulers, only exists while the face is flattened
+      ICS_Sprite    *spriteValue = nullptr; // angle value readout scratch, see drawAngleValue()
       ICS_Sprite    *gaugeSprite = nullptr;
       const image_t *bgImage     = nullptr;
 
+      gauge_report_t report; // construction timings and allocations
+
       //const float deg2width = 2*PI/180.0f;
       const float _offset = -90.0; // "0 degree middle top" ref angle for drawing
 
@@ -148,6 +249,7 @@ namespace LGFXMeter
 
     void Gauge_Class::setupGauge()
     {
+      memory::resetReport( &report );
       // background image behind the gauge
       bgImage        = cfg.bgImage;
       if( cfg.needle.axis.x+cfg.needle.axis.y==0 ) {
@@ -165,61 +267,132 @@ namespace LGFXMeter
         log_d("Using provided background canvas");
         gaugeSprite = cfg.dstCanvas;
       } else {
-        uint8_t bit_depth = bgImage ? bgImage->bit_depth : default_background.bit_depth;
+        uint8_t bit_depth = canvasBitDepth( cfg );
+        memory::beginPhase( &report, "canvas" );
         gaugeSprite = new ICS_Sprite( cfg.display );
         gaugeSprite->setColorDepth( bit_depth );
-        // psram sprites are slow, default behaviour is to use dram, override this with cfg.dstCanvas
-        gaugeSprite->setPsram( false );
-        if( !gaugeSprite->createSprite( clipRect->w, clipRect->h ) ) {
+        // the canvas is read by every needle frame to restore the background behind the needle,
+        // placement is decided by memory::policy (dram by default), see cfg.placement or cfg.dstCanvas
+        bool canvas_created = memory::createSprite( gaugeSprite, clipRect->w, clipRect->h, memory::HEAT_WARM, "canvas", &report, false, cfg.placement );
+        memory::endPhase( &report );
+        if( !canvas_created ) {
           log_e("Can't create gauge canvas :(");
           return;
         }
 
-        bool has_background_image = bgImage && bgImage->data && bgImage->len > 0;
-
-        if( has_background_image ) { // render the provided background image
-
-          drawImage( gaugeSprite, bgImage, -clipRect->x, -clipRect->y/*, clipRect->w, clipRect->h*/ );
-
-        } else {
-          // no background image provided, fill with transparent color
-          gaugeSprite->fillSprite( cfg.palette->transparent_color );
-          _is_transparent = true;
-          // TODO: cropped circle mask - gaugeSprite->fillCircle( axis.x, axis.y, axis.y-clipRect->h, 0xeeeeee);
-          // gaugeSprite->pushSprite( clipRect->x, clipRect->y, cfg.palette->transparent_color );
-        }
-        log_d("Using Generated %dbpp gauge canvas with %s backgound", bit_depth, has_background_image ? "png" : "transparent" );
+        log_d("Using Generated %dbpp gauge canvas", bit_depth );
       }
 
       // pushRotated destination coords
       dstPosX  = clipRect->w/2;
       dstPosY  = clipRect->h/2;
-      // render
 
-      if( cfg.gauge.items && cfg.gauge.items_count > 0 ) {
-        if( initMask() ) {
-          drawRulers();
-          spriteMask->deleteSprite();
+      layerStack = new layers::Layer_Stack( gaugeSprite );
+      layerStack->setTransparent( false, cfg.palette->transparent_color );
+      if( !cfg.dstCanvas ) layerStack->setLayer( layers::LAYER_BACKGROUND, renderBackground, this );
+      if( cfg.gauge.items && cfg.gauge.items_count > 0 ) layerStack->setLayer( layers::LAYER_FACE, renderFace, this );
+      layerStack->setLayer( layers::LAYER_DYNAMIC, renderNeedle, this );
+      layerStack->setLayer( layers::LAYER_OVERLAY, renderValue, this );
+      uint32_t snapshot_bytes = memory::spriteBytes( gaugeSprite->width(), gaugeSprite->height(), gaugeSprite->getColorDepth() );
+      if( keepsBackground( cfg, snapshot_bytes ) ) {
+        if( !layerStack->cache( layers::LAYER_BACKGROUND, cfg.placement ) && cfg.dstCanvas ) {
+          log_w("No background snapshot, invalidating the face will draw the rulers twice");
         }
       }
+      // render
+      layerStack->flatten();
 
+      memory::beginPhase( &report, "needle" );
       initNeedle();
+      memory::endPhase( &report );
+      log_d("Gauge ready: %d bytes kept, %d us, dram low water %d%s", report.live_bytes, report.total_us, report.dram_low_water, report.failed ? " [FAILED]" : "" );
     }
 
 
 
+    // static layer: background image, or transparent color when there is none
+    void Gauge_Class::renderBackground( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      const image_t *bgImage = self->bgImage;
+      bool has_background_image = bgImage && bgImage->data && bgImage->len > 0;
+
+      memory::beginPhase( &self->report, "background" );
+      if( has_background_image ) { // render the provided background image
+        // only the gauge area of the image is decoded/copied
+        drawImage( dst, bgImage, -originX, -originY, self->clipRect->w, self->clipRect->h, self->clipRect->x, self->clipRect->y );
+      } else {
+        // no background image provided, fill with transparent color
+        dst->fillRect( -originX, -originY, self->clipRect->w, self->clipRect->h, cfg.palette->transparent_color );
+        // TODO: cropped circle mask - gaugeSprite->fillCircle( axis.x, axis.y, axis.y-clipRect->h, 0xeeeeee);
+      }
+      self->_is_transparent = !has_background_image;
+      self->layerStack->setTransparent( self->_is_transparent, cfg.palette->transparent_color );
+      memory::endPhase( &self->report );
+      log_d("Rendered %s background", has_background_image ? "png" : "transparent" );
+    }
+
+
+    // static layer: rulers, rendered in the mask then antialiased into the canvas
+    void Gauge_Class::renderFace( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      assert( dst == self->gaugeSprite ); // only flattened, never drawn per region
+      memory::beginPhase( &self->report, "mask" );
+      bool mask_created = self->initMask();
+      memory::endPhase( &self->report );
+      if( mask_created ) {
+        ICS_Sprite *spriteMask = self->spriteMask;
+        memory::beginPhase( &self->report, "rulers" );
+        self->drawRulers();
+        memory::addFree( &self->report, memory::spriteBytes( spriteMask->width(), spriteMask->height(), spriteMask->getColorDepth() ) );
+        spriteMask->deleteSprite();
+        memory::endPhase( &self->report );
+      }
+    }
+
+
+    void Gauge_Class::renderNeedle( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      if( self->Needle ) self->Needle->drawTo( dst, originX+self->clipRect->x, originY+self->clipRect->y );
+    }
+
+
+    // default overlay: angle value readout
+    void Gauge_Class::renderValue( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      if( !self->valueShown ) return;
+      char degreeStr[12] = {0};
+      snprintf(degreeStr, 11, "< %.2f", self->valueAngle );
+      dst->setTextColor( TFT_BLACK );
+      dst->setFont( &FreeMonoBold9pt7b );
+      dst->setTextDatum( ML_DATUM );
+      dst->setTextSize(1);
+      dst->drawString( degreeStr, self->valueRect.x+3-originX, self->valueRect.y+self->valueRect.h/2-originY );
+    }
+
+
+    // needle frames callback
+    void Gauge_Class::renderOverlay( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      self->layerStack->render( layers::LAYER_OVERLAY, dst, originX, originY );
+    }
+
+
     bool Gauge_Class::initMask()
     {
       uint8_t bit_depth = 4;
-      spriteMask = new ICS_Sprite();
-      spriteMask->setColorDepth( bit_depth );
-      // this sprite will be discarded after initial rendering and doesn't need to explicitely sit in dram
-      spriteMask->setPsram( psramInit() );
       // calculate mask size
       int32_t maskWidth   = clipRect->w/dstShrinkLevel;
       int32_t maskHeight  = clipRect->h/dstShrinkLevel;
-      // create mask sprite
-      if( !spriteMask->createSprite( maskWidth, maskHeight ) ) {
+      if( !spriteMask ) spriteMask = new ICS_Sprite();
+      spriteMask->setColorDepth( bit_depth );
+      // create mask sprite, it will be discarded after initial rendering and doesn't need to explicitely sit in dram
+      bool mask_created = memory::createSprite( spriteMask, maskWidth, maskHeight, memory::HEAT_COLD, "mask", &report, true, maskPlacement( cfg ) );
+      if( !mask_created ) {
         log_e("Not enough ram to create mask canvas. Hint: create the object earlier in the setup, or set cfg.zoomAA to 1.0.");
         return false;
       }
@@ -251,8 +424,9 @@ namespace LGFXMeter
       needle->border_color      = cfg.palette->needle_border_color;
       needle->transparent_color = cfg.palette->transparent_color;
       needle->shadow_color      = cfg.palette->needle_shadow_color;
+      needle->placement         = cfg.placement;
 
-      Needle = new Needle_Class( cfg.needle );
+      Needle = new Needle_Class( cfg.needle, &report );
       _ready = Needle->ready();
     }
 
@@ -323,13 +497,99 @@ namespace LGFXMeter
     }
 
 
+    void Gauge_Class::setPushMode( pipeline::push_mode_t mode, int core )
+    {
+      if( ! _ready ) return;
+      if( Needle ) Needle->setPipeline( nullptr );
+      if( pusher ) {
+        delete pusher; // waits for frames in flight
+        pusher = nullptr;
+      }
+      if( mode != pipeline::PUSH_SYNC ) {
+        int32_t max_w = clipRect->w, max_h = clipRect->h;
+        if( Needle ) Needle->getMaxFrame( &max_w, &max_h ); // frame buffers are allocated once for that size
+        pusher = new pipeline::Push_Pipeline( cfg.display, gaugeSprite->getColorDepth(), mode, core, max_w, max_h, cfg.placement );
+        pusher->onFrameDone( frameCallback, frameCallbackCtx );
+      }
+      if( Needle ) Needle->setPipeline( pusher );
+    }
+
+
+    void Gauge_Class::onFramePushed( pipeline::frameCallback_t cb, void *ctx )
+    {
+      frameCallback    = cb;
+      frameCallbackCtx = ctx;
+      if( pusher ) pusher->onFrameDone( cb, ctx );
+    }
+
+
+    void Gauge_Class::attach( dashboard::Dashboard_Class *_dash )
+    {
+      if( ! _ready || !_dash ) return;
+      waitIdle();
+      dash     = _dash;
+      widgetId = dash->addWidget( *clipRect, compose, this );
+      if( Needle ) Needle->onDirty( needleDirty, this );
+    }
+
+
+    // gauge layers, composited in dst
+    void Gauge_Class::compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      self->layerStack->compose( dst, originX-self->clipRect->x, originY-self->clipRect->y );
+    }
+
+
+    void Gauge_Class::setBackground( const image_t *_bgImage )
+    {
+      if( ! _ready ) return;
+      bgImage = _bgImage ? _bgImage : &default_background;
+      // also replaces a user provided canvas content
+      layerStack->setLayer( layers::LAYER_BACKGROUND, renderBackground, this );
+      invalidate( layers::LAYER_BACKGROUND );
+    }
+
+
+    void Gauge_Class::invalidate( layers::layer_id_t layer )
+    {
+      if( ! _ready ) return;
+      layerStack->invalidate( layer );
+      if( layers::Layer_Stack::isStatic( layer ) ) {
+        pushGauge(); // flattens
+      } else if( dash ) {
+        dash->invalidate( widgetId );
+      }
+    }
+
+
+    void Gauge_Class::setOverlay( layers::layerRender_t render, void *ctx )
+    {
+      if( ! _ready ) return;
+      layerStack->setLayer( layers::LAYER_OVERLAY, render, ctx );
+      if( Needle ) Needle->onOverlay( render ? renderOverlay : nullptr, this );
+    }
+
+
+    void Gauge_Class::needleDirty( clipRect_t rect, void *ctx )
+    {
+      Gauge_Class *self = (Gauge_Class*)ctx;
+      self->dash->invalidate( self->widgetId, rect );
+    }
+
+
     void Gauge_Class::pushGauge()
     {
       if( ! _ready ) return;
+      waitIdle(); // the display may still be owned by the push task
+      layerStack->flatten();
+      if( dash ) { dash->invalidate( widgetId ); return; }
       if( _is_transparent ) {
         gaugeSprite->pushSprite( clipRect->x, clipRect->y, cfg.palette->transparent_color );
+        bus::record( *clipRect, clipRect->h );
       } else {
         gaugeSprite->pushSprite( clipRect->x, clipRect->y/*, cfg.palette->transparent_color*/ );
+        bus::record( *clipRect );
       }
     }
 
@@ -348,24 +608,31 @@ namespace LGFXMeter
 
     void Gauge_Class::drawAngleValue( float angle )
     {
-      if( !spriteMask ) return;
-      spriteMask->setTextColor( TFT_BLACK );
-      spriteMask->setFont( &FreeMonoBold9pt7b );
-      spriteMask->setTextDatum( ML_DATUM );
-      spriteMask->setTextSize(1);
-      spriteMask->setPsram( false );
-      char degreeStr[12] = {0};
-      snprintf(degreeStr, 11, "< %.2f", angle );
-      int32_t clipWidth  = spriteMask->textWidth("<=00.00") + 3;
-      int32_t clipHeight = spriteMask->fontHeight()*1.3;
-      spriteMask->setColorDepth( gaugeSprite->getColorDepth() );
-
-      if( spriteMask->createSprite( clipWidth, clipHeight ) ) {
-        spriteMask->setClipRect( 0, 0, clipWidth, clipHeight );
-        gaugeSprite->pushSprite( spriteMask, 0, 0 );
-        spriteMask->drawString( degreeStr, 3, clipHeight/2 );
-        spriteMask->pushSprite( cfg.display, 0, 0 );
-        spriteMask->deleteSprite();
+      if( ! _ready ) return;
+      if( !spriteValue ) spriteValue = new ICS_Sprite();
+      waitIdle();
+      layerStack->flatten(); // stale static layers are rendered before the scratch sprite exists
+      spriteValue->setPsram( false );
+      valueAngle = angle;
+      valueRect  = valueBounds();
+      if( !valueShown ) { // needle frames now have to draw the overlay too
+        valueShown = true;
+        if( Needle ) Needle->onOverlay( renderOverlay, this );
+      }
+      clipRect_t absRect = { clipRect->x+valueRect.x, clipRect->y+valueRect.y, valueRect.w, valueRect.h };
+      if( dash ) {
+        dash->invalidate( widgetId, absRect );
+        return;
+      }
+      spriteValue->setColorDepth( gaugeSprite->getColorDepth() );
+
+      if( spriteValue->createSprite( valueRect.w, valueRect.h ) ) {
+        spriteValue->setClipRect( 0, 0, valueRect.w, valueRect.h );
+        spriteValue->fillSprite( cfg.palette->transparent_color ); // transparent gauges show the key color, as pushGauge() does
+        layerStack->compose( spriteValue, valueRect.x, valueRect.y );
+        spriteValue->pushSprite( cfg.display, absRect.x, absRect.y );
+        bus::record( absRect );
+        spriteValue->deleteSprite();
       }
     }
 
@@ -389,18 +656,35 @@ namespace LGFXMeter
 
     void Gauge_Class::setNeedle( float_t angle )
     {
+      timing::record( timing::INPUT_SET, angle );
       if( Needle ) Needle->setAngle( angle );
     }
 
 
+    void Gauge_Class::setNeedleSpring( uint32_t settle_ms )
+    {
+      timing::record( timing::INPUT_SPRING, 0.0f, settle_ms );
+      if( Needle ) Needle->useSpring( settle_ms );
+    }
+
+
+    void Gauge_Class::setNeedleEasing()
+    {
+      timing::record( timing::INPUT_EASING );
+      if( Needle ) Needle->useEasing();
+    }
+
+
     void Gauge_Class::easeNeedle( uint32_t timeout, easing::easingFunc_t _easingFunc )
     {
+      timing::record( timing::INPUT_EASE, 0.0f, timeout, timing::easingIndex( _easingFunc ) );
       if( Needle ) Needle->ease( timeout, _easingFunc );
     }
 
 
     void Gauge_Class::drawNeedle( float angle, bool render_value )
     {
+      timing::record( timing::INPUT_DRAW, angle, 0, render_value );
       if( Needle ) Needle->render( angle );
       if( render_value )  drawAngleValue( angle );
     }
@@ -408,6 +692,7 @@ namespace LGFXMeter
 
     void Gauge_Class::animateNeedle( float_t angle, bool render_value )
     {
+      timing::record( timing::INPUT_ANIMATE, angle, 0, render_value );
       if( Needle )
         Needle->animate( angle );
 
@@ -416,6 +701,69 @@ namespace LGFXMeter
       }
     }
 
+
+
+    // Dry run: compute the memory plan of a gauge config without allocating anything, every buffer
+    // allocated by the gauge is reported. Per-frame buffers (clip, push pipeline) are reported for
+    // their worst case (full gauge area), use push_mode for the mode later given to setPushMode().
+    gauge_report_t plan( gauge_cfg_t _cfg, pipeline::push_mode_t push_mode = pipeline::PUSH_SYNC )
+    {
+      gauge_report_t plan;
+      memory::resetReport( &plan, true );
+
+      const clipRect_t *clipRect = &_cfg.clipRect;
+      uint8_t canvas_depth = canvasBitDepth( _cfg );
+
+      if( !_cfg.dstCanvas ) {
+        memory::addAlloc( &plan, "canvas", memory::spriteBytes( clipRect->w, clipRect->h, canvas_depth ), memory::prefersPsram( memory::HEAT_WARM, _cfg.placement ), true, false, memory::HEAT_WARM );
+      } else {
+        canvas_depth = _cfg.dstCanvas->getColorDepth();
+      }
+
+      uint32_t snapshotBytes = memory::spriteBytes( clipRect->w, clipRect->h, canvas_depth );
+      if( keepsBackground( _cfg, snapshotBytes ) ) {
+        memory::addAlloc( &plan, "snapshot", snapshotBytes, memory::prefersPsram( memory::HEAT_COLD, _cfg.placement ), true, false, memory::HEAT_COLD );
+      }
+
+      if( _cfg.gauge.items && _cfg.gauge.items_count > 0 && _cfg.zoomAA > 0 ) {
+        uint32_t maskBytes = memory::spriteBytes( clipRect->w/_cfg.zoomAA, clipRect->h/_cfg.zoomAA, 4 );
+        memory::addAlloc( &plan, "mask", maskBytes, memory::prefersPsram( memory::HEAT_COLD, maskPlacement( _cfg ) ), true, true, memory::HEAT_COLD );
+        memory::addFree( &plan, maskBytes ); // discarded after rulers are drawn
+      }
+
+      const needle_cfg_t *needle = &_cfg.needle;
+      int32_t needleWidth  = needle->img ? needle->img->width  : needle->width;
+      int32_t needleHeight = needle->img ? needle->img->height : needle->height;
+      bool drop_shadow     = needle->drop_shadow && ( !needle->img || needle->shadow );
+
+      uint8_t needleDepth  = needle->img    ? ( needle->bit_depth ? needle->bit_depth : needle->img->bit_depth    ) : 4;
+      uint8_t shadowDepth  = needle->shadow ? ( needle->bit_depth ? needle->bit_depth : needle->shadow->bit_depth ) : 4;
+
+      bool hot_psram = memory::prefersPsram( memory::HEAT_HOT, _cfg.placement );
+      if( !frames::Needle_Frames( needle->frames ).valid() ) { // pre-rotated frames are read in place
+        memory::addAlloc( &plan, "needle", memory::spriteBytes( needleWidth, needleHeight, needleDepth ), hot_psram );
+        if( drop_shadow ) {
+          memory::addAlloc( &plan, "shadow", memory::spriteBytes( needleWidth, needleHeight, shadowDepth ), hot_psram );
+        }
+      }
+      uint32_t clipBytes = memory::spriteBytes( clipRect->w, clipRect->h, canvas_depth );
+      memory::addAlloc( &plan, "clip", clipBytes, needle->clip_psram || hot_psram, true, true );
+      memory::addFree( &plan, clipBytes ); // per-frame
+
+      uint32_t framesBytes = pipeline::Push_Pipeline::buffersBytes( push_mode, clipRect->w, clipRect->h, canvas_depth );
+      if( framesBytes ) { // DMA buffers are always in internal ram
+        memory::addAlloc( &plan, "frames", framesBytes, push_mode != pipeline::PUSH_DMA && hot_psram );
+      }
+
+      clipRect_t valueRect = valueBounds(); // angle value readout scratch, only with render_value
+      uint32_t valueBytes  = memory::spriteBytes( valueRect.w, valueRect.h, canvas_depth );
+      memory::addAlloc( &plan, "value", valueBytes, false, true, true );
+      memory::addFree( &plan, valueBytes );
+
+      return plan;
+    }
+
+
   }; // end namespace gauge
 
 
@@ -432,6 +780,11 @@ namespace LGFXMeter
     return gauge::cfg;
   }
 
+  gauge_report_t plan( gauge_cfg_t _cfg, pipeline::push_mode_t push_mode = pipeline::PUSH_SYNC )
+  {
+    return gauge::plan( _cfg, push_mode );
+  }
+
   // export class to local namespace
   using Gauge_Class = gauge::Gauge_Class;
 
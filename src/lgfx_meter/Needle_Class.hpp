@@ -32,6 +32,12 @@
 #pragma once
 
 #include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_memory.hpp"
+#include "lgfxmeter_timing.hpp"
+#include "lgfxmeter_pipeline.hpp"
+#include "lgfxmeter_layers.hpp"
+#include "lgfxmeter_frames.hpp"
 
 
 
@@ -66,27 +72,80 @@ namespace LGFXMeter
       .shadowOffX        = 0,   // px
       .shadowOffY        = 10,  // px
       .radius            = 1.0, // [0...1] needle radius, fraction of axis.y
-      .scaleX            = 1.0  // arrow hscale
+      .scaleX            = 1.0, // arrow hscale
+      .bit_depth         = 0,   // use image bit depth
+      .clip_psram        = false,
+      .placement         = PLACE_DEFAULT, // memory policy
+      .peak              = {
+        .enabled           = false,
+        .radius0           = 0.85, // fraction of axis.y
+        .radius1           = 0.95,
+        .width             = 2,    // px
+        .color             = 0xff2222U,
+        .hold_ms           = 1000,
+        .decay             = 20.0  // degrees per second
+      },
+      .frames            = nullptr  // rotate img at runtime
     };
 
     needle_cfg_t config() { return cfg; }
 
 
+    // display area to recomposite
+    typedef void (*dirtyCallback_t)( clipRect_t rect, void *ctx );
+
+
+    enum motion_t
+    {
+      MOTION_EASING, // setAngle() restarts an easing curve of fixed duration
+      MOTION_SPRING  // setAngle() retargets a critically damped spring
+    };
+
+    // 99% of the distance is covered when omega*t reaches this value
+    const float settle_omega_t = 6.638f;
+
+    // critically damped spring, integrated with the exact solution so any frame interval is stable
+    struct spring_t
+    {
+      float omega;    // natural frequency, rad/s
+      float position; // degrees
+      float velocity; // degrees/s
+      float target;   // degrees
+
+      void step( float dt )
+      {
+        float x0  = position - target;
+        float e   = expf( -omega*dt );
+        float tmp = ( velocity + omega*x0 ) * dt;
+        position  = target + ( x0 + tmp ) * e;
+        velocity  = ( velocity - omega*tmp ) * e;
+      }
+    };
+
+
+
     class Needle_Class
     {
     public:
 
-      Needle_Class( needle_cfg_t _cfg )
+      Needle_Class( needle_cfg_t _cfg, gauge_report_t *_report = nullptr )
       {
         assert( _cfg.gaugeSprite );
         assert( _cfg.display );
         cfg          = _cfg;
+        report       = _report;
         display      = cfg.display;
         gaugeSprite  = cfg.gaugeSprite;
         lastAngle    = cfg.start;
         createNeedle();
       };
 
+      ~Needle_Class() { deleteSprites(); }
+
+      // owns its sprites
+      Needle_Class( const Needle_Class& ) = delete;
+      Needle_Class& operator=( const Needle_Class& ) = delete;
+
       easingFunc_t easingFunc = easing::easeInOutQuart;
 
       void render( float angle );
@@ -95,6 +154,21 @@ namespace LGFXMeter
       void createNeedle( bool prune = false );
       void setAngle( float_t angle );
       void ease( uint32_t duration = 300, easingFunc_t _easingFunc=easing::easeInOutQuart );
+      void useSpring( uint32_t settle_ms = 300 );
+      void useEasing() { motion = MOTION_EASING; }
+      bool moving() { return motion == MOTION_SPRING ? springMoving : animationElapsed < animationDuration; }
+      void setClock( clockFunc_t _clockFunc ) { clockFunc = _clockFunc ? _clockFunc : timing::systemClock; }
+      void setPipeline( pipeline::Push_Pipeline *_pusher ) { pusher = _pusher; }
+      // largest frame when the needle moves by up to `motion` degrees between two frames, see Push_Pipeline
+      void getMaxFrame( int32_t *w, int32_t *h, float motion = 10.0f );
+      // compositor mode: render() only reports the dirty rect, the compositor calls drawTo()
+      void onDirty( dirtyCallback_t cb, void *ctx = nullptr ) { dirtyCallback = cb; dirtyCtx = ctx; }
+      void drawTo( LovyanGFX *dst, int32_t originX, int32_t originY );
+      // rendered over the needle in every frame, originX/originY relative to cfg.clipRect
+      void onOverlay( layers::layerRender_t cb, void *ctx = nullptr ) { overlay = cb; overlayCtx = ctx; }
+      // peak-hold marker, see cfg.peak
+      void resetPeak() { peakSet = false; }
+      float getPeak() { return peakAngle; }
 
     private:
 
@@ -104,19 +178,61 @@ namespace LGFXMeter
       ICS_Sprite  *shadowSprite = nullptr;
       ICS_Sprite  *gaugeSprite  = nullptr;
 
+      frames::Needle_Frames preRotated; // replaces needle/shadow sprites when cfg.frames is valid
+
+      gauge_report_t *report    = nullptr; // optional construction report
+
+      pipeline::Push_Pipeline *pusher = nullptr; // optional frame pipeline, owned by the gauge
+
+      dirtyCallback_t dirtyCallback = nullptr;   // optional compositor
+      void            *dirtyCtx     = nullptr;
+      float           composedAngle = 0;         // lgfx angle of the last render(), used by drawTo()
+
+      layers::layerRender_t overlay = nullptr;   // optional overlay layer
+      void            *overlayCtx   = nullptr;
+
+      // peak-hold marker
+      float      peakAngle     = 0;   // absolute angle
+      uint32_t   peakSince     = 0;   // hold start
+      uint32_t   peakStep      = 0;   // last updatePeak() call
+      bool       peakSet       = false;
+      float      drawnPeak     = 0;   // marker angle in the last frame
+      bool       peakDrawn     = false;
+      float      peakNeedle    = 0;   // needle angle of the last updatePeak() call
+      bool       peakOnly      = false; // render() called for the marker only
+      void       refreshPeak( float absangle );
+      clipRect_t peakClip      = {0,0,0,0}; // marker footprint in the last frame
+      bool       updatePeak( float absangle, clipRect_t *dirty );
+      void       getPeakEnds( float absangle, float *x0, float *y0, float *x1, float *y1 );
+      clipRect_t getPeakBoundingRect( float absangle );
+      void       drawPeak( LovyanGFX *dst, int32_t dst_x, int32_t dst_y );
+
       bool _has_rendered = false;
       bool _ready        = false;
       bool _debug        = false;
 
 
+      // time source, injectable for deterministic replays
+      clockFunc_t clockFunc = timing::systemClock;
+      uint32_t now();
+
       // easing helpers
       uint32_t animationDuration = 300;
-      uint32_t animationStart    = millis();
+      uint32_t animationStart    = 0;
       uint32_t animationElapsed  = 0;
       uint32_t animationFrames   = 0;
       float    destAngle         = 0;
       float    tripAngle         = 0;
 
+      // spring helpers
+      motion_t motion            = MOTION_EASING;
+      spring_t spring            = { 0, 0, 0, 0 };
+      uint32_t springLast        = 0;     // last step time
+      bool     springMoving      = false;
+      float    pixelAngle        = 1.0f;  // angle covered by one pixel at the needle tip
+      float    renderedAngle     = 0;     // last angle sent to render()
+      void     springStep();
+
 
       uint16_t xMiddle; // for pivot
       int32_t shadowOffX, shadowOffY; // shadow offset
@@ -127,26 +243,36 @@ namespace LGFXMeter
 
       float lastAngle = 0;//-45.0f;
 
+      bool createClip( int32_t w, int32_t h );
+      void deleteSprites(); // clip, needle and shadow
+      uint8_t needleBitDepth( const image_t *img ) { return img ? ( cfg.bit_depth ? cfg.bit_depth : img->bit_depth ) : 4; }
       clipRect_t getArrowBoundingRect( coord_t *pt_high, coord_t *pt_low, coord_t *pt_axis, float angle );
+      clipRect_t needleClip( float absangle ); // needle + shadow bounds, relative to cfg.clipRect
       void pushNeedle(LovyanGFX* dst, float dst_x, float dst_y, float angle, float zoom_x, float zoom_y, uint32_t transparent_color );
 
     };
 
 
 
-    void Needle_Class::createNeedle( bool prune )
+    void Needle_Class::deleteSprites()
     {
-      if( prune ) {
-        if( clipSprite )   { clipSprite->deleteSprite();   clipSprite = nullptr; }
-        if( needleSprite ) { needleSprite->deleteSprite(); needleSprite = nullptr; }
-        if( shadowSprite ) { shadowSprite->deleteSprite(); shadowSprite = nullptr; }
+      ICS_Sprite **sprites[] = { &clipSprite, &needleSprite, &shadowSprite };
+      for( auto sprite : sprites ) {
+        if( !*sprite ) continue;
+        (*sprite)->deleteSprite();
+        delete *sprite;
+        *sprite = nullptr;
       }
+    }
+
+
+    void Needle_Class::createNeedle( bool prune )
+    {
+      if( prune ) deleteSprites();
 
       if( ! clipSprite ) {
         clipSprite = new ICS_Sprite( display );
         clipSprite->setColorDepth( gaugeSprite->getColorDepth() );
-        // psram sprites are slow, force dram use
-        clipSprite->setPsram( false );
       }
 
       if( cfg.img ) {
@@ -156,14 +282,21 @@ namespace LGFXMeter
 
       xMiddle = cfg.width/2; // pointy end horizontal pos
 
-      if( !needleSprite ) {
+      if( cfg.frames && !preRotated.valid() ) {
+        preRotated = frames::Needle_Frames( cfg.frames );
+        if( !preRotated.valid() ) log_e("Falling back to runtime rotation");
+      }
+      if( preRotated.valid() ) {
+        cfg.drop_shadow = false; // baked in the frames, if any
+      }
 
-        needleSprite = new ICS_Sprite( display );
-        needleSprite->setColorDepth( cfg.img ? cfg.img->bit_depth : 4 );
-        // psram sprites are slow, force dram use, the sprite is small anyway
-        needleSprite->setPsram( false );
+      if( !needleSprite && !preRotated.valid() ) {
 
-        if( ! needleSprite->createSprite( cfg.width, cfg.height ) ) {
+        needleSprite = new ICS_Sprite( display );
+        needleSprite->setColorDepth( needleBitDepth( cfg.img ) );
+        // psram sprites are slow, the needle is rotated on every frame, the sprite is small anyway
+        bool needle_created = memory::createSprite( needleSprite, cfg.width, cfg.height, memory::HEAT_HOT, "needle", report, false, cfg.placement );
+        if( ! needle_created ) {
           log_e("Unable to create needle sprite :(");
           return;
         }
@@ -180,7 +313,12 @@ namespace LGFXMeter
           }
 
           needleSprite->fillSprite( cfg.transparent_color );
-          drawImage( needleSprite, cfg.img, 0, 1, cfg.width, cfg.height );
+          uint8_t packed_flags = 0;
+          if( loadPacked( needleSprite, cfg.img, 1, &packed_flags ) ) { // same depth: indexes copied as is
+            if( packed_flags & PACKED_TRANSPARENT ) needleSprite->setPaletteColor( 0, cfg.transparent_color );
+          } else {
+            drawImage( needleSprite, cfg.img, 0, 1, cfg.width, cfg.height );
+          }
 
         } else {
 
@@ -208,21 +346,22 @@ namespace LGFXMeter
         }
       }
 
+      if( !needleSprite && !preRotated.valid() ) return;
+
       // set pivot at bottom center of the sprite
-      needleSprite->setPivot( needleSprite->width()/2, needleSprite->height() );
-      if( _debug ) needleSprite->drawRect( 0,0, needleSprite->width(), needleSprite->height(), cfg.shadow_color );
+      if( needleSprite ) needleSprite->setPivot( needleSprite->width()/2, needleSprite->height() );
+      if( _debug && needleSprite ) needleSprite->drawRect( 0,0, needleSprite->width(), needleSprite->height(), cfg.shadow_color );
 
       if( cfg.drop_shadow ) {
 
         shadowOffX = cfg.shadowOffX;
         shadowOffY = cfg.shadowOffY;
 
-        shadowSprite = new ICS_Sprite( display );
-        shadowSprite->setColorDepth( cfg.shadow ? cfg.shadow->bit_depth : 4 );
-        // psram sprites are slow, force dram use, the sprite is small anyway
-        shadowSprite->setPsram( false );
-
-        if( ! shadowSprite->createSprite( cfg.width, cfg.height ) ) {
+        if( !shadowSprite ) shadowSprite = new ICS_Sprite( display );
+        shadowSprite->setColorDepth( needleBitDepth( cfg.shadow ) );
+        // same as needle
+        bool shadow_created = memory::createSprite( shadowSprite, cfg.width, cfg.height, memory::HEAT_HOT, "shadow", report, false, cfg.placement );
+        if( ! shadow_created ) {
           log_e("Unable to create shadow sprite, disabling drop shadow");
           cfg.drop_shadow = false;
         } else {
@@ -233,7 +372,12 @@ namespace LGFXMeter
 
           if( cfg.shadow ) { // shadow image was provided
             shadowSprite->fillSprite( cfg.transparent_color );
-            drawImage( shadowSprite, cfg.shadow, 0, 1, cfg.width, cfg.height );
+            uint8_t packed_flags = 0;
+            if( loadPacked( shadowSprite, cfg.shadow, 1, &packed_flags ) ) {
+              if( packed_flags & PACKED_TRANSPARENT ) shadowSprite->setPaletteColor( 0, cfg.transparent_color );
+            } else {
+              drawImage( shadowSprite, cfg.shadow, 0, 1, cfg.width, cfg.height );
+            }
           } else { // copy needle image with palette forced to shadow_color
             needleSprite->pushSprite( shadowSprite, 0, 0 );
           }
@@ -251,7 +395,9 @@ namespace LGFXMeter
       yhigh = cfg.radius *cfg.axis.y;
 
       scaleX = cfg.scaleX;
-      scaleY = float(yhigh)/float(needleSprite->height()); // match half needle size to radius size
+      scaleY = needleSprite ? float(yhigh)/float(needleSprite->height()) : 1.0f; // match half needle size to radius size, frames are pre-scaled
+
+      pixelAngle = yhigh > 0 ? 1.0f/(yhigh*deg2rad) : 1.0f;
 
       log_d("\nNeedle CFG:\n\taxis=[%d:%d]\n\tclipRect=[%d:%d %d*%d]\n\tspan=[%d..%d]\n\tscale=[%.2f*%.2f]\n\tshadow: %s",
         cfg.axis.x,
@@ -264,7 +410,7 @@ namespace LGFXMeter
         yhigh,
         scaleX,
         scaleY,
-        cfg.drop_shadow?(cfg.shadow?"img":"true"):"false"
+        preRotated.valid() ? ( preRotated.hasShadow() ? "frames" : "false" ) : cfg.drop_shadow?(cfg.shadow?"img":"true"):"false"
       );
 
       _ready = true;
@@ -272,8 +418,54 @@ namespace LGFXMeter
 
 
 
+    uint32_t Needle_Class::now()
+    {
+      uint32_t t = clockFunc();
+      timing::record( timing::INPUT_CLOCK, 0.0f, t );
+      return t;
+    }
+
+
+
+    // per-frame clip buffer: hot by nature, unless explicitely sent to psram
+    bool Needle_Class::createClip( int32_t w, int32_t h )
+    {
+      if( cfg.clip_psram && psramInit() ) {
+        clipSprite->setPsram( true );
+        if( clipSprite->createSprite( w, h ) ) return true;
+      }
+      return memory::createSprite( clipSprite, w, h, memory::HEAT_HOT, nullptr, nullptr, false, cfg.placement );
+    }
+
+
+
+    // VU ballistics: ~300ms to reach 99% of the value without overshoot
+    void Needle_Class::useSpring( uint32_t settle_ms )
+    {
+      motion          = MOTION_SPRING;
+      spring.omega    = settle_omega_t * 1000.0f / float( settle_ms > 0 ? settle_ms : 1 );
+      spring.position = lastAngle;
+      spring.target   = lastAngle;
+      spring.velocity = 0;
+      springMoving    = false;
+      renderedAngle   = lastAngle;
+    }
+
+
+
     void Needle_Class::setAngle( float_t angle )
     {
+      if( motion == MOTION_SPRING ) {
+        // retarget without restarting, the current velocity is kept
+        if( angle == spring.target ) return;
+        spring.target = angle;
+        if( !springMoving ) {
+          springLast   = now();
+          springMoving = true;
+        }
+        return;
+      }
+
       if( angle == destAngle ) return;
 
       if( animationElapsed < animationDuration ) {
@@ -284,7 +476,7 @@ namespace LGFXMeter
       }
 
       destAngle         = angle;
-      animationStart    = millis();
+      animationStart    = now();
       animationElapsed  = 0;
       animationFrames   = 0;
     }
@@ -294,10 +486,16 @@ namespace LGFXMeter
       if( timeout > 0 ) animationDuration = timeout;
       if( !_ready ) return;
 
+      if( motion == MOTION_SPRING ) {
+        springStep();
+        return;
+      }
+
       easingFunc = _easingFunc;
 
       if( animationElapsed >= animationDuration ) {
         lastAngle = destAngle;
+        refreshPeak( destAngle );
         return;
       }
 
@@ -318,16 +516,52 @@ namespace LGFXMeter
 
       render( tripAngle );
       animationFrames++;
-      animationElapsed = millis() - animationStart;
+      animationElapsed = now() - animationStart;
+    }
+
+
+    void Needle_Class::springStep()
+    {
+      if( !springMoving ) { // settled, no frame needed unless the peak marker falls
+        refreshPeak( spring.position );
+        return;
+      }
+
+      uint32_t t = now();
+      spring.step( float(t - springLast) / 1000.0f );
+      springLast = t;
+
+      // settled when within a pixel and moving less than a pixel per 50ms
+      if( fabsf( spring.position - spring.target ) < pixelAngle && fabsf( spring.velocity ) * 0.05f < pixelAngle ) {
+        spring.position = spring.target;
+        spring.velocity = 0;
+        springMoving    = false;
+      }
+
+      lastAngle = spring.position;
+
+      // sub-pixel moves are not worth a frame
+      if( !springMoving || fabsf( spring.position - renderedAngle ) >= pixelAngle ) {
+        renderedAngle = spring.position;
+        render( spring.position );
+        animationFrames++;
+      }
     }
 
 
+
     void Needle_Class::animate( float_t angle, uint32_t duration )
     {
+      if( motion == MOTION_SPRING ) {
+        setAngle( angle );
+        while( springMoving ) springStep();
+        return;
+      }
+
       if( angle == lastAngle ) return;
 
       animationDuration = duration;
-      animationStart    = millis();
+      animationStart    = now();
       animationElapsed  = 0;
       animationFrames   = 0;
       destAngle         = angle;
@@ -336,7 +570,7 @@ namespace LGFXMeter
         ease( animationDuration );
       }
 
-      uint32_t animationEnd = millis();
+      uint32_t animationEnd = now();
       uint32_t totalAnimationDuration = animationEnd-animationStart;
       float fps = float(animationFrames)/float(totalAnimationDuration) * 1000.0;
       log_d("[%+06.2f=>%+06.2f]@[%3d:%-3d][%3d*%-3d] %d frames in %d ms (=%.2f fps)", lastAngle, angle, lastclipRect.x, lastclipRect.y, lastclipRect.w, lastclipRect.h, animationFrames, totalAnimationDuration, fps );
@@ -347,19 +581,15 @@ namespace LGFXMeter
 
 
 
-    void Needle_Class::render( float absangle )
+    clipRect_t Needle_Class::needleClip( float absangle )
     {
-      if( !_ready ) return;
-
-      float angle            = -cfg.start - absangle; // translate to relative
-      coord_t pt_high        = {0, yhigh};
-      coord_t pt_low         = {0, ylow};
+      float angle     = -cfg.start - absangle; // translate to relative
+      coord_t pt_high = {0, yhigh};
+      coord_t pt_low  = {0, ylow};
 
-      int32_t x              = cfg.axis.x;
-      int32_t y              = cfg.axis.y;
-
-      // calculate clip rect for the needle
-      clipRect_t currentClip = getArrowBoundingRect( &pt_high, &pt_low, &cfg.axis, angle );
+      clipRect_t clip = preRotated.valid()
+        ? preRotated.bounds( preRotated.index( 360-angle ), cfg.axis.x, cfg.axis.y ) // exact frame bounds, shadow included
+        : getArrowBoundingRect( &pt_high, &pt_low, &cfg.axis, angle );
 
       if( cfg.drop_shadow ) {
         // extend clipRect accordingly
@@ -367,8 +597,38 @@ namespace LGFXMeter
         shadow_axis.x += shadowOffX;
         shadow_axis.y += shadowOffY;
         clipRect_t shadowClip = getArrowBoundingRect( &pt_high, &pt_low, &shadow_axis, angle );
-        currentClip = getBoundingRect( currentClip, shadowClip );
+        clip = getBoundingRect( clip, shadowClip );
+      }
+      return clip;
+    }
+
+
+    void Needle_Class::getMaxFrame( int32_t *w, int32_t *h, float motion )
+    {
+      *w = *h = 0;
+      float lo = min( cfg.start, cfg.end ), hi = max( cfg.start, cfg.end );
+      for( float a=lo; a<=hi; a+=1.0f ) {
+        float b = min( a+motion, hi );
+        clipRect_t frame = getBoundingRect( needleClip( a ), needleClip( b ) );
+        if( cfg.peak.enabled ) frame = getBoundingRect( frame, getBoundingRect( getPeakBoundingRect( a ), getPeakBoundingRect( b ) ) );
+        frame = constrainClipRect( frame, { 0, 0, cfg.clipRect.w, cfg.clipRect.h } );
+        *w = max( *w, frame.w );
+        *h = max( *h, frame.h );
       }
+    }
+
+
+    void Needle_Class::render( float absangle )
+    {
+      if( !_ready ) return;
+
+      float angle            = -cfg.start - absangle; // translate to relative
+
+      int32_t x              = cfg.axis.x;
+      int32_t y              = cfg.axis.y;
+
+      // calculate clip rect for the needle
+      clipRect_t currentClip = needleClip( absangle );
 
       if( !_has_rendered ) {
         // avoid clipping with null coords on first render
@@ -377,6 +637,16 @@ namespace LGFXMeter
       }
 
       clipRect_t mergedClip = getBoundingRect( currentClip, lastclipRect );
+
+      // a moving peak marker is cleared + redrawn in the same frame
+      clipRect_t peakDirty;
+      bool peakMoved = updatePeak( absangle, &peakDirty );
+      if( peakOnly ) { // needle at rest: only the marker footprint, the needle is redrawn where it overlaps
+        if( !peakMoved ) return;
+        mergedClip = peakDirty;
+      } else if( peakMoved ) {
+        mergedClip = getBoundingRect( mergedClip, peakDirty );
+      }
       // constrain clip height to draw zone
       //mergedClip.h = (mergedClip.y+mergedClip.h < y) ? mergedClip.h : mergedClip.h-( mergedClip.y - y );
 
@@ -401,14 +671,38 @@ namespace LGFXMeter
 
       angle = 360-(angle/*+cfg.angleOffset*/); // translate to lgfx pivot/rotate defaults
 
-      // test if last and current clip overlap
-      if( !inRange( currentClip.x, currentClip.x+currentClip.w, lastclipRect.x )
+      composedAngle = angle;
+
+      if( dirtyCallback ) { // composited: report the area, drawTo() will be called
+        dirtyCallback( absClip, dirtyCtx );
+        lastclipRect = currentClip;
+        return;
+      }
+
+      if( pusher ) { // pipelined: clear + draw in a frame buffer, the pipeline does the push
+        ICS_Sprite *frame = pusher->acquire( absClip.w, absClip.h );
+        if( frame ) {
+          gaugeSprite->pushSprite( frame, cfg.clipRect.x-absClip.x, cfg.clipRect.y-absClip.y );
+          drawPeak( frame, cfg.clipRect.x-absClip.x, cfg.clipRect.y-absClip.y );
+          pushNeedle( frame, relClip.x, relClip.y, angle, scaleX, scaleY, cfg.transparent_color );
+          if( overlay ) overlay( frame, absClip.x-cfg.clipRect.x, absClip.y-cfg.clipRect.y, overlayCtx );
+          if( _debug ) frame->drawRect( 0, 0, frame->width(), frame->height(), TFT_BLACK );
+          pusher->submit( absClip );
+          lastclipRect = currentClip;
+          return;
+        }
+        // not enough memory for a frame buffer, render synchronously
+        pusher->waitIdle();
+      }
+
+      // test if last and current clip overlap, overlay and peak marker need the single sprite path
+      if( !overlay && !cfg.peak.enabled && !inRange( currentClip.x, currentClip.x+currentClip.w, lastclipRect.x )
       && !inRange( lastclipRect.x, lastclipRect.x+lastclipRect.w, currentClip.x ) ) {
         // no overlapping, two zones need redraw
-        sprite_needle = clipSprite->createSprite( currentClip.w, currentClip.h );
+        sprite_needle = createClip( currentClip.w, currentClip.h );
       } else {
         // overlapping, will create a sprite to clear last needle then draw the new needle
-        merge_render = clipSprite->createSprite( absClip.w, absClip.h );
+        merge_render = createClip( absClip.w, absClip.h );
       }
 
       if( merge_render ) { // clear + draw needle in a single sprite
@@ -416,18 +710,22 @@ namespace LGFXMeter
         display->setClipRect( absClip.x, absClip.y, absClip.w, absClip.h );
         // restore to background
         gaugeSprite->pushSprite( clipSprite, cfg.clipRect.x-absClip.x, cfg.clipRect.y-absClip.y );
+        drawPeak( clipSprite, cfg.clipRect.x-absClip.x, cfg.clipRect.y-absClip.y );
         // draw needle
         pushNeedle( clipSprite, relClip.x, relClip.y, angle, scaleX, scaleY, cfg.transparent_color );
+        if( overlay ) overlay( clipSprite, absClip.x-cfg.clipRect.x, absClip.y-cfg.clipRect.y, overlayCtx );
         // DEBUG
         if( _debug ) clipSprite->drawRect( 0, 0, clipSprite->width(),clipSprite->height(), TFT_BLACK );
         clipSprite->pushSprite(  absClip.x, absClip.y );
+        bus::record( absClip );
         clipSprite->deleteSprite();
 
       } else {
 
         // clear last needle
-        display->setClipRect( lastclipRect.x+cfg.clipRect.x, lastclipRect.y+cfg.clipRect.y, lastclipRect.w, lastclipRect.h );
-        gaugeSprite->pushSprite( display, cfg.clipRect.x, cfg.clipRect.y );
+        clipRect_t clearClip = { lastclipRect.x+cfg.clipRect.x, lastclipRect.y+cfg.clipRect.y, lastclipRect.w, lastclipRect.h };
+        restoreRect( display, gaugeSprite, cfg.clipRect.x, cfg.clipRect.y, clearClip );
+        bus::record( constrainClipRect( clearClip, cfg.clipRect ) );
 
         // draw new needle
         display->setClipRect( currentClip.x, cfg.clipRect.y, currentClip.w, cfg.clipRect.h );
@@ -437,11 +735,15 @@ namespace LGFXMeter
           clipSprite->fillSprite( cfg.transparent_color );
           pushNeedle( clipSprite, x - currentClip.x + cfg.clipRect.x, y - currentClip.y + cfg.clipRect.y, angle, scaleX, scaleY, cfg.transparent_color );
           clipSprite->pushSprite(  currentClip.x, currentClip.y, cfg.transparent_color );
+          // transparent pixels split the window, count one transaction per scanline
+          bus::record( constrainClipRect( currentClip, { currentClip.x, cfg.clipRect.y, currentClip.w, cfg.clipRect.h } ), currentClip.h );
           clipSprite->deleteSprite();
 
         } else { // duh! not enough memory to use a sprite, antialias will blend to default black from TFT :(
 
           pushNeedle( display, x+cfg.clipRect.x, y+cfg.clipRect.y, angle, scaleX, scaleY, cfg.transparent_color );
+          // direct AA drawing, approximated as one transaction per scanline
+          bus::record( { currentClip.x, cfg.clipRect.y, currentClip.w, cfg.clipRect.h }, cfg.clipRect.h );
 
         }
       }
@@ -452,8 +754,102 @@ namespace LGFXMeter
 
 
 
+    void Needle_Class::drawTo( LovyanGFX *dst, int32_t originX, int32_t originY )
+    {
+      if( !_ready || !_has_rendered ) return;
+      drawPeak( dst, cfg.clipRect.x - originX, cfg.clipRect.y - originY );
+      pushNeedle( dst, cfg.axis.x + cfg.clipRect.x - originX, cfg.axis.y + cfg.clipRect.y - originY, composedAngle, scaleX, scaleY, cfg.transparent_color );
+    }
+
+
+
+    // hold then decay toward the needle, true when the marker has to be redrawn
+    bool Needle_Class::updatePeak( float absangle, clipRect_t *dirty )
+    {
+      if( !cfg.peak.enabled ) return false;
+      uint32_t t = now();
+      float dir  = cfg.end >= cfg.start ? 1.0f : -1.0f; // peak is toward cfg.end
+      if( !peakSet || ( absangle - peakAngle )*dir >= 0 ) {
+        peakAngle = absangle;
+        peakSince = t;
+        peakSet   = true;
+      } else {
+        uint32_t decayStart = peakSince + cfg.peak.hold_ms;
+        if( int32_t( t - decayStart ) > 0 ) {
+          uint32_t from = int32_t( peakStep - decayStart ) > 0 ? peakStep : decayStart;
+          peakAngle -= dir * cfg.peak.decay * ( t - from ) / 1000.0f;
+          if( ( peakAngle - absangle )*dir < 0 ) peakAngle = absangle;
+        }
+      }
+      peakStep   = t;
+      peakNeedle = absangle;
+
+      // redraw when the outer end moved by half a pixel
+      float pxPerDegree = cfg.peak.radius1*cfg.axis.y*deg2rad;
+      if( peakDrawn && fabsf( peakAngle - drawnPeak )*pxPerDegree < 0.5f ) return false;
+
+      clipRect_t rect = getPeakBoundingRect( peakAngle );
+      *dirty    = peakDrawn ? getBoundingRect( peakClip, rect ) : rect;
+      peakClip  = rect;
+      drawnPeak = peakAngle;
+      peakDrawn = true;
+      return true;
+    }
+
+
+    // needle at rest: a frame only when the falling marker moved
+    void Needle_Class::refreshPeak( float absangle )
+    {
+      if( !cfg.peak.enabled || !peakSet || peakAngle == peakNeedle ) return;
+      peakOnly = true;
+      render( absangle );
+      peakOnly = false;
+    }
+
+
+    // marker ends, relative to cfg.clipRect
+    void Needle_Class::getPeakEnds( float absangle, float *x0, float *y0, float *x1, float *y1 )
+    {
+      float angle = ( -cfg.start - absangle )*deg2rad; // same rotation as the needle
+      float r0    = cfg.peak.radius0*cfg.axis.y;
+      float r1    = cfg.peak.radius1*cfg.axis.y;
+      // coord_rotate() of {0,r} then axis translation
+      *x0 = cfg.axis.x - r0*sinf( angle );
+      *y0 = cfg.axis.y - r0*cosf( angle );
+      *x1 = cfg.axis.x - r1*sinf( angle );
+      *y1 = cfg.axis.y - r1*cosf( angle );
+    }
+
+
+    clipRect_t Needle_Class::getPeakBoundingRect( float absangle )
+    {
+      float x0, y0, x1, y1;
+      getPeakEnds( absangle, &x0, &y0, &x1, &y1 );
+      float pad = cfg.peak.width/2 + 1; // + 1px antialias
+      int32_t left   = floorf( min( x0, x1 ) - pad );
+      int32_t top    = floorf( min( y0, y1 ) - pad );
+      int32_t right  = ceilf( max( x0, x1 ) + pad );
+      int32_t bottom = ceilf( max( y0, y1 ) + pad );
+      return { left, top, right-left, bottom-top };
+    }
+
+
+    // dst_x/dst_y: cfg.clipRect origin in dst
+    void Needle_Class::drawPeak( LovyanGFX *dst, int32_t dst_x, int32_t dst_y )
+    {
+      if( !cfg.peak.enabled || !peakDrawn ) return;
+      float x0, y0, x1, y1;
+      getPeakEnds( drawnPeak, &x0, &y0, &x1, &y1 );
+      dst->drawWideLine( dst_x+x0, dst_y+y0, dst_x+x1, dst_y+y1, cfg.peak.width/2, cfg.peak.color );
+    }
+
+
     void Needle_Class::pushNeedle(LovyanGFX* dst, float dst_x, float dst_y, float angle, float zoom_x, float zoom_y, uint32_t transparent_color )
     {
+      if( preRotated.valid() ) { // span blit, no rotation
+        preRotated.blit( dst, roundf(dst_x), roundf(dst_y), preRotated.index( angle ) );
+        return;
+      }
       if( cfg.drop_shadow ) shadowSprite->pushRotateZoomWithAA(dst, dst_x+shadowOffX, dst_y+shadowOffY, angle, zoom_x, zoom_y, transparent_color  );
       needleSprite->pushRotateZoomWithAA(dst, dst_x, dst_y, angle, zoom_x, zoom_y, transparent_color  );
     }
@@ -0,0 +1,349 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <string.h>
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_memory.hpp"
+#include "lgfxmeter_layers.hpp"
+#include "Dashboard_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+
+  namespace readout
+  {
+
+    using namespace utils;
+
+    readout_cfg_t cfg =
+    {
+      .display    = nullptr,
+      .pos        = {0,0},
+      .cells      = 5,
+      .font       = &fonts::Font7, // seven segment
+      .fontSize   = 1.0f,
+      .charset    = "0123456789.-",
+      .bgSprite   = nullptr,
+      .bgPos      = {0,0},
+      .bg_color   = 0x000000U,
+      .text_color = 0xffffffU,
+      .bit_depth  = 16
+    };
+
+    readout_cfg_t config() { return cfg; }
+
+    const uint8_t max_cells = 16;
+
+
+   /*
+    * Numeric readout.
+    *
+    * Every glyph of the charset is rendered once in an atlas, one fixed size cell per glyph.
+    * Over a solid background the atlas holds the final pixels and a changed cell is a single
+    * clipped blit. Over a background sprite the atlas is 1bpp, a changed cell is restored from
+    * the background in a retained cell sprite, the glyph is blitted with transparency and the
+    * cell is pushed. Unchanged cells are not sent.
+    *
+    *   readout_cfg_t rcfg = readout::config();
+    *   rcfg.display  = &M5.Display;
+    *   rcfg.pos      = { 120, 100 };
+    *   rcfg.bgSprite = ICSGauge->getGaugeSprite(); // over the gauge face
+    *   rcfg.bgPos    = { gaugeX, gaugeY };
+    *   Readout_Class *swr = new Readout_Class( rcfg );
+    *   swr->setValue( 1.5, 1 ); // "  1.5"
+    *
+    */
+
+    class Readout_Class
+    {
+    public:
+
+      Readout_Class( readout_cfg_t _cfg = readout::cfg )
+      {
+        assert( _cfg.display );
+        cfg = _cfg;
+        if( cfg.cells > max_cells ) cfg.cells = max_cells;
+        memset( drawn, 0, sizeof(drawn) );
+        memset( text, ' ', sizeof(text) );
+        _ready = createAtlas();
+      };
+
+      ~Readout_Class()
+      {
+        if( dash ) dash->removeWidget( widgetId );
+        if( atlas ) { atlas->deleteSprite(); delete atlas; }
+        if( cell )  { cell->deleteSprite();  delete cell; }
+      }
+
+      bool ready() { return _ready; }
+
+      // right aligned, truncated to the last cfg.cells characters
+      void setText( const char *str );
+      void setValue( float value, uint8_t decimals = 1 );
+      // push every cell, e.g. after the background was pushed again
+      void pushReadout();
+      clipRect_t getRect() { return { cfg.pos.x, cfg.pos.y, cellW*cfg.cells, cellH }; }
+      // let a dashboard composite the cells instead of pushing them, over the widgets added before
+      void attach( dashboard::Dashboard_Class *_dash );
+
+      // drawn in the cell sprite between the background and the glyph, e.g. the gauge needle:
+      // origin is relative to cfg.bgPos, see layers::layerRender_t
+      void setUnderlay( layers::layerRender_t render, void *ctx = nullptr ) { underlay = render; underlayCtx = ctx; }
+      // all the cells in dst, dst (0,0) is at originX/originY in the output media
+      void drawTo( LovyanGFX *dst, int32_t originX, int32_t originY );
+      // layers::layerRender_t adapter, origin relative to cfg.bgPos (e.g. Gauge_Class::setOverlay())
+      static void renderOverlay( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    private:
+
+      readout_cfg_t cfg;
+      ICS_Sprite *atlas = nullptr; // glyphs stacked vertically, cellH apart
+      ICS_Sprite *cell  = nullptr; // retained cell buffer, background sprite mode only
+      int32_t    cellW = 0, cellH = 0;
+      size_t     glyphs = 0;
+      bool       transparent = false; // 1bpp atlas blitted over the background
+
+      layers::layerRender_t underlay = nullptr;
+      void       *underlayCtx = nullptr;
+
+      char       text[max_cells];  // requested
+      char       drawn[max_cells]; // on screen, 0 = unknown
+      bool       _ready = false;
+
+      dashboard::Dashboard_Class *dash = nullptr;
+      int8_t     widgetId = -1;
+
+      bool createAtlas();
+      int  glyphIndex( char c );
+      void drawCell( uint8_t idx );
+      void blitGlyph( LovyanGFX *dst, int32_t x, int32_t y, int glyph );
+      static void compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    };
+
+
+    bool Readout_Class::createAtlas()
+    {
+      if( !cfg.charset || !cfg.font ) return false;
+      glyphs      = strlen( cfg.charset );
+      transparent = cfg.bgSprite != nullptr;
+      atlas = new ICS_Sprite( cfg.display );
+      atlas->setColorDepth( transparent ? 1 : cfg.bit_depth );
+      atlas->setFont( cfg.font );
+      atlas->setTextSize( cfg.fontSize );
+      // fixed cell: widest glyph x font height
+      char glyph[2] = {0,0};
+      for( size_t i=0; i<glyphs; i++ ) {
+        glyph[0] = cfg.charset[i];
+        int32_t w = atlas->textWidth( glyph );
+        if( w > cellW ) cellW = w;
+      }
+      cellH = atlas->fontHeight();
+      if( glyphs == 0 || cellW <= 0 || cellH <= 0 ) {
+        log_e("Empty readout charset or font");
+        return false;
+      }
+      // read for every changed cell
+      if( !memory::createSprite( atlas, cellW, cellH*glyphs, memory::HEAT_WARM ) ) {
+        log_e("Can't create %dx%d glyph atlas", cellW, int( cellH*glyphs ) );
+        return false;
+      }
+      if( transparent ) {
+        atlas->setPaletteColor( 0, cfg.bg_color ); // transparent
+        atlas->setPaletteColor( 1, cfg.text_color );
+        atlas->fillSprite( 0 );
+        atlas->setTextColor( 1 );
+        cell = new ICS_Sprite( cfg.display );
+        cell->setColorDepth( cfg.bit_depth );
+        if( !memory::createSprite( cell, cellW, cellH, memory::HEAT_HOT ) ) {
+          log_e("Can't create %dx%d readout cell", cellW, cellH );
+          return false;
+        }
+      } else {
+        atlas->fillSprite( cfg.bg_color );
+        atlas->setTextColor( cfg.text_color, cfg.bg_color );
+      }
+      atlas->setTextDatum( TC_DATUM );
+      for( size_t i=0; i<glyphs; i++ ) {
+        glyph[0] = cfg.charset[i];
+        atlas->drawString( glyph, cellW/2, i*cellH );
+      }
+      log_d("Readout atlas: %d glyphs, %dx%d cells, %dbpp", int( glyphs ), cellW, cellH, atlas->getColorDepth() );
+      return true;
+    }
+
+
+    int Readout_Class::glyphIndex( char c )
+    {
+      const char *found = c ? strchr( cfg.charset, c ) : nullptr;
+      return found ? int( found - cfg.charset ) : -1;
+    }
+
+
+    // one glyph of the atlas at x/y in dst, within the current dst clip
+    void Readout_Class::blitGlyph( LovyanGFX *dst, int32_t x, int32_t y, int glyph )
+    {
+      int32_t cx, cy, cw, ch;
+      dst->getClipRect( &cx, &cy, &cw, &ch );
+      clipRect_t clip = constrainClipRect( { x, y, cellW, cellH }, { cx, cy, cw, ch } );
+      if( clip.w <= 0 || clip.h <= 0 ) return;
+      dst->setClipRect( clip.x, clip.y, clip.w, clip.h );
+      if( transparent ) atlas->pushSprite( dst, x, y - glyph*cellH, 0 ); // palette index
+      else atlas->pushSprite( dst, x, y - glyph*cellH );
+      dst->setClipRect( cx, cy, cw, ch );
+    }
+
+
+    void Readout_Class::drawCell( uint8_t idx )
+    {
+      char c    = text[idx];
+      int glyph = glyphIndex( c );
+      clipRect_t rect = { cfg.pos.x + idx*cellW, cfg.pos.y, cellW, cellH };
+
+      if( transparent ) {
+        cell->clearClipRect();
+        cfg.bgSprite->pushSprite( cell, cfg.bgPos.x-rect.x, cfg.bgPos.y-rect.y );
+        if( underlay ) underlay( cell, rect.x-cfg.bgPos.x, rect.y-cfg.bgPos.y, underlayCtx );
+        if( glyph >= 0 ) blitGlyph( cell, 0, 0, glyph );
+        cell->pushSprite( cfg.display, rect.x, rect.y );
+      } else if( glyph >= 0 ) {
+        cfg.display->setClipRect( rect.x, rect.y, rect.w, rect.h );
+        atlas->pushSprite( cfg.display, rect.x, rect.y - glyph*cellH );
+        cfg.display->clearClipRect();
+      } else {
+        cfg.display->fillRect( rect.x, rect.y, rect.w, rect.h, cfg.bg_color );
+      }
+      bus::record( rect );
+      drawn[idx] = c;
+    }
+
+
+    void Readout_Class::setText( const char *str )
+    {
+      if( !_ready || !str ) return;
+      size_t len = strlen( str );
+      if( len > cfg.cells ) { // keep the least significant characters
+        str += len - cfg.cells;
+        len  = cfg.cells;
+      }
+      size_t pad = cfg.cells - len;
+      for( size_t i=0; i<cfg.cells; i++ ) text[i] = i < pad ? ' ' : str[i-pad];
+
+      if( dash ) { // changed cells, submitted as one rect
+        int first = -1, last = -1;
+        for( uint8_t i=0; i<cfg.cells; i++ ) {
+          if( text[i] == drawn[i] ) continue;
+          if( first < 0 ) first = i;
+          last     = i;
+          drawn[i] = text[i];
+        }
+        if( first >= 0 ) dash->invalidate( widgetId, { cfg.pos.x + first*cellW, cfg.pos.y, ( last-first+1 )*cellW, cellH } );
+        return;
+      }
+      cfg.display->startWrite();
+      for( uint8_t i=0; i<cfg.cells; i++ ) {
+        if( text[i] != drawn[i] ) drawCell( i );
+      }
+      cfg.display->endWrite();
+    }
+
+
+    void Readout_Class::setValue( float value, uint8_t decimals )
+    {
+      char str[24];
+      snprintf( str, sizeof(str), "%.*f", decimals, value );
+      setText( str );
+    }
+
+
+    void Readout_Class::pushReadout()
+    {
+      if( !_ready ) return;
+      if( dash ) { dash->invalidate( widgetId ); return; }
+      cfg.display->startWrite();
+      for( uint8_t i=0; i<cfg.cells; i++ ) drawCell( i );
+      cfg.display->endWrite();
+    }
+
+
+    void Readout_Class::drawTo( LovyanGFX *dst, int32_t originX, int32_t originY )
+    {
+      if( !_ready ) return;
+      for( uint8_t i=0; i<cfg.cells; i++ ) {
+        int glyph = glyphIndex( text[i] );
+        if( glyph < 0 ) continue; // blank cells show what is under them
+        blitGlyph( dst, cfg.pos.x + i*cellW - originX, cfg.pos.y - originY, glyph );
+      }
+    }
+
+
+    void Readout_Class::renderOverlay( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Readout_Class *self = (Readout_Class*)ctx;
+      self->drawTo( dst, originX+self->cfg.bgPos.x, originY+self->cfg.bgPos.y );
+    }
+
+
+    void Readout_Class::attach( dashboard::Dashboard_Class *_dash )
+    {
+      if( !_ready || !_dash ) return;
+      dash     = _dash;
+      widgetId = dash->addWidget( getRect(), compose, this );
+    }
+
+
+    // over a background sprite the glyphs are blended over what the widgets below rendered,
+    // over a solid background blank cells are cleared as drawCell() does
+    void Readout_Class::compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Readout_Class *self = (Readout_Class*)ctx;
+      if( !self->transparent ) {
+        for( uint8_t i=0; i<self->cfg.cells; i++ ) {
+          if( self->glyphIndex( self->text[i] ) >= 0 ) continue;
+          dst->fillRect( self->cfg.pos.x + i*self->cellW - originX, self->cfg.pos.y - originY, self->cellW, self->cellH, self->cfg.bg_color );
+        }
+      }
+      self->drawTo( dst, originX, originY );
+    }
+
+
+  }; // end namespace readout
+
+
+  using Readout_Class = readout::Readout_Class;
+
+}; // end namespace LGFXMeter
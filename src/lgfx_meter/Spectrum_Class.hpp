@@ -0,0 +1,302 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <math.h>
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_spans.hpp"
+#include "Dashboard_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+
+  namespace spectrum
+  {
+
+    using namespace utils;
+
+    spectrum_cfg_t cfg =
+    {
+      .display     = nullptr,
+      .clipRect    = {0,0,0,0},
+      .bgSprite    = nullptr,
+      .bgPos       = {0,0},
+      .bg_color    = 0x000000U,
+      .bar_color   = 0x22cc44U,
+      .peak_color  = 0xffffffU,
+      .bands       = 32,
+      .gap         = 2,     // px
+      .sample_rate = 44100, // Hz
+      .min_freq    = 40.0,  // Hz
+      .ref_level   = 32767.0f*64, // full scale sine in a 256 points hann windowed FFT
+      .floor_db    = -60.0,
+      .peak_hold   = 20,    // frames, 0 = no marker
+      .peak_decay  = 1.0    // px per frame
+    };
+
+    spectrum_cfg_t config() { return cfg; }
+
+
+   /*
+    * Spectrum bars.
+    *
+    * FFT bins are grouped into log spaced bands (max magnitude per band), converted
+    * to dB and drawn as bars with a falling peak marker. Only the rows of a column
+    * whose color changed since the previous frame are sent, as vertical spans;
+    * background spans are restored from the shared background sprite.
+    *
+    *   Spectrum_Class *bars = new Spectrum_Class( cfg );
+    *   fft.exec( samples );
+    *   bars->update( fft ); // any object with bins() and magnitude(), or a float array
+    *
+    */
+
+    class Spectrum_Class
+    {
+    public:
+
+      Spectrum_Class( spectrum_cfg_t _cfg = spectrum::cfg )
+      {
+        assert( _cfg.display );
+        cfg = _cfg;
+        if( cfg.bands == 0 ) cfg.bands = 1;
+        barWidth = ( cfg.clipRect.w - ( cfg.bands-1 )*cfg.gap ) / cfg.bands;
+        if( barWidth < 1 ) {
+          log_e("Spectrum area too narrow for %d bands", cfg.bands );
+          return;
+        }
+        columns = new column_t[cfg.bands];
+        reset();
+        _ready = true;
+      };
+
+      ~Spectrum_Class()
+      {
+        if( dash ) dash->removeWidget( widgetId );
+        delete[] columns;
+      }
+
+      bool ready() { return _ready; }
+
+      // magnitudes of bins 0..count-1, spanning 0..sample_rate/2
+      void update( const float *magnitudes, size_t count ) { array_source_t src = { magnitudes }; process( src, count ); }
+      template<typename FFT> void update( FFT &fft ) { process( fft, fft.bins() ); }
+      void setSampleRate( uint32_t sample_rate ) { if( sample_rate != cfg.sample_rate ) { cfg.sample_rate = sample_rate; binsCount = 0; } }
+      // redraw everything, e.g. after the background was pushed again
+      void pushSpectrum();
+      void reset();
+      // let a dashboard composite the bars instead of pushing them
+      void attach( dashboard::Dashboard_Class *_dash );
+
+    private:
+
+      struct column_t
+      {
+        uint16_t lo, hi;    // bins range
+        spans::peak_bar_t rows; // px from the bottom of the area
+      };
+
+      struct array_source_t
+      {
+        const float *data;
+        float magnitude( size_t bin ) { return data[bin]; }
+      };
+
+      spectrum_cfg_t cfg;
+      column_t *columns  = nullptr;
+      size_t   binsCount = 0; // band ranges are computed for this many bins
+      int32_t  barWidth  = 0;
+      bool     _ready    = false;
+
+      dashboard::Dashboard_Class *dash = nullptr;
+      int8_t     widgetId = -1;
+      clipRect_t dirty    = {0,0,0,0}; // changed spans of the frame, submitted at once
+
+      template<typename S> void process( S &src, size_t count );
+      void computeBands( size_t count );
+      int16_t levelToHeight( float level );
+      void drawSpan( int32_t x, int32_t row0, int32_t row1, spans::pixel_t kind );
+      void drawColumn( uint16_t idx );
+      static void compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    };
+
+
+    void Spectrum_Class::reset()
+    {
+      if( !columns ) return;
+      for( uint16_t i=0; i<cfg.bands; i++ ) spans::reset( &columns[i].rows );
+    }
+
+
+    // log spaced band edges between min_freq and nyquist, at least one bin per band
+    void Spectrum_Class::computeBands( size_t count )
+    {
+      binsCount = count;
+      float binHz   = ( cfg.sample_rate*0.5f ) / count;
+      float maxFreq = cfg.sample_rate*0.5f;
+      float minFreq = cfg.min_freq > binHz ? cfg.min_freq : binHz;
+      float ratio   = maxFreq / minFreq;
+      size_t lo = size_t( minFreq/binHz );
+      for( uint16_t i=0; i<cfg.bands; i++ ) {
+        size_t hi = size_t( minFreq * powf( ratio, float(i+1)/cfg.bands ) / binHz );
+        if( hi <= lo ) hi = lo+1;
+        if( hi > count ) hi = count;
+        if( lo >= count ) lo = count-1;
+        columns[i].lo = lo;
+        columns[i].hi = hi > lo ? hi : lo+1;
+        lo = hi;
+      }
+    }
+
+
+    int16_t Spectrum_Class::levelToHeight( float level )
+    {
+      if( level <= 0 ) return 0;
+      float db = 20.0f*log10f( level / cfg.ref_level );
+      if( db <= cfg.floor_db ) return 0;
+      if( db >= 0 ) return cfg.clipRect.h;
+      return int16_t( cfg.clipRect.h * ( 1.0f - db/cfg.floor_db ) );
+    }
+
+
+    template<typename S> void Spectrum_Class::process( S &src, size_t count )
+    {
+      if( !_ready || count == 0 ) return;
+      if( count != binsCount ) computeBands( count );
+
+      if( !dash ) cfg.display->startWrite();
+      for( uint16_t i=0; i<cfg.bands; i++ ) {
+        column_t *col = &columns[i];
+        float level = 0;
+        for( size_t k=col->lo; k<col->hi; k++ ) {
+          float m = src.magnitude( k );
+          if( m > level ) level = m;
+        }
+        spans::setBar( &col->rows, levelToHeight( level ), cfg.peak_hold, cfg.peak_decay );
+        drawColumn( i );
+      }
+      if( !dash ) {
+        cfg.display->endWrite();
+      } else if( dirty.w ) {
+        dash->invalidate( widgetId, dirty );
+        dirty = {0,0,0,0};
+      }
+    }
+
+
+    // rows are counted from the bottom of the area
+    void Spectrum_Class::drawSpan( int32_t x, int32_t row0, int32_t row1, spans::pixel_t kind )
+    {
+      int32_t bottom = cfg.clipRect.y + cfg.clipRect.h;
+      clipRect_t span = { x, bottom-row1, barWidth, row1-row0 };
+      if( dash ) {
+        dirty = dirty.w ? getBoundingRect( dirty, span ) : span;
+        return;
+      }
+      switch( kind ) {
+        case spans::PIXEL_BAR:  cfg.display->fillRect( span.x, span.y, span.w, span.h, cfg.bar_color );  break;
+        case spans::PIXEL_PEAK: cfg.display->fillRect( span.x, span.y, span.w, span.h, cfg.peak_color ); break;
+        case spans::PIXEL_BG:
+          if( cfg.bgSprite ) restoreRect( cfg.display, cfg.bgSprite, cfg.bgPos.x, cfg.bgPos.y, span );
+          else cfg.display->fillRect( span.x, span.y, span.w, span.h, cfg.bg_color );
+        break;
+      }
+      bus::record( span );
+    }
+
+
+    // send only the rows whose color changed, grouped in vertical spans
+    void Spectrum_Class::drawColumn( uint16_t idx )
+    {
+      int32_t x = cfg.clipRect.x + idx*( barWidth+cfg.gap );
+      spans::drawChanges( &columns[idx].rows, cfg.clipRect.h, cfg.peak_hold, [this, x]( int32_t row0, int32_t row1, spans::pixel_t kind ) {
+        drawSpan( x, row0, row1, kind );
+      });
+    }
+
+
+    void Spectrum_Class::pushSpectrum()
+    {
+      if( !_ready ) return;
+      if( dash ) { dash->invalidate( widgetId ); return; }
+      cfg.display->startWrite();
+      if( cfg.bgSprite ) restoreRect( cfg.display, cfg.bgSprite, cfg.bgPos.x, cfg.bgPos.y, cfg.clipRect );
+      else cfg.display->fillRect( cfg.clipRect.x, cfg.clipRect.y, cfg.clipRect.w, cfg.clipRect.h, cfg.bg_color );
+      bus::record( cfg.clipRect );
+      for( uint16_t i=0; i<cfg.bands; i++ ) {
+        columns[i].rows.drawnBar  = 0;
+        columns[i].rows.drawnPeak = 0;
+        drawColumn( i );
+      }
+      cfg.display->endWrite();
+    }
+
+
+    void Spectrum_Class::attach( dashboard::Dashboard_Class *_dash )
+    {
+      if( !_ready || !_dash ) return;
+      dash     = _dash;
+      widgetId = dash->addWidget( cfg.clipRect, compose, this );
+    }
+
+
+    // background, bars and peak markers, dst (0,0) is at originX/originY on the display
+    void Spectrum_Class::compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Spectrum_Class *self = (Spectrum_Class*)ctx;
+      const spectrum_cfg_t &cfg = self->cfg;
+      if( cfg.bgSprite ) cfg.bgSprite->pushSprite( dst, cfg.bgPos.x-originX, cfg.bgPos.y-originY );
+      else dst->fillRect( cfg.clipRect.x-originX, cfg.clipRect.y-originY, cfg.clipRect.w, cfg.clipRect.h, cfg.bg_color );
+      int32_t bottom = cfg.clipRect.y + cfg.clipRect.h - originY;
+      for( uint16_t i=0; i<cfg.bands; i++ ) {
+        const spans::peak_bar_t *rows = &self->columns[i].rows;
+        int32_t x = cfg.clipRect.x + i*( self->barWidth+cfg.gap ) - originX;
+        if( rows->drawnBar > 0 ) dst->fillRect( x, bottom-rows->drawnBar, self->barWidth, rows->drawnBar, cfg.bar_color );
+        int32_t row0, row1;
+        if( spans::drawnPeakSpan( rows, cfg.clipRect.h, cfg.peak_hold, &row0, &row1 ) ) {
+          dst->fillRect( x, bottom-row1, self->barWidth, row1-row0, cfg.peak_color );
+        }
+      }
+    }
+
+
+  }; // end namespace spectrum
+
+
+  using Spectrum_Class = spectrum::Spectrum_Class;
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,299 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "Dashboard_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+
+  namespace waveform
+  {
+
+    using namespace utils;
+
+    const uint8_t mix_channels = 0xff; // average all channels
+
+    waveform_cfg_t cfg =
+    {
+      .display    = nullptr,
+      .clipRect   = {0,0,0,0},
+      .bgSprite   = nullptr,
+      .bgPos      = {0,0},
+      .bg_color   = 0x000000U,
+      .wave_color = 0x44ccffU,
+      .channels   = 2,
+      .channel    = mix_channels
+    };
+
+    waveform_cfg_t config() { return cfg; }
+
+
+   /*
+    * Oscilloscope trace.
+    *
+    * Each block is decimated in a single pass to one min/max pair per column (the
+    * previous column's last sample is included so the trace stays connected), and
+    * each column is drawn as a vertical span. Only the rows that differ from the
+    * previous frame are sent: the part of the old span not covered by the new one
+    * is restored from the shared background, the part of the new span not covered
+    * by the old one is drawn.
+    *
+    *   Waveform_Class *scope = new Waveform_Class( cfg );
+    *   scope->update( stereo_samples, frames );
+    *
+    */
+
+    class Waveform_Class
+    {
+    public:
+
+      Waveform_Class( waveform_cfg_t _cfg = waveform::cfg )
+      {
+        assert( _cfg.display );
+        cfg = _cfg;
+        if( cfg.channels == 0 ) cfg.channels = 1;
+        if( cfg.channel != mix_channels && cfg.channel >= cfg.channels ) cfg.channel = 0;
+        if( cfg.clipRect.w <= 0 || cfg.clipRect.h <= 0 ) {
+          log_e("Empty waveform area");
+          return;
+        }
+        columns = new column_t[cfg.clipRect.w];
+        reset();
+        _ready = true;
+      };
+
+      ~Waveform_Class()
+      {
+        if( dash ) dash->removeWidget( widgetId );
+        delete[] columns;
+      }
+
+      bool ready() { return _ready; }
+
+      // interleaved int16 samples, `frames` per channel
+      void update( const int16_t *samples, size_t frames );
+      // redraw everything, e.g. after the background was pushed again
+      void pushWaveform();
+      void reset();
+      // let a dashboard composite the trace instead of pushing it
+      void attach( dashboard::Dashboard_Class *_dash );
+
+    private:
+
+      struct column_t
+      {
+        int16_t top, bottom; // rows of the new span, inclusive
+        int16_t drawnTop, drawnBottom;
+      };
+
+      waveform_cfg_t cfg;
+      column_t *columns = nullptr;
+      bool     _ready   = false;
+
+      dashboard::Dashboard_Class *dash = nullptr;
+      int8_t     widgetId = -1;
+      clipRect_t dirty    = {0,0,0,0}; // changed spans of the block, submitted at once
+
+      int32_t sampleAt( const int16_t *frame );
+      int16_t valueToRow( int32_t value );
+      void restoreRows( int32_t x, int32_t top, int32_t bottom );
+      void drawRows( int32_t x, int32_t top, int32_t bottom );
+      void drawColumn( int32_t x );
+      void markDirty( clipRect_t span ) { dirty = dirty.w ? getBoundingRect( dirty, span ) : span; }
+      static void compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    };
+
+
+    void Waveform_Class::reset()
+    {
+      if( !columns ) return;
+      int16_t mid = valueToRow( 0 );
+      for( int32_t x=0; x<cfg.clipRect.w; x++ ) {
+        columns[x].top = columns[x].bottom = mid;
+        columns[x].drawnTop    = 1; // empty span: nothing drawn yet
+        columns[x].drawnBottom = 0;
+      }
+    }
+
+
+    int32_t Waveform_Class::sampleAt( const int16_t *frame )
+    {
+      if( cfg.channel != mix_channels ) return frame[cfg.channel];
+      int32_t sum = 0;
+      for( uint8_t c=0; c<cfg.channels; c++ ) sum += frame[c];
+      return sum / cfg.channels;
+    }
+
+
+    // full scale maps to the area height, positive values up
+    int16_t Waveform_Class::valueToRow( int32_t value )
+    {
+      int32_t row = ( cfg.clipRect.h-1 )/2 - ( value * cfg.clipRect.h ) / 65536;
+      if( row < 0 ) row = 0;
+      if( row >= cfg.clipRect.h ) row = cfg.clipRect.h-1;
+      return row;
+    }
+
+
+    void Waveform_Class::update( const int16_t *samples, size_t frames )
+    {
+      if( !_ready || !samples || frames == 0 ) return;
+
+      const int32_t width = cfg.clipRect.w;
+      const size_t stride = cfg.channels;
+      int32_t last = sampleAt( samples );
+      size_t n = 0;
+
+      // single pass: column x covers frames [x*frames/width, (x+1)*frames/width), at least one
+      for( int32_t x=0; x<width; x++ ) {
+        size_t end = ( size_t(x+1) * frames ) / width;
+        if( end <= n ) end = n+1;
+        if( end > frames ) { end = frames; if( n >= frames ) n = frames-1; }
+        int32_t vmin = last, vmax = last;
+        for( ; n<end; n++ ) {
+          int32_t v = sampleAt( samples + n*stride );
+          if( v < vmin ) vmin = v;
+          if( v > vmax ) vmax = v;
+          last = v;
+        }
+        columns[x].top    = valueToRow( vmax );
+        columns[x].bottom = valueToRow( vmin );
+      }
+
+      if( dash ) {
+        for( int32_t x=0; x<width; x++ ) drawColumn( x );
+        if( dirty.w ) dash->invalidate( widgetId, dirty );
+        dirty = {0,0,0,0};
+        return;
+      }
+      cfg.display->startWrite();
+      for( int32_t x=0; x<width; x++ ) drawColumn( x );
+      cfg.display->endWrite();
+    }
+
+
+    void Waveform_Class::restoreRows( int32_t x, int32_t top, int32_t bottom )
+    {
+      if( bottom < top ) return;
+      clipRect_t span = { cfg.clipRect.x+x, cfg.clipRect.y+top, 1, bottom-top+1 };
+      if( dash ) { markDirty( span ); return; }
+      if( cfg.bgSprite ) restoreRect( cfg.display, cfg.bgSprite, cfg.bgPos.x, cfg.bgPos.y, span );
+      else cfg.display->writeFastVLine( span.x, span.y, span.h, cfg.bg_color );
+      bus::record( span );
+    }
+
+
+    void Waveform_Class::drawRows( int32_t x, int32_t top, int32_t bottom )
+    {
+      if( bottom < top ) return;
+      clipRect_t span = { cfg.clipRect.x+x, cfg.clipRect.y+top, 1, bottom-top+1 };
+      if( dash ) { markDirty( span ); return; }
+      cfg.display->writeFastVLine( span.x, span.y, span.h, cfg.wave_color );
+      bus::record( span );
+    }
+
+
+    // old span [ot,ob], new span [nt,nb]: up to two spans to restore and two to draw
+    void Waveform_Class::drawColumn( int32_t x )
+    {
+      column_t *col = &columns[x];
+      int32_t nt = col->top, nb = col->bottom;
+      int32_t ot = col->drawnTop, ob = col->drawnBottom;
+      if( nt == ot && nb == ob ) return;
+
+      if( ob < ot || ob < nt || nb < ot ) { // nothing drawn yet, or no overlap
+        restoreRows( x, ot, ob );
+        drawRows( x, nt, nb );
+      } else {
+        restoreRows( x, ot, nt-1 );
+        restoreRows( x, nb+1, ob );
+        drawRows( x, nt, ot-1 );
+        drawRows( x, ob+1, nb );
+      }
+      col->drawnTop    = nt;
+      col->drawnBottom = nb;
+    }
+
+
+    void Waveform_Class::pushWaveform()
+    {
+      if( !_ready ) return;
+      if( dash ) { dash->invalidate( widgetId ); return; }
+      cfg.display->startWrite();
+      if( cfg.bgSprite ) restoreRect( cfg.display, cfg.bgSprite, cfg.bgPos.x, cfg.bgPos.y, cfg.clipRect );
+      else cfg.display->fillRect( cfg.clipRect.x, cfg.clipRect.y, cfg.clipRect.w, cfg.clipRect.h, cfg.bg_color );
+      bus::record( cfg.clipRect );
+      for( int32_t x=0; x<cfg.clipRect.w; x++ ) {
+        columns[x].drawnTop    = 1;
+        columns[x].drawnBottom = 0;
+        drawColumn( x );
+      }
+      cfg.display->endWrite();
+    }
+
+
+    void Waveform_Class::attach( dashboard::Dashboard_Class *_dash )
+    {
+      if( !_ready || !_dash ) return;
+      dash     = _dash;
+      widgetId = dash->addWidget( cfg.clipRect, compose, this );
+    }
+
+
+    // background and trace, dst (0,0) is at originX/originY on the display
+    void Waveform_Class::compose( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx )
+    {
+      Waveform_Class *self = (Waveform_Class*)ctx;
+      const waveform_cfg_t &cfg = self->cfg;
+      if( cfg.bgSprite ) cfg.bgSprite->pushSprite( dst, cfg.bgPos.x-originX, cfg.bgPos.y-originY );
+      else dst->fillRect( cfg.clipRect.x-originX, cfg.clipRect.y-originY, cfg.clipRect.w, cfg.clipRect.h, cfg.bg_color );
+      for( int32_t x=0; x<cfg.clipRect.w; x++ ) {
+        const column_t *col = &self->columns[x];
+        if( col->drawnBottom < col->drawnTop ) continue;
+        dst->drawFastVLine( cfg.clipRect.x+x-originX, cfg.clipRect.y+col->drawnTop-originY, col->drawnBottom-col->drawnTop+1, cfg.wave_color );
+      }
+    }
+
+
+  }; // end namespace waveform
+
+
+  using Waveform_Class = waveform::Waveform_Class;
+
+}; // end namespace LGFXMeter
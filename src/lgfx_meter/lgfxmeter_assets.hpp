@@ -0,0 +1,297 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <string.h>
+#include "lgfxmeter_types.hpp"
+
+#if defined ESP_PLATFORM
+  #include <esp_partition.h>
+  #include <esp_idf_version.h>
+#else
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+
+namespace LGFXMeter
+{
+
+  namespace assets
+  {
+
+   /*
+    * Asset store: a pack of named assets produced by tools/asset_pack.py, memory mapped
+    * from a flash data partition (ESP32) or a file (host), and handed out as image_t
+    * views pointing into the mapping. Nothing is copied, art can be replaced by writing
+    * the partition without reflashing the app.
+    *
+    * Little endian, asset data is 4 bytes aligned:
+    *
+    *   header
+    *     0  char[4]  magic "LGAS"
+    *     4  uint8    version
+    *     5  uint8    reserved
+    *     6  uint16   entries count
+    *     8  uint32   pack size, bytes (only this much is mapped)
+    *     12 uint32   reserved
+    *     16 entries[count], sorted by name
+    *   entry
+    *     0  char[32] name, zero padded
+    *     32 uint32   data offset, from the start of the pack
+    *     36 uint32   data length
+    *     40 uint8    type, image_type_t or asset_blob
+    *     41 uint8    image_t.bit_depth
+    *     42 uint16   reserved
+    *     44 uint16   width, height
+    *
+    */
+
+    const uint8_t  version     = 1;
+    const uint8_t  asset_blob  = 0xff; // not an image (e.g. needle frames), see getData()
+    const uint32_t header_size = 16;
+    const uint32_t entry_size  = 48;
+    const size_t   name_len    = 32;
+
+
+    class Asset_Store
+    {
+    public:
+
+      ~Asset_Store() { end(); }
+
+      // ESP32: data partition label, host: file path
+      bool begin( const char *source );
+      // pack already in the address space (const array, psram copy...), not owned
+      bool begin( const uint8_t *data, size_t len );
+      // unmap, views handed out so far become invalid
+      void end();
+
+      size_t count() { return entries; }
+      const char *name( size_t idx ) { return idx < entries ? (const char*)entry( idx ) : nullptr; }
+      // image_t view into the mapping, false if missing or not an image
+      bool getImage( const char *name, image_t *img );
+      // raw asset data (e.g. needle_cfg_t.frames), nullptr if missing
+      const uint8_t *getData( const char *name, uint32_t *len = nullptr );
+
+    private:
+
+      const uint8_t *data = nullptr;
+      size_t   size    = 0;
+      uint16_t entries = 0;
+
+      #if defined ESP_PLATFORM
+        #if ESP_IDF_VERSION_MAJOR >= 5
+          esp_partition_mmap_handle_t handle = 0;
+        #else
+          spi_flash_mmap_handle_t handle = 0;
+        #endif
+      #endif
+      bool mapped = false;
+
+      static uint16_t read16( const uint8_t *p ) { uint16_t v; memcpy( &v, p, 2 ); return v; }
+      static uint32_t read32( const uint8_t *p ) { uint32_t v; memcpy( &v, p, 4 ); return v; }
+      const uint8_t *entry( size_t idx ) { return data + header_size + idx*entry_size; }
+      const uint8_t *find( const char *name );
+      bool validate( const uint8_t *_data, size_t len );
+
+    };
+
+
+    bool Asset_Store::validate( const uint8_t *_data, size_t len )
+    {
+      if( len < header_size || memcmp( _data, "LGAS", 4 ) != 0 || _data[4] != version ) {
+        log_e("Invalid asset pack (magic/version)");
+        return false;
+      }
+      uint16_t n = read16( _data + 6 );
+      if( header_size + n*entry_size > len ) {
+        log_e("Truncated asset pack index (%d entries, %d bytes)", n, int(len) );
+        return false;
+      }
+      for( uint16_t i=0; i<n; i++ ) {
+        const uint8_t *e = _data + header_size + i*entry_size;
+        uint32_t offset = read32( e+32 ), length = read32( e+36 );
+        if( e[name_len-1] != 0 || offset > len || length > len - offset ) {
+          log_e("Invalid asset pack entry #%d", i );
+          return false;
+        }
+      }
+      data    = _data;
+      size    = len;
+      entries = n;
+      log_d("Asset pack: %d entries, %d bytes", entries, int(size) );
+      return true;
+    }
+
+
+    bool Asset_Store::begin( const uint8_t *_data, size_t len )
+    {
+      end();
+      return _data && validate( _data, len );
+    }
+
+
+    bool Asset_Store::begin( const char *source )
+    {
+      end();
+      uint8_t header[header_size];
+      const void *ptr = nullptr;
+      size_t len = 0;
+
+      #if defined ESP_PLATFORM
+        const esp_partition_t *part = esp_partition_find_first( ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, source );
+        if( !part ) {
+          log_e("Asset partition '%s' not found", source );
+          return false;
+        }
+        if( esp_partition_read( part, 0, header, header_size ) != ESP_OK ) return false;
+        len = read32( header+8 );
+        if( memcmp( header, "LGAS", 4 ) != 0 || len < header_size || len > part->size ) {
+          log_e("No asset pack in partition '%s'", source );
+          return false;
+        }
+        #if ESP_IDF_VERSION_MAJOR >= 5
+          esp_err_t err = esp_partition_mmap( part, 0, len, ESP_PARTITION_MMAP_DATA, &ptr, &handle );
+        #else
+          esp_err_t err = esp_partition_mmap( part, 0, len, SPI_FLASH_MMAP_DATA, &ptr, &handle );
+        #endif
+        if( err != ESP_OK ) {
+          log_e("Unable to map %d bytes of partition '%s' (err 0x%x)", int(len), source, err );
+          return false;
+        }
+      #else
+        int fd = open( source, O_RDONLY );
+        if( fd < 0 ) {
+          log_e("Unable to open asset pack '%s'", source );
+          return false;
+        }
+        struct stat st;
+        if( fstat( fd, &st ) != 0 || size_t(st.st_size) < header_size || read( fd, header, header_size ) != ssize_t(header_size) ) {
+          close( fd );
+          return false;
+        }
+        len = read32( header+8 );
+        if( memcmp( header, "LGAS", 4 ) != 0 || len < header_size || len > size_t(st.st_size) ) {
+          log_e("No asset pack in '%s'", source );
+          close( fd );
+          return false;
+        }
+        ptr = mmap( nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0 );
+        close( fd ); // the mapping holds its own reference
+        if( ptr == MAP_FAILED ) {
+          log_e("Unable to map asset pack '%s'", source );
+          return false;
+        }
+      #endif
+
+      mapped = true;
+      if( !validate( (const uint8_t*)ptr, len ) ) {
+        data = (const uint8_t*)ptr; // unmapped by end()
+        size = len;
+        end();
+        return false;
+      }
+      return true;
+    }
+
+
+    void Asset_Store::end()
+    {
+      if( mapped && data ) {
+        #if defined ESP_PLATFORM
+          #if ESP_IDF_VERSION_MAJOR >= 5
+            esp_partition_munmap( handle );
+          #else
+            spi_flash_munmap( handle );
+          #endif
+        #else
+          munmap( (void*)data, size );
+        #endif
+      }
+      mapped  = false;
+      data    = nullptr;
+      size    = 0;
+      entries = 0;
+    }
+
+
+    const uint8_t *Asset_Store::find( const char *name )
+    {
+      if( !name ) return nullptr;
+      int lo = 0, hi = int(entries)-1;
+      while( lo <= hi ) {
+        int mid = ( lo + hi ) / 2;
+        const uint8_t *e = entry( mid );
+        int cmp = strncmp( name, (const char*)e, name_len );
+        if( cmp == 0 ) return e;
+        if( cmp < 0 ) hi = mid-1;
+        else          lo = mid+1;
+      }
+      return nullptr;
+    }
+
+
+    bool Asset_Store::getImage( const char *name, image_t *img )
+    {
+      const uint8_t *e = find( name );
+      if( !e || e[40] > IMAGE_PACKED ) {
+        log_e("No image named '%s'", name ? name : "" );
+        return false;
+      }
+      img->bit_depth = e[41];
+      img->data      = data + read32( e+32 );
+      img->len       = read32( e+36 );
+      img->type      = image_type_t( e[40] );
+      img->width     = read16( e+44 );
+      img->height    = read16( e+46 );
+      return true;
+    }
+
+
+    const uint8_t *Asset_Store::getData( const char *name, uint32_t *len )
+    {
+      const uint8_t *e = find( name );
+      if( !e ) return nullptr;
+      if( len ) *len = read32( e+36 );
+      return data + read32( e+32 );
+    }
+
+
+  }; // end namespace assets
+
+  using Asset_Store = assets::Asset_Store;
+
+}; // end namespace LGFXMeter
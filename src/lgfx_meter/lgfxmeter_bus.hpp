@@ -0,0 +1,228 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace bus
+  {
+   /*
+    * Display bus transfer recorder and cost model.
+    *
+    * Every window the library writes to the display (needle clip, background
+    * restore, gauge push) is reported here. When a recorder is attached, the
+    * transactions are logged per frame and the cost model predicts how long
+    * the panel bus would take to transfer them, so push-minimizing changes
+    * can be compared without the actual hardware.
+    *
+    *   bus::Bus_Recorder rec( { 40000000, 12.0f, 2 } );
+    *   bus::recorder = &rec;
+    *   ICSGauge->drawNeedle( angle );
+    *   rec.endFrame();
+    *   rec.printStats();
+    *
+    */
+
+    // bus properties used to estimate transfer time
+    struct bus_cost_t
+    {
+      uint32_t spi_freq;        // bus clock in Hz
+      float    transaction_us;  // fixed cost per transaction (CS toggle, CASET/RASET/RAMWR, DMA setup)
+      uint8_t  bytes_per_pixel; // panel pixel format (2=RGB565, 3=RGB666)
+    };
+
+    // a single setWindow + pixel write
+    struct transfer_t
+    {
+      clipRect_t rect;         // display window
+      uint32_t   transactions; // how many transactions were needed for that window (e.g. one per scanline for direct AA drawing)
+    };
+
+    // accumulated bus usage
+    struct bus_stats_t
+    {
+      uint32_t frames;
+      uint32_t transactions;
+      uint64_t pixels;
+      float    predicted_us; // predicted bus time
+    };
+
+    const bus_cost_t default_cost = // ILI9342C on M5Stack Core2
+    {
+      .spi_freq        = 40000000,
+      .transaction_us  = 12.0f,
+      .bytes_per_pixel = 2
+    };
+
+
+    // predicted bus time of a window, in us
+    float predict( const bus_cost_t &cost, clipRect_t rect, uint32_t transactions = 1 )
+    {
+      if( rect.w <= 0 || rect.h <= 0 || cost.spi_freq == 0 ) return 0.0f;
+      float bits = float(rect.w) * float(rect.h) * cost.bytes_per_pixel * 8.0f;
+      return transactions * cost.transaction_us + bits * 1000000.0f / float(cost.spi_freq);
+    }
+
+
+    class Bus_Recorder
+    {
+    public:
+
+      Bus_Recorder( bus_cost_t _cost = default_cost, size_t _capacity = 32 )
+      {
+        cost     = _cost;
+        capacity = _capacity;
+        frameLog = (transfer_t*)calloc( capacity, sizeof(transfer_t) );
+        if( !frameLog ) {
+          log_e("Unable to allocate transfer log, only stats will be available");
+          capacity = 0;
+        }
+        reset();
+      };
+
+      ~Bus_Recorder() { if( frameLog ) free( frameLog ); }
+
+      // owns frameLog
+      Bus_Recorder( const Bus_Recorder& ) = delete;
+      Bus_Recorder& operator=( const Bus_Recorder& ) = delete;
+
+      void record( clipRect_t rect, uint32_t transactions = 1 );
+      void endFrame();
+      void reset();
+      void setCost( bus_cost_t _cost ) { cost = _cost; }
+      float predict( clipRect_t rect, uint32_t transactions = 1 );
+
+      bus_stats_t getStats()      { return total; }
+      bus_stats_t getFrameStats() { return lastFrame; }
+      // transfers logged for the current (or last closed) frame, truncated to capacity
+      const transfer_t *getTransfers() { return frameLog; }
+      size_t getTransfersCount() { return min( frameCount, capacity ); }
+
+      float avgFrameTime() { return total.frames ? total.predicted_us / total.frames : 0.0f; }
+      float predictedFps() { float us = avgFrameTime(); return us > 0 ? 1000000.0f / us : 0.0f; }
+      void printStats();
+
+    private:
+
+      bus_cost_t  cost;
+      transfer_t  *frameLog = nullptr;
+      size_t      capacity  = 0;
+      size_t      frameCount = 0;
+      bool        frameClosed = false;
+      bus_stats_t current;   // frame being recorded
+      bus_stats_t lastFrame; // last closed frame
+      bus_stats_t total;     // all closed frames
+
+    };
+
+
+    // recorder receiving the library transfers, nullptr = disabled
+    Bus_Recorder *recorder = nullptr;
+
+
+    // called by the library for every window written to the display
+    void record( clipRect_t rect, uint32_t transactions = 1 )
+    {
+      if( recorder ) recorder->record( rect, transactions );
+    }
+
+
+    float Bus_Recorder::predict( clipRect_t rect, uint32_t transactions )
+    {
+      return bus::predict( cost, rect, transactions );
+    }
+
+
+    void Bus_Recorder::record( clipRect_t rect, uint32_t transactions )
+    {
+      if( rect.w <= 0 || rect.h <= 0 ) return; // fully clipped, nothing sent
+      if( frameClosed ) { // start logging a new frame
+        frameCount  = 0;
+        frameClosed = false;
+      }
+      if( frameCount < capacity ) {
+        frameLog[frameCount] = { rect, transactions };
+      }
+      frameCount++;
+      current.transactions += transactions;
+      current.pixels       += rect.w*rect.h;
+      current.predicted_us += predict( rect, transactions );
+    }
+
+
+    void Bus_Recorder::endFrame()
+    {
+      current.frames = 1;
+      lastFrame = current;
+      total.frames       += 1;
+      total.transactions += current.transactions;
+      total.pixels       += current.pixels;
+      total.predicted_us += current.predicted_us;
+      current     = { 0, 0, 0, 0.0f };
+      frameClosed = true;
+    }
+
+
+    void Bus_Recorder::reset()
+    {
+      current    = { 0, 0, 0, 0.0f };
+      lastFrame  = { 0, 0, 0, 0.0f };
+      total      = { 0, 0, 0, 0.0f };
+      frameCount = 0;
+      frameClosed = false;
+    }
+
+
+    void Bus_Recorder::printStats()
+    {
+      log_i("Bus: %d frames, %.1f transactions/frame, %.0f px/frame, predicted %.0f us/frame (%.2f fps) @ %d MHz",
+        total.frames,
+        total.frames ? float(total.transactions)/total.frames : 0.0f,
+        total.frames ? float(total.pixels)/total.frames : 0.0f,
+        avgFrameTime(),
+        predictedFps(),
+        cost.spi_freq/1000000
+      );
+      for( size_t i=0; i<min( frameCount, capacity ); i++ ) {
+        log_v("  #%-2d [%3d:%-3d][%3dx%-3d] x%d", int(i), frameLog[i].rect.x, frameLog[i].rect.y, frameLog[i].rect.w, frameLog[i].rect.h, frameLog[i].transactions );
+      }
+    }
+
+
+  }; // end namespace bus
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,164 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <atomic>
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace channel
+  {
+   /*
+    * Lock-free single producer / single consumer value channel.
+    *
+    * The producer (audio callback, CI-V poller, another core...) pushes values
+    * as fast as it wants and never blocks. The renderer takes, once per frame,
+    * the latest value along with min/max/peak of everything pushed since the
+    * previous frame, no sample is lost or counted twice.
+    *
+    * Three slots are rotated: the producer owns one, the consumer owns one,
+    * and the shared one is swapped atomically along with a "dirty" flag.
+    *
+    *   channel::Value_Channel<float> levels;
+    *
+    *   // producer task
+    *   levels.push( level );
+    *
+    *   // render loop
+    *   channel::value_stats_t<float> frame;
+    *   if( levels.take( frame ) ) gauge->setNeedle( frame.peak );
+    *
+    * The aggregate is value_stats_t<T> unless another type with reset() and
+    * add( T ) is given, e.g. levels::level_t merges whole level snapshots.
+    *
+    */
+
+    template<typename T> struct value_stats_t
+    {
+      T        last;  // latest value
+      T        min;
+      T        max;
+      T        peak;  // max absolute value
+      uint32_t count; // values aggregated
+
+      void reset() { count = 0; }
+
+      void add( T value )
+      {
+        T absval = value < 0 ? -value : value;
+        if( count == 0 ) {
+          min = max = value;
+          peak = absval;
+        } else {
+          if( value < min ) min = value;
+          if( value > max ) max = value;
+          if( absval > peak ) peak = absval;
+        }
+        last = value;
+        count++;
+      }
+    };
+
+
+    template<typename T = float, typename S = value_stats_t<T>> class Value_Channel
+    {
+    public:
+
+      Value_Channel()
+      {
+        for( int i=0; i<3; i++ ) slots[i].reset();
+        acc.reset();
+        delta.reset();
+      };
+
+      // producer side, never blocks
+      void push( T value );
+      // consumer side, returns false when nothing was pushed since the last call
+      bool take( S &out );
+
+      bool takeLatest( T &value ) { S s; if( !take( s ) ) return false; value = s.last; return true; }
+      bool takePeak( T &value )   { S s; if( !take( s ) ) return false; value = s.peak; return true; }
+
+    private:
+
+      static const uint32_t dirty = 0x4; // shared slot holds unconsumed values
+      static const uint32_t index = 0x3;
+
+      S slots[3];
+      std::atomic<uint32_t> shared { 1 }; // index of the shared slot | dirty flag
+
+      // producer owned
+      uint32_t back = 0;
+      S acc;   // everything since the last consumed publish
+      S delta; // everything since the last publish
+
+      // consumer owned
+      uint32_t front = 2;
+
+    };
+
+
+    template<typename T, typename S> void Value_Channel<T, S>::push( T value )
+    {
+      acc.add( value );
+      delta.add( value );
+
+      uint32_t current = shared.load( std::memory_order_acquire );
+      do {
+        // previous publish still unread: replace it with the whole aggregate,
+        // otherwise it was consumed and only the values pushed since are new
+        slots[back] = ( current & dirty ) ? acc : delta;
+      } while( !shared.compare_exchange_weak( current, back | dirty, std::memory_order_acq_rel, std::memory_order_acquire ) );
+
+      if( !( current & dirty ) ) acc = delta;
+      delta.reset();
+      back = current & index;
+    }
+
+
+    template<typename T, typename S> bool Value_Channel<T, S>::take( S &out )
+    {
+      if( !( shared.load( std::memory_order_relaxed ) & dirty ) ) return false;
+      uint32_t previous = shared.exchange( front, std::memory_order_acq_rel );
+      front = previous & index;
+      out = slots[front];
+      return true;
+    }
+
+
+  }; // end namespace channel
+
+}; // end namespace LGFXMeter
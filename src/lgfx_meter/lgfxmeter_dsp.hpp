@@ -0,0 +1,251 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+
+#if defined __SSE2__
+  #include <emmintrin.h>
+  #define LGFXMETER_DSP_SSE2
+#elif defined __ARM_NEON
+  #include <arm_neon.h>
+  #define LGFXMETER_DSP_NEON
+#endif
+
+
+namespace LGFXMeter
+{
+
+  namespace dsp
+  {
+   /*
+    * Block kernels over interleaved stereo int16 (L,R,L,R...), one pass computes
+    * for each channel the absolute peak, the sum of squares and the sum (DC offset).
+    *
+    * stereoStats() uses SSE2 or NEON on hosts that have it, and the portable
+    * scalar reference otherwise, which includes every ESP32 (the S3 vector
+    * extensions are not used). Results are accumulated so consecutive blocks
+    * can be chained, call reset() to start a new window.
+    *
+    *   dsp::stereo_stats_t stats;
+    *   stats.reset();
+    *   dsp::stereoStats( buffer, 768, &stats );
+    *   float rms = stats.rms( 0 ), dc = stats.dc( 0 ); // normalized to full scale
+    *
+    */
+
+    struct stereo_stats_t
+    {
+      int32_t  peak[2];        // max(|x|), up to 32768
+      uint64_t sum_squares[2];
+      int64_t  sum[2];
+      uint32_t frames;
+
+      void reset()
+      {
+        for( int c=0; c<2; c++ ) { peak[c] = 0; sum_squares[c] = 0; sum[c] = 0; }
+        frames = 0;
+      }
+
+      float rms( int c ) const { return frames ? sqrtf( float( double(sum_squares[c]) / frames ) ) / 32768.0f : 0; }
+      float dc( int c ) const  { return frames ? float( double(sum[c]) / frames ) / 32768.0f : 0; }
+      float level( int c ) const { return peak[c] / 32768.0f; }
+    };
+
+
+    const char *kernelName()
+    {
+      #if defined LGFXMETER_DSP_SSE2
+        return "sse2";
+      #elif defined LGFXMETER_DSP_NEON
+        return "neon";
+      #else
+        return "scalar";
+      #endif
+    }
+
+
+    // portable reference, also used for the vector kernels tail
+    void stereoStatsScalar( const int16_t *in, size_t frames, stereo_stats_t *out )
+    {
+      int32_t  peakL = out->peak[0], peakR = out->peak[1];
+      uint64_t sqL = 0, sqR = 0;
+      int64_t  sumL = 0, sumR = 0;
+      for( size_t n=0; n<frames; n++ ) {
+        int32_t l = in[2*n];
+        int32_t r = in[2*n+1];
+        int32_t al = l < 0 ? -l : l;
+        int32_t ar = r < 0 ? -r : r;
+        if( al > peakL ) peakL = al;
+        if( ar > peakR ) peakR = ar;
+        sqL  += uint32_t( l*l );
+        sqR  += uint32_t( r*r );
+        sumL += l;
+        sumR += r;
+      }
+      out->peak[0] = peakL; out->peak[1] = peakR;
+      out->sum_squares[0] += sqL; out->sum_squares[1] += sqR;
+      out->sum[0] += sumL; out->sum[1] += sumR;
+      out->frames += frames;
+    }
+
+
+    #if defined LGFXMETER_DSP_SSE2
+
+      // 4 frames per iteration
+      void stereoStatsSSE2( const int16_t *in, size_t frames, stereo_stats_t *out )
+      {
+        const size_t  vframes = frames & ~size_t(3);
+        const __m128i zero    = _mm_setzero_si128();
+        const __m128i lmask   = _mm_set1_epi32( 0x0000ffff ); // L is the low half of each 32 bits lane
+
+        __m128i vmax  = _mm_set1_epi16( 0 );
+        __m128i vmin  = _mm_set1_epi16( 0 );
+        __m128i sq    = zero; // 2x64 bits: L, R
+
+        size_t n = 0;
+        while( n < vframes ) {
+          // 32 bits lane sums can take 65536 int16 before overflowing, flush every 16384 iterations
+          size_t chunk_end = n + 16384*4 < vframes ? n + 16384*4 : vframes;
+          __m128i sumL = zero, sumR = zero;
+          for( ; n < chunk_end; n += 4 ) {
+            __m128i x = _mm_loadu_si128( (const __m128i*)( in + 2*n ) );
+            vmax = _mm_max_epi16( vmax, x );
+            vmin = _mm_min_epi16( vmin, x );
+            // madd with the other channel zeroed: one square per 32 bits lane, max 2^30
+            __m128i xl  = _mm_and_si128( x, lmask );
+            __m128i xr  = _mm_andnot_si128( lmask, x );
+            __m128i sql = _mm_madd_epi16( xl, xl );
+            __m128i sqr = _mm_madd_epi16( xr, xr );
+            // horizontal pairs to 64 bits: [sql0+sql1, sql2+sql3] and same for R
+            __m128i l64 = _mm_add_epi64( _mm_unpacklo_epi32( sql, zero ), _mm_unpackhi_epi32( sql, zero ) );
+            __m128i r64 = _mm_add_epi64( _mm_unpacklo_epi32( sqr, zero ), _mm_unpackhi_epi32( sqr, zero ) );
+            // pack as [L, R]
+            sq = _mm_add_epi64( sq, _mm_add_epi64( _mm_unpacklo_epi64( l64, r64 ), _mm_unpackhi_epi64( l64, r64 ) ) );
+            // sign extended channels
+            sumL = _mm_add_epi32( sumL, _mm_srai_epi32( _mm_slli_epi32( x, 16 ), 16 ) );
+            sumR = _mm_add_epi32( sumR, _mm_srai_epi32( x, 16 ) );
+          }
+          int32_t l[4], r[4];
+          _mm_storeu_si128( (__m128i*)l, sumL );
+          _mm_storeu_si128( (__m128i*)r, sumR );
+          out->sum[0] += int64_t(l[0]) + l[1] + l[2] + l[3];
+          out->sum[1] += int64_t(r[0]) + r[1] + r[2] + r[3];
+        }
+
+        int16_t mx[8], mn[8];
+        uint64_t sqs[2];
+        _mm_storeu_si128( (__m128i*)mx, vmax );
+        _mm_storeu_si128( (__m128i*)mn, vmin );
+        _mm_storeu_si128( (__m128i*)sqs, sq );
+        for( int i=0; i<8; i++ ) {
+          int32_t p = mx[i] > -int32_t(mn[i]) ? mx[i] : -int32_t(mn[i]);
+          if( p > out->peak[i&1] ) out->peak[i&1] = p;
+        }
+        out->sum_squares[0] += sqs[0];
+        out->sum_squares[1] += sqs[1];
+        out->frames += vframes;
+
+        stereoStatsScalar( in + 2*vframes, frames - vframes, out );
+      }
+
+    #elif defined LGFXMETER_DSP_NEON
+
+      // 8 frames per iteration, vld2 deinterleaves the channels
+      void stereoStatsNEON( const int16_t *in, size_t frames, stereo_stats_t *out )
+      {
+        const size_t vframes = frames & ~size_t(7);
+
+        int16x8_t  maxL = vdupq_n_s16( 0 ), maxR = vdupq_n_s16( 0 );
+        int16x8_t  minL = vdupq_n_s16( 0 ), minR = vdupq_n_s16( 0 );
+        uint64x2_t sqL  = vdupq_n_u64( 0 ), sqR  = vdupq_n_u64( 0 );
+
+        size_t n = 0;
+        while( n < vframes ) {
+          // pairwise int32 sums take 2 samples per lane and iteration, flush every 16384 iterations
+          size_t chunk_end = n + 16384*8 < vframes ? n + 16384*8 : vframes;
+          int32x4_t sumL = vdupq_n_s32( 0 ), sumR = vdupq_n_s32( 0 );
+          for( ; n < chunk_end; n += 8 ) {
+            int16x8x2_t x = vld2q_s16( in + 2*n );
+            maxL = vmaxq_s16( maxL, x.val[0] ); minL = vminq_s16( minL, x.val[0] );
+            maxR = vmaxq_s16( maxR, x.val[1] ); minR = vminq_s16( minR, x.val[1] );
+            // squares are < 2^31 as signed, add them pairwise into 64 bits lanes
+            sqL = vpadalq_u32( sqL, vreinterpretq_u32_s32( vmull_s16( vget_low_s16( x.val[0] ), vget_low_s16( x.val[0] ) ) ) );
+            sqL = vpadalq_u32( sqL, vreinterpretq_u32_s32( vmull_s16( vget_high_s16( x.val[0] ), vget_high_s16( x.val[0] ) ) ) );
+            sqR = vpadalq_u32( sqR, vreinterpretq_u32_s32( vmull_s16( vget_low_s16( x.val[1] ), vget_low_s16( x.val[1] ) ) ) );
+            sqR = vpadalq_u32( sqR, vreinterpretq_u32_s32( vmull_s16( vget_high_s16( x.val[1] ), vget_high_s16( x.val[1] ) ) ) );
+            sumL = vpadalq_s16( sumL, x.val[0] );
+            sumR = vpadalq_s16( sumR, x.val[1] );
+          }
+          int32_t l[4], r[4];
+          vst1q_s32( l, sumL );
+          vst1q_s32( r, sumR );
+          out->sum[0] += int64_t(l[0]) + l[1] + l[2] + l[3];
+          out->sum[1] += int64_t(r[0]) + r[1] + r[2] + r[3];
+        }
+
+        int16_t mx[2][8], mn[2][8];
+        vst1q_s16( mx[0], maxL ); vst1q_s16( mn[0], minL );
+        vst1q_s16( mx[1], maxR ); vst1q_s16( mn[1], minR );
+        for( int c=0; c<2; c++ ) {
+          for( int i=0; i<8; i++ ) {
+            int32_t p = mx[c][i] > -int32_t(mn[c][i]) ? mx[c][i] : -int32_t(mn[c][i]);
+            if( p > out->peak[c] ) out->peak[c] = p;
+          }
+        }
+        out->sum_squares[0] += vgetq_lane_u64( sqL, 0 ) + vgetq_lane_u64( sqL, 1 );
+        out->sum_squares[1] += vgetq_lane_u64( sqR, 0 ) + vgetq_lane_u64( sqR, 1 );
+        out->frames += vframes;
+
+        stereoStatsScalar( in + 2*vframes, frames - vframes, out );
+      }
+
+    #endif
+
+
+    // best kernel for the target
+    void stereoStats( const int16_t *in, size_t frames, stereo_stats_t *out )
+    {
+      #if defined LGFXMETER_DSP_SSE2
+        stereoStatsSSE2( in, frames, out );
+      #elif defined LGFXMETER_DSP_NEON
+        stereoStatsNEON( in, frames, out );
+      #else
+        stereoStatsScalar( in, frames, out );
+      #endif
+    }
+
+
+  }; // end namespace dsp
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,1735 @@
+// generated by easing_lut.py -o src/lgfx_meter/lgfxmeter_easing_lut.hpp, do not edit
+// 45 tables of 257 floats, included at the end of lgfxmeter_types.hpp
+
+#pragma once
+
+namespace LGFXMeter
+{
+
+  namespace easing
+  {
+
+    static_assert( lut_size == 256, "regenerate with tools/easing_lut.py --size" );
+
+    namespace lut_data
+    {
+      const float linear[lut_size+1] =
+      {
+        0.0f, 0.00390625f, 0.0078125f, 0.01171875f, 0.015625f, 0.01953125f, 0.0234375f, 0.02734375f,
+        0.03125f, 0.03515625f, 0.0390625f, 0.04296875f, 0.046875f, 0.05078125f, 0.0546875f, 0.05859375f,
+        0.0625f, 0.06640625f, 0.0703125f, 0.07421875f, 0.078125f, 0.08203125f, 0.0859375f, 0.08984375f,
+        0.09375f, 0.09765625f, 0.1015625f, 0.10546875f, 0.109375f, 0.11328125f, 0.1171875f, 0.12109375f,
+        0.125f, 0.12890625f, 0.1328125f, 0.13671875f, 0.140625f, 0.14453125f, 0.1484375f, 0.15234375f,
+        0.15625f, 0.16015625f, 0.1640625f, 0.16796875f, 0.171875f, 0.17578125f, 0.1796875f, 0.18359375f,
+        0.1875f, 0.19140625f, 0.1953125f, 0.19921875f, 0.203125f, 0.20703125f, 0.2109375f, 0.21484375f,
+        0.21875f, 0.22265625f, 0.2265625f, 0.23046875f, 0.234375f, 0.23828125f, 0.2421875f, 0.24609375f,
+        0.25f, 0.25390625f, 0.2578125f, 0.26171875f, 0.265625f, 0.26953125f, 0.2734375f, 0.27734375f,
+        0.28125f, 0.28515625f, 0.2890625f, 0.29296875f, 0.296875f, 0.30078125f, 0.3046875f, 0.30859375f,
+        0.3125f, 0.31640625f, 0.3203125f, 0.32421875f, 0.328125f, 0.33203125f, 0.3359375f, 0.33984375f,
+        0.34375f, 0.34765625f, 0.3515625f, 0.35546875f, 0.359375f, 0.36328125f, 0.3671875f, 0.37109375f,
+        0.375f, 0.37890625f, 0.3828125f, 0.38671875f, 0.390625f, 0.39453125f, 0.3984375f, 0.40234375f,
+        0.40625f, 0.41015625f, 0.4140625f, 0.41796875f, 0.421875f, 0.42578125f, 0.4296875f, 0.43359375f,
+        0.4375f, 0.44140625f, 0.4453125f, 0.44921875f, 0.453125f, 0.45703125f, 0.4609375f, 0.46484375f,
+        0.46875f, 0.47265625f, 0.4765625f, 0.48046875f, 0.484375f, 0.48828125f, 0.4921875f, 0.49609375f,
+        0.5f, 0.50390625f, 0.5078125f, 0.51171875f, 0.515625f, 0.51953125f, 0.5234375f, 0.52734375f,
+        0.53125f, 0.53515625f, 0.5390625f, 0.54296875f, 0.546875f, 0.55078125f, 0.5546875f, 0.55859375f,
+        0.5625f, 0.56640625f, 0.5703125f, 0.57421875f, 0.578125f, 0.58203125f, 0.5859375f, 0.58984375f,
+        0.59375f, 0.59765625f, 0.6015625f, 0.60546875f, 0.609375f, 0.61328125f, 0.6171875f, 0.62109375f,
+        0.625f, 0.62890625f, 0.6328125f, 0.63671875f, 0.640625f, 0.64453125f, 0.6484375f, 0.65234375f,
+        0.65625f, 0.66015625f, 0.6640625f, 0.66796875f, 0.671875f, 0.67578125f, 0.6796875f, 0.68359375f,
+        0.6875f, 0.69140625f, 0.6953125f, 0.69921875f, 0.703125f, 0.70703125f, 0.7109375f, 0.71484375f,
+        0.71875f, 0.72265625f, 0.7265625f, 0.73046875f, 0.734375f, 0.73828125f, 0.7421875f, 0.74609375f,
+        0.75f, 0.75390625f, 0.7578125f, 0.76171875f, 0.765625f, 0.76953125f, 0.7734375f, 0.77734375f,
+        0.78125f, 0.78515625f, 0.7890625f, 0.79296875f, 0.796875f, 0.80078125f, 0.8046875f, 0.80859375f,
+        0.8125f, 0.81640625f, 0.8203125f, 0.82421875f, 0.828125f, 0.83203125f, 0.8359375f, 0.83984375f,
+        0.84375f, 0.84765625f, 0.8515625f, 0.85546875f, 0.859375f, 0.86328125f, 0.8671875f, 0.87109375f,
+        0.875f, 0.87890625f, 0.8828125f, 0.88671875f, 0.890625f, 0.89453125f, 0.8984375f, 0.90234375f,
+        0.90625f, 0.91015625f, 0.9140625f, 0.91796875f, 0.921875f, 0.92578125f, 0.9296875f, 0.93359375f,
+        0.9375f, 0.94140625f, 0.9453125f, 0.94921875f, 0.953125f, 0.95703125f, 0.9609375f, 0.96484375f,
+        0.96875f, 0.97265625f, 0.9765625f, 0.98046875f, 0.984375f, 0.98828125f, 0.9921875f, 0.99609375f,
+        1.0f,
+      };
+      const float easeInQuad[lut_size+1] =
+      {
+        0.0f, 1.5258789e-05f, 6.1035156e-05f, 0.0001373291f, 0.00024414062f, 0.00038146973f, 0.0005493164f, 0.00074768066f,
+        0.0009765625f, 0.0012359619f, 0.0015258789f, 0.0018463135f, 0.0021972656f, 0.0025787354f, 0.0029907227f, 0.0034332275f,
+        0.00390625f, 0.00440979f, 0.0049438477f, 0.005508423f, 0.0061035156f, 0.006729126f, 0.007385254f, 0.008071899f,
+        0.0087890625f, 0.009536743f, 0.010314941f, 0.011123657f, 0.011962891f, 0.012832642f, 0.01373291f, 0.014663696f,
+        0.015625f, 0.016616821f, 0.01763916f, 0.018692017f, 0.01977539f, 0.020889282f, 0.022033691f, 0.023208618f,
+        0.024414062f, 0.025650024f, 0.026916504f, 0.028213501f, 0.029541016f, 0.030899048f, 0.032287598f, 0.033706665f,
+        0.03515625f, 0.036636353f, 0.038146973f, 0.03968811f, 0.041259766f, 0.04286194f, 0.04449463f, 0.046157837f,
+        0.047851562f, 0.049575806f, 0.051330566f, 0.053115845f, 0.05493164f, 0.056777954f, 0.058654785f, 0.060562134f,
+        0.0625f, 0.064468384f, 0.066467285f, 0.068496704f, 0.07055664f, 0.072647095f, 0.07476807f, 0.076919556f,
+        0.07910156f, 0.08131409f, 0.08355713f, 0.08583069f, 0.088134766f, 0.09046936f, 0.09283447f, 0.0952301f,
+        0.09765625f, 0.100112915f, 0.1026001f, 0.1051178f, 0.107666016f, 0.11024475f, 0.112854004f, 0.115493774f,
+        0.11816406f, 0.12086487f, 0.12359619f, 0.12635803f, 0.12915039f, 0.13197327f, 0.13482666f, 0.13771057f,
+        0.140625f, 0.14356995f, 0.14654541f, 0.14955139f, 0.15258789f, 0.1556549f, 0.15875244f, 0.1618805f,
+        0.16503906f, 0.16822815f, 0.17144775f, 0.17469788f, 0.17797852f, 0.18128967f, 0.18463135f, 0.18800354f,
+        0.19140625f, 0.19483948f, 0.19830322f, 0.20179749f, 0.20532227f, 0.20887756f, 0.21246338f, 0.21607971f,
+        0.21972656f, 0.22340393f, 0.22711182f, 0.23085022f, 0.23461914f, 0.23841858f, 0.24224854f, 0.24610901f,
+        0.25f, 0.2539215f, 0.25787354f, 0.26185608f, 0.26586914f, 0.26991272f, 0.27398682f, 0.27809143f,
+        0.28222656f, 0.2863922f, 0.29058838f, 0.29481506f, 0.29907227f, 0.30336f, 0.30767822f, 0.31202698f,
+        0.31640625f, 0.32081604f, 0.32525635f, 0.32972717f, 0.33422852f, 0.33876038f, 0.34332275f, 0.34791565f,
+        0.35253906f, 0.357193f, 0.36187744f, 0.3665924f, 0.3713379f, 0.3761139f, 0.3809204f, 0.38575745f,
+        0.390625f, 0.39552307f, 0.40045166f, 0.40541077f, 0.4104004f, 0.41542053f, 0.4204712f, 0.42555237f,
+        0.43066406f, 0.43580627f, 0.440979f, 0.44618225f, 0.45141602f, 0.4566803f, 0.4619751f, 0.46730042f,
+        0.47265625f, 0.4780426f, 0.48345947f, 0.48890686f, 0.49438477f, 0.4998932f, 0.5054321f, 0.5110016f,
+        0.51660156f, 0.52223206f, 0.52789307f, 0.5335846f, 0.53930664f, 0.5450592f, 0.5508423f, 0.5566559f,
+        0.5625f, 0.56837463f, 0.5742798f, 0.58021545f, 0.58618164f, 0.59217834f, 0.59820557f, 0.6042633f,
+        0.61035156f, 0.61647034f, 0.6226196f, 0.62879944f, 0.63500977f, 0.6412506f, 0.647522f, 0.65382385f,
+        0.66015625f, 0.66651917f, 0.6729126f, 0.67933655f, 0.685791f, 0.692276f, 0.6987915f, 0.7053375f,
+        0.71191406f, 0.7185211f, 0.7251587f, 0.7318268f, 0.7385254f, 0.7452545f, 0.75201416f, 0.7588043f,
+        0.765625f, 0.7724762f, 0.7793579f, 0.78627014f, 0.7932129f, 0.80018616f, 0.80718994f, 0.81422424f,
+        0.82128906f, 0.8283844f, 0.83551025f, 0.8426666f, 0.8498535f, 0.8570709f, 0.86431885f, 0.8715973f,
+        0.87890625f, 0.8862457f, 0.8936157f, 0.90101624f, 0.90844727f, 0.9159088f, 0.9234009f, 0.93092346f,
+        0.93847656f, 0.9460602f, 0.9536743f, 0.96131897f, 0.96899414f, 0.9766998f, 0.98443604f, 0.99220276f,
+        1.0f,
+      };
+      const float easeOutQuad[lut_size+1] =
+      {
+        0.0f, 0.007797241f, 0.015563965f, 0.02330017f, 0.03100586f, 0.03868103f, 0.046325684f, 0.05393982f,
+        0.061523438f, 0.06907654f, 0.07659912f, 0.08409119f, 0.091552734f, 0.098983765f, 0.10638428f, 0.11375427f,
+        0.12109375f, 0.12840271f, 0.13568115f, 0.14292908f, 0.15014648f, 0.15733337f, 0.16448975f, 0.1716156f,
+        0.17871094f, 0.18577576f, 0.19281006f, 0.19981384f, 0.20678711f, 0.21372986f, 0.22064209f, 0.2275238f,
+        0.234375f, 0.24119568f, 0.24798584f, 0.25474548f, 0.2614746f, 0.26817322f, 0.2748413f, 0.28147888f,
+        0.28808594f, 0.29466248f, 0.3012085f, 0.307724f, 0.31420898f, 0.32066345f, 0.3270874f, 0.33348083f,
+        0.33984375f, 0.34617615f, 0.35247803f, 0.3587494f, 0.36499023f, 0.37120056f, 0.37738037f, 0.38352966f,
+        0.38964844f, 0.3957367f, 0.40179443f, 0.40782166f, 0.41381836f, 0.41978455f, 0.4257202f, 0.43162537f,
+        0.4375f, 0.44334412f, 0.4491577f, 0.4549408f, 0.46069336f, 0.4664154f, 0.47210693f, 0.47776794f,
+        0.48339844f, 0.4889984f, 0.49456787f, 0.5001068f, 0.50561523f, 0.51109314f, 0.5165405f, 0.5219574f,
+        0.52734375f, 0.5326996f, 0.5380249f, 0.5433197f, 0.548584f, 0.55381775f, 0.559021f, 0.5641937f,
+        0.56933594f, 0.57444763f, 0.5795288f, 0.58457947f, 0.5895996f, 0.59458923f, 0.59954834f, 0.6044769f,
+        0.609375f, 0.61424255f, 0.6190796f, 0.6238861f, 0.6286621f, 0.6334076f, 0.63812256f, 0.642807f,
+        0.64746094f, 0.65208435f, 0.65667725f, 0.6612396f, 0.6657715f, 0.6702728f, 0.67474365f, 0.67918396f,
+        0.68359375f, 0.687973f, 0.6923218f, 0.69664f, 0.70092773f, 0.70518494f, 0.7094116f, 0.7136078f,
+        0.71777344f, 0.72190857f, 0.7260132f, 0.7300873f, 0.73413086f, 0.7381439f, 0.74212646f, 0.7460785f,
+        0.75f, 0.753891f, 0.75775146f, 0.7615814f, 0.76538086f, 0.7691498f, 0.7728882f, 0.77659607f,
+        0.78027344f, 0.7839203f, 0.7875366f, 0.79112244f, 0.79467773f, 0.7982025f, 0.8016968f, 0.8051605f,
+        0.80859375f, 0.81199646f, 0.81536865f, 0.8187103f, 0.8220215f, 0.8253021f, 0.82855225f, 0.83177185f,
+        0.83496094f, 0.8381195f, 0.84124756f, 0.8443451f, 0.8474121f, 0.8504486f, 0.8534546f, 0.85643005f,
+        0.859375f, 0.8622894f, 0.86517334f, 0.86802673f, 0.8708496f, 0.87364197f, 0.8764038f, 0.87913513f,
+        0.88183594f, 0.8845062f, 0.887146f, 0.88975525f, 0.892334f, 0.8948822f, 0.8973999f, 0.8998871f,
+        0.90234375f, 0.9047699f, 0.9071655f, 0.90953064f, 0.91186523f, 0.9141693f, 0.9164429f, 0.9186859f,
+        0.92089844f, 0.92308044f, 0.92523193f, 0.9273529f, 0.92944336f, 0.9315033f, 0.9335327f, 0.9355316f,
+        0.9375f, 0.93943787f, 0.9413452f, 0.94322205f, 0.94506836f, 0.94688416f, 0.94866943f, 0.9504242f,
+        0.95214844f, 0.95384216f, 0.9555054f, 0.95713806f, 0.95874023f, 0.9603119f, 0.961853f, 0.96336365f,
+        0.96484375f, 0.96629333f, 0.9677124f, 0.96910095f, 0.970459f, 0.9717865f, 0.9730835f, 0.97435f,
+        0.97558594f, 0.9767914f, 0.9779663f, 0.9791107f, 0.9802246f, 0.981308f, 0.98236084f, 0.9833832f,
+        0.984375f, 0.9853363f, 0.9862671f, 0.98716736f, 0.9880371f, 0.98887634f, 0.98968506f, 0.99046326f,
+        0.99121094f, 0.9919281f, 0.99261475f, 0.9932709f, 0.9938965f, 0.9944916f, 0.99505615f, 0.9955902f,
+        0.99609375f, 0.9965668f, 0.9970093f, 0.99742126f, 0.99780273f, 0.9981537f, 0.9984741f, 0.99876404f,
+        0.99902344f, 0.9992523f, 0.9994507f, 0.99961853f, 0.99975586f, 0.9998627f, 0.99993896f, 0.99998474f,
+        1.0f,
+      };
+      const float easeInOutQuad[lut_size+1] =
+      {
+        0.0f, 3.0517578e-05f, 0.00012207031f, 0.0002746582f, 0.00048828125f, 0.00076293945f, 0.0010986328f, 0.0014953613f,
+        0.001953125f, 0.0024719238f, 0.0030517578f, 0.003692627f, 0.0043945312f, 0.0051574707f, 0.0059814453f, 0.006866455f,
+        0.0078125f, 0.00881958f, 0.009887695f, 0.011016846f, 0.012207031f, 0.013458252f, 0.014770508f, 0.016143799f,
+        0.017578125f, 0.019073486f, 0.020629883f, 0.022247314f, 0.023925781f, 0.025665283f, 0.02746582f, 0.029327393f,
+        0.03125f, 0.033233643f, 0.03527832f, 0.037384033f, 0.03955078f, 0.041778564f, 0.044067383f, 0.046417236f,
+        0.048828125f, 0.05130005f, 0.053833008f, 0.056427002f, 0.05908203f, 0.061798096f, 0.064575195f, 0.06741333f,
+        0.0703125f, 0.073272705f, 0.076293945f, 0.07937622f, 0.08251953f, 0.08572388f, 0.08898926f, 0.092315674f,
+        0.095703125f, 0.09915161f, 0.10266113f, 0.10623169f, 0.10986328f, 0.11355591f, 0.11730957f, 0.12112427f,
+        0.125f, 0.12893677f, 0.13293457f, 0.13699341f, 0.14111328f, 0.14529419f, 0.14953613f, 0.15383911f,
+        0.15820312f, 0.16262817f, 0.16711426f, 0.17166138f, 0.17626953f, 0.18093872f, 0.18566895f, 0.1904602f,
+        0.1953125f, 0.20022583f, 0.2052002f, 0.2102356f, 0.21533203f, 0.2204895f, 0.22570801f, 0.23098755f,
+        0.23632812f, 0.24172974f, 0.24719238f, 0.25271606f, 0.25830078f, 0.26394653f, 0.26965332f, 0.27542114f,
+        0.28125f, 0.2871399f, 0.29309082f, 0.29910278f, 0.30517578f, 0.3113098f, 0.31750488f, 0.323761f,
+        0.33007812f, 0.3364563f, 0.3428955f, 0.34939575f, 0.35595703f, 0.36257935f, 0.3692627f, 0.37600708f,
+        0.3828125f, 0.38967896f, 0.39660645f, 0.40359497f, 0.41064453f, 0.41775513f, 0.42492676f, 0.43215942f,
+        0.43945312f, 0.44680786f, 0.45422363f, 0.46170044f, 0.46923828f, 0.47683716f, 0.48449707f, 0.49221802f,
+        0.5f, 0.507782f, 0.5155029f, 0.52316284f, 0.5307617f, 0.53829956f, 0.54577637f, 0.55319214f,
+        0.5605469f, 0.5678406f, 0.57507324f, 0.5822449f, 0.58935547f, 0.596405f, 0.60339355f, 0.61032104f,
+        0.6171875f, 0.6239929f, 0.6307373f, 0.63742065f, 0.64404297f, 0.65060425f, 0.6571045f, 0.6635437f,
+        0.6699219f, 0.676239f, 0.6824951f, 0.6886902f, 0.6948242f, 0.7008972f, 0.7069092f, 0.7128601f,
+        0.71875f, 0.72457886f, 0.7303467f, 0.73605347f, 0.7416992f, 0.74728394f, 0.7528076f, 0.75827026f,
+        0.7636719f, 0.76901245f, 0.774292f, 0.7795105f, 0.78466797f, 0.7897644f, 0.7947998f, 0.79977417f,
+        0.8046875f, 0.8095398f, 0.81433105f, 0.8190613f, 0.82373047f, 0.8283386f, 0.83288574f, 0.8373718f,
+        0.8417969f, 0.8461609f, 0.85046387f, 0.8547058f, 0.8588867f, 0.8630066f, 0.8670654f, 0.87106323f,
+        0.875f, 0.87887573f, 0.8826904f, 0.8864441f, 0.8901367f, 0.8937683f, 0.89733887f, 0.9008484f,
+        0.9042969f, 0.9076843f, 0.91101074f, 0.9142761f, 0.91748047f, 0.9206238f, 0.92370605f, 0.9267273f,
+        0.9296875f, 0.93258667f, 0.9354248f, 0.9382019f, 0.94091797f, 0.943573f, 0.946167f, 0.94869995f,
+        0.9511719f, 0.95358276f, 0.9559326f, 0.95822144f, 0.9604492f, 0.96261597f, 0.9647217f, 0.96676636f,
+        0.96875f, 0.9706726f, 0.9725342f, 0.9743347f, 0.9760742f, 0.9777527f, 0.9793701f, 0.9809265f,
+        0.9824219f, 0.9838562f, 0.9852295f, 0.98654175f, 0.98779297f, 0.98898315f, 0.9901123f, 0.9911804f,
+        0.9921875f, 0.99313354f, 0.99401855f, 0.9948425f, 0.99560547f, 0.9963074f, 0.99694824f, 0.9975281f,
+        0.9980469f, 0.99850464f, 0.99890137f, 0.99923706f, 0.9995117f, 0.99972534f, 0.9998779f, 0.9999695f,
+        1.0f,
+      };
+      const float easeInCubic[lut_size+1] =
+      {
+        0.0f, 5.9604645e-08f, 4.7683716e-07f, 1.6093254e-06f, 3.8146973e-06f, 7.4505806e-06f, 1.2874603e-05f, 2.0444393e-05f,
+        3.0517578e-05f, 4.3451786e-05f, 5.9604645e-05f, 7.933378e-05f, 0.000102996826f, 0.0001309514f, 0.00016355515f, 0.00020116568f,
+        0.00024414062f, 0.00029283762f, 0.0003476143f, 0.00040882826f, 0.00047683716f, 0.0005519986f, 0.00063467026f, 0.0007252097f,
+        0.0008239746f, 0.0009313226f, 0.0010476112f, 0.0011731982f, 0.0013084412f, 0.0014536977f, 0.0016093254f, 0.001775682f,
+        0.001953125f, 0.0021420121f, 0.002342701f, 0.0025555491f, 0.0027809143f, 0.003019154f, 0.003270626f, 0.003535688f,
+        0.0038146973f, 0.0041080117f, 0.004415989f, 0.0047389865f, 0.005077362f, 0.0054314733f, 0.0058016777f, 0.006188333f,
+        0.006591797f, 0.007012427f, 0.0074505806f, 0.007906616f, 0.00838089f, 0.008873761f, 0.009385586f, 0.009916723f,
+        0.010467529f, 0.011038363f, 0.011629581f, 0.012241542f, 0.012874603f, 0.013529122f, 0.014205456f, 0.014903963f,
+        0.015625f, 0.016368926f, 0.017136097f, 0.017926872f, 0.018741608f, 0.019580662f, 0.020444393f, 0.021333158f,
+        0.022247314f, 0.02318722f, 0.024153233f, 0.02514571f, 0.026165009f, 0.027211487f, 0.028285503f, 0.029387414f,
+        0.030517578f, 0.031676352f, 0.032864094f, 0.03408116f, 0.03532791f, 0.036604702f, 0.037911892f, 0.039249837f,
+        0.040618896f, 0.042019427f, 0.043451786f, 0.04491633f, 0.04641342f, 0.047943413f, 0.049506664f, 0.051103532f,
+        0.052734375f, 0.05439955f, 0.056099415f, 0.057834327f, 0.059604645f, 0.061410725f, 0.063252926f, 0.065131605f,
+        0.06704712f, 0.06899983f, 0.070990086f, 0.07301825f, 0.07508469f, 0.07718974f, 0.07933378f, 0.08151716f,
+        0.083740234f, 0.08600336f, 0.088306904f, 0.090651214f, 0.09303665f, 0.095463574f, 0.09793234f, 0.1004433f,
+        0.102996826f, 0.105593264f, 0.108232975f, 0.11091632f, 0.113643646f, 0.11641532f, 0.1192317f, 0.12209314f,
+        0.125f, 0.12795264f, 0.1309514f, 0.13399667f, 0.13708878f, 0.1402281f, 0.14341497f, 0.14664978f,
+        0.14993286f, 0.15326458f, 0.1566453f, 0.16007537f, 0.16355515f, 0.16708499f, 0.17066526f, 0.17429632f,
+        0.17797852f, 0.18171221f, 0.18549776f, 0.18933553f, 0.19322586f, 0.19716913f, 0.20116568f, 0.20521587f,
+        0.20932007f, 0.21347862f, 0.2176919f, 0.22196025f, 0.22628403f, 0.2306636f, 0.23509932f, 0.23959154f,
+        0.24414062f, 0.24874693f, 0.25341082f, 0.25813264f, 0.26291275f, 0.26775151f, 0.2726493f, 0.27760643f,
+        0.2826233f, 0.28770024f, 0.29283762f, 0.2980358f, 0.30329514f, 0.30861598f, 0.3139987f, 0.31944364f,
+        0.32495117f, 0.33052164f, 0.3361554f, 0.34185284f, 0.3476143f, 0.3534401f, 0.35933065f, 0.3652863f,
+        0.37130737f, 0.37739426f, 0.3835473f, 0.38976687f, 0.3960533f, 0.402407f, 0.40882826f, 0.41531748f,
+        0.421875f, 0.4285012f, 0.4351964f, 0.441961f, 0.44879532f, 0.45569974f, 0.46267462f, 0.4697203f,
+        0.47683716f, 0.48402554f, 0.4912858f, 0.4986183f, 0.5060234f, 0.51350147f, 0.52105284f, 0.5286779f,
+        0.53637695f, 0.5441504f, 0.5519986f, 0.5599219f, 0.5679207f, 0.57599527f, 0.584146f, 0.5923733f,
+        0.6006775f, 0.6090589f, 0.61751795f, 0.62605494f, 0.63467026f, 0.64336425f, 0.6521373f, 0.6609897f,
+        0.6699219f, 0.67893416f, 0.6880269f, 0.6972005f, 0.70645523f, 0.7157915f, 0.7252097f, 0.73471016f,
+        0.7442932f, 0.75395924f, 0.7637086f, 0.7735416f, 0.7834587f, 0.7934602f, 0.8035464f, 0.8137178f,
+        0.8239746f, 0.83431727f, 0.8447461f, 0.8552615f, 0.8658638f, 0.87655336f, 0.88733053f, 0.8981957f,
+        0.90914917f, 0.92019135f, 0.9313226f, 0.9425432f, 0.9538536f, 0.9652541f, 0.9767451f, 0.98832697f,
+        1.0f,
+      };
+      const float easeOutCubic[lut_size+1] =
+      {
+        0.0f, 0.011673033f, 0.023254871f, 0.034745872f, 0.046146393f, 0.05745679f, 0.068677425f, 0.07980865f,
+        0.09085083f, 0.101804316f, 0.11266947f, 0.12344664f, 0.1341362f, 0.1447385f, 0.15525389f, 0.16568273f,
+        0.17602539f, 0.18628222f, 0.19645357f, 0.20653981f, 0.21654129f, 0.22645837f, 0.23629141f, 0.24604076f,
+        0.2557068f, 0.26528984f, 0.2747903f, 0.28420848f, 0.29354477f, 0.30279952f, 0.3119731f, 0.32106584f,
+        0.33007812f, 0.3390103f, 0.34786272f, 0.35663575f, 0.36532974f, 0.37394506f, 0.38248205f, 0.39094108f,
+        0.3993225f, 0.4076267f, 0.41585398f, 0.42400473f, 0.43207932f, 0.44007808f, 0.44800138f, 0.4558496f,
+        0.46362305f, 0.47132212f, 0.47894716f, 0.48649853f, 0.4939766f, 0.5013817f, 0.5087142f, 0.51597446f,
+        0.52316284f, 0.5302797f, 0.5373254f, 0.54430026f, 0.5512047f, 0.558039f, 0.5648036f, 0.5714988f,
+        0.578125f, 0.5846825f, 0.59117174f, 0.597593f, 0.6039467f, 0.6102331f, 0.6164527f, 0.62260574f,
+        0.6286926f, 0.6347137f, 0.64066935f, 0.6465599f, 0.6523857f, 0.65814716f, 0.6638446f, 0.66947836f,
+        0.6750488f, 0.68055636f, 0.6860013f, 0.691384f, 0.69670486f, 0.7019642f, 0.7071624f, 0.71229976f,
+        0.7173767f, 0.7223936f, 0.7273507f, 0.7322485f, 0.73708725f, 0.74186736f, 0.7465892f, 0.75125307f,
+        0.7558594f, 0.76040846f, 0.7649007f, 0.7693364f, 0.773716f, 0.77803975f, 0.7823081f, 0.7865214f,
+        0.79067993f, 0.7947841f, 0.7988343f, 0.8028309f, 0.80677414f, 0.8106645f, 0.81450224f, 0.8182878f,
+        0.8220215f, 0.8257037f, 0.82933474f, 0.832915f, 0.83644485f, 0.83992463f, 0.8433547f, 0.8467354f,
+        0.85006714f, 0.8533502f, 0.856585f, 0.8597719f, 0.8629112f, 0.86600333f, 0.8690486f, 0.87204736f,
+        0.875f, 0.87790686f, 0.8807683f, 0.8835847f, 0.88635635f, 0.8890837f, 0.891767f, 0.89440674f,
+        0.8970032f, 0.8995567f, 0.90206766f, 0.9045364f, 0.90696335f, 0.9093488f, 0.9116931f, 0.91399664f,
+        0.91625977f, 0.91848284f, 0.9206662f, 0.92281026f, 0.9249153f, 0.92698175f, 0.9290099f, 0.9310002f,
+        0.9329529f, 0.9348684f, 0.9367471f, 0.9385893f, 0.94039536f, 0.9421657f, 0.9439006f, 0.94560045f,
+        0.9472656f, 0.94889647f, 0.95049334f, 0.9520566f, 0.9535866f, 0.95508367f, 0.9565482f, 0.9579806f,
+        0.9593811f, 0.96075016f, 0.9620881f, 0.9633953f, 0.9646721f, 0.96591884f, 0.9671359f, 0.96832365f,
+        0.9694824f, 0.9706126f, 0.9717145f, 0.9727885f, 0.973835f, 0.9748543f, 0.97584677f, 0.9768128f,
+        0.9777527f, 0.97866684f, 0.9795556f, 0.98041934f, 0.9812584f, 0.9820731f, 0.9828639f, 0.9836311f,
+        0.984375f, 0.98509604f, 0.98579454f, 0.9864709f, 0.9871254f, 0.98775846f, 0.9883704f, 0.98896164f,
+        0.9895325f, 0.9900833f, 0.9906144f, 0.99112624f, 0.9916191f, 0.9920934f, 0.9925494f, 0.9929876f,
+        0.9934082f, 0.99381167f, 0.9941983f, 0.9945685f, 0.99492264f, 0.995261f, 0.995584f, 0.995892f,
+        0.9961853f, 0.9964643f, 0.9967294f, 0.99698085f, 0.9972191f, 0.99744445f, 0.9976573f, 0.997858f,
+        0.9980469f, 0.9982243f, 0.9983907f, 0.9985463f, 0.99869156f, 0.9988268f, 0.9989524f, 0.9990687f,
+        0.999176f, 0.9992748f, 0.9993653f, 0.999448f, 0.99952316f, 0.9995912f, 0.9996524f, 0.99970716f,
+        0.99975586f, 0.99979883f, 0.99983644f, 0.99986905f, 0.999897f, 0.99992067f, 0.9999404f, 0.99995655f,
+        0.9999695f, 0.99997956f, 0.9999871f, 0.99999255f, 0.9999962f, 0.9999984f, 0.9999995f, 0.99999994f,
+        1.0f,
+      };
+      const float easeInOutCubic[lut_size+1] =
+      {
+        0.0f, 2.3841858e-07f, 1.9073486e-06f, 6.4373016e-06f, 1.5258789e-05f, 2.9802322e-05f, 5.1498413e-05f, 8.177757e-05f,
+        0.00012207031f, 0.00017380714f, 0.00023841858f, 0.00031733513f, 0.0004119873f, 0.0005238056f, 0.0006542206f, 0.0008046627f,
+        0.0009765625f, 0.0011713505f, 0.0013904572f, 0.001635313f, 0.0019073486f, 0.0022079945f, 0.002538681f, 0.0029008389f,
+        0.0032958984f, 0.0037252903f, 0.004190445f, 0.004692793f, 0.0052337646f, 0.0058147907f, 0.0064373016f, 0.007102728f,
+        0.0078125f, 0.0085680485f, 0.009370804f, 0.010222197f, 0.011123657f, 0.012076616f, 0.013082504f, 0.014142752f,
+        0.015258789f, 0.016432047f, 0.017663956f, 0.018955946f, 0.020309448f, 0.021725893f, 0.02320671f, 0.024753332f,
+        0.026367188f, 0.028049707f, 0.029802322f, 0.031626463f, 0.03352356f, 0.035495043f, 0.037542343f, 0.03966689f,
+        0.041870117f, 0.044153452f, 0.046518326f, 0.04896617f, 0.051498413f, 0.054116488f, 0.056821823f, 0.05961585f,
+        0.0625f, 0.0654757f, 0.06854439f, 0.07170749f, 0.07496643f, 0.07832265f, 0.08177757f, 0.08533263f,
+        0.08898926f, 0.09274888f, 0.09661293f, 0.10058284f, 0.104660034f, 0.10884595f, 0.11314201f, 0.11754966f,
+        0.12207031f, 0.12670541f, 0.13145638f, 0.13632464f, 0.14131165f, 0.14641881f, 0.15164757f, 0.15699935f,
+        0.16247559f, 0.1680777f, 0.17380714f, 0.17966533f, 0.18565369f, 0.19177365f, 0.19802666f, 0.20441413f,
+        0.2109375f, 0.2175982f, 0.22439766f, 0.23133731f, 0.23841858f, 0.2456429f, 0.2530117f, 0.26052642f,
+        0.26818848f, 0.2759993f, 0.28396034f, 0.292073f, 0.30033875f, 0.30875897f, 0.31733513f, 0.32606864f,
+        0.33496094f, 0.34401345f, 0.35322762f, 0.36260486f, 0.3721466f, 0.3818543f, 0.39172935f, 0.4017732f,
+        0.4119873f, 0.42237306f, 0.4329319f, 0.44366527f, 0.45457458f, 0.4656613f, 0.4769268f, 0.48837256f,
+        0.5f, 0.51162744f, 0.5230732f, 0.5343387f, 0.5454254f, 0.55633473f, 0.5670681f, 0.57762694f,
+        0.5880127f, 0.5982268f, 0.60827065f, 0.6181457f, 0.6278534f, 0.63739514f, 0.6467724f, 0.65598655f,
+        0.66503906f, 0.67393136f, 0.6826649f, 0.691241f, 0.69966125f, 0.707927f, 0.71603966f, 0.7240007f,
+        0.7318115f, 0.7394736f, 0.7469883f, 0.7543571f, 0.7615814f, 0.7686627f, 0.77560234f, 0.7824018f,
+        0.7890625f, 0.7955859f, 0.80197334f, 0.80822635f, 0.8143463f, 0.8203347f, 0.82619286f, 0.8319223f,
+        0.8375244f, 0.84300065f, 0.84835243f, 0.8535812f, 0.85868835f, 0.86367536f, 0.8685436f, 0.8732946f,
+        0.8779297f, 0.88245034f, 0.886858f, 0.89115405f, 0.89533997f, 0.89941716f, 0.90338707f, 0.9072511f,
+        0.91101074f, 0.91466737f, 0.9182224f, 0.92167735f, 0.92503357f, 0.9282925f, 0.9314556f, 0.9345243f,
+        0.9375f, 0.94038415f, 0.9431782f, 0.9458835f, 0.9485016f, 0.95103383f, 0.9534817f, 0.95584655f,
+        0.9581299f, 0.9603331f, 0.96245766f, 0.96450496f, 0.96647644f, 0.96837354f, 0.9701977f, 0.9719503f,
+        0.9736328f, 0.97524667f, 0.9767933f, 0.9782741f, 0.97969055f, 0.98104405f, 0.98233604f, 0.98356795f,
+        0.9847412f, 0.98585725f, 0.9869175f, 0.9879234f, 0.98887634f, 0.9897778f, 0.9906292f, 0.99143195f,
+        0.9921875f, 0.9928973f, 0.9935627f, 0.9941852f, 0.99476624f, 0.9953072f, 0.99580956f, 0.9962747f,
+        0.9967041f, 0.99709916f, 0.9974613f, 0.997792f, 0.99809265f, 0.9983647f, 0.99860954f, 0.99882865f,
+        0.99902344f, 0.99919534f, 0.9993458f, 0.9994762f, 0.999588f, 0.99968266f, 0.9997616f, 0.9998262f,
+        0.9998779f, 0.9999182f, 0.9999485f, 0.9999702f, 0.99998474f, 0.99999356f, 0.9999981f, 0.99999976f,
+        1.0f,
+      };
+      const float easeInQuart[lut_size+1] =
+      {
+        0.0f, 2.3283064e-10f, 3.7252903e-09f, 1.8859282e-08f, 5.9604645e-08f, 1.4551915e-07f, 3.017485e-07f, 5.590264e-07f,
+        9.536743e-07f, 1.5276019e-06f, 2.3283064e-06f, 3.4088735e-06f, 4.827976e-06f, 6.649876e-06f, 8.944422e-06f, 1.1787051e-05f,
+        1.5258789e-05f, 1.9446248e-05f, 2.444163e-05f, 3.0342722e-05f, 3.7252903e-05f, 4.5281136e-05f, 5.4541975e-05f, 6.515556e-05f,
+        7.724762e-05f, 9.094947e-05f, 0.000106398016f, 0.00012373575f, 0.00014311075f, 0.00016467669f, 0.00018859282f, 0.00021502399f,
+        0.00024414062f, 0.00027611875f, 0.00031113997f, 0.00034939148f, 0.00039106607f, 0.0004363621f, 0.00048548356f, 0.00053863996f,
+        0.00059604645f, 0.00065792375f, 0.0007244982f, 0.00079600164f, 0.0008726716f, 0.00095475116f, 0.001042489f, 0.0011361393f,
+        0.0012359619f, 0.0013422223f, 0.0014551915f, 0.0015751461f, 0.0017023683f, 0.0018371458f, 0.001979772f, 0.002130546f,
+        0.002289772f, 0.0024577605f, 0.002634827f, 0.002821293f, 0.0030174851f, 0.003223736f, 0.0034403838f, 0.003667772f,
+        0.00390625f, 0.0041561723f, 0.0044179f, 0.0046917982f, 0.0049782395f, 0.0052776f, 0.0055902638f, 0.005916618f,
+        0.006257057f, 0.0066119805f, 0.006981794f, 0.007366907f, 0.007767737f, 0.008184705f, 0.008618239f, 0.009068772f,
+        0.009536743f, 0.0100225955f, 0.01052678f, 0.011049751f, 0.011591971f, 0.012153905f, 0.012736026f, 0.013338812f,
+        0.013962746f, 0.014608316f, 0.0152760185f, 0.015966352f, 0.016679823f, 0.017416943f, 0.018178228f, 0.018964201f,
+        0.01977539f, 0.02061233f, 0.021475557f, 0.022365618f, 0.023283064f, 0.02422845f, 0.025202338f, 0.026205294f,
+        0.027237892f, 0.02830071f, 0.029394332f, 0.030519348f, 0.031676352f, 0.032865945f, 0.034088735f, 0.03534533f,
+        0.036636353f, 0.03796242f, 0.039324168f, 0.040722225f, 0.042157233f, 0.043629836f, 0.045140687f, 0.04669044f,
+        0.048279762f, 0.049909316f, 0.051579777f, 0.053291824f, 0.05504614f, 0.05684342f, 0.058684353f, 0.060569644f,
+        0.0625f, 0.06447613f, 0.06649876f, 0.06856861f, 0.0706864f, 0.07285288f, 0.07506877f, 0.07733484f,
+        0.07965183f, 0.0820205f, 0.0844416f, 0.086915925f, 0.08944422f, 0.092027284f, 0.094665885f, 0.097360834f,
+        0.100112915f, 0.10292293f, 0.10579169f, 0.10872001f, 0.1117087f, 0.114758596f, 0.11787051f, 0.1210453f,
+        0.12428379f, 0.12758684f, 0.13095528f, 0.13439f, 0.13789183f, 0.14146166f, 0.14510036f, 0.1488088f,
+        0.15258789f, 0.1564385f, 0.16036153f, 0.16435789f, 0.16842848f, 0.17257422f, 0.17679602f, 0.18109483f,
+        0.18547153f, 0.18992712f, 0.19446248f, 0.1990786f, 0.20377642f, 0.20855689f, 0.21342099f, 0.21836968f,
+        0.22340393f, 0.22852473f, 0.23373306f, 0.23902991f, 0.2444163f, 0.2498932f, 0.25546163f, 0.2611226f,
+        0.26687717f, 0.27272633f, 0.2786711f, 0.28471252f, 0.29085165f, 0.29708955f, 0.30342722f, 0.30986577f,
+        0.31640625f, 0.32304972f, 0.32979727f, 0.33664998f, 0.34360892f, 0.3506752f, 0.3578499f, 0.36513415f,
+        0.37252903f, 0.38003567f, 0.3876552f, 0.39538872f, 0.4032374f, 0.41120234f, 0.4192847f, 0.42748564f,
+        0.43580627f, 0.4442478f, 0.45281136f, 0.46149814f, 0.47030932f, 0.47924605f, 0.48830956f, 0.49750102f,
+        0.50682163f, 0.5162726f, 0.5258551f, 0.53557044f, 0.54541975f, 0.5554043f, 0.5655253f, 0.575784f,
+        0.58618164f, 0.5967195f, 0.60739875f, 0.61822075f, 0.6291867f, 0.6402979f, 0.6515556f, 0.6629611f,
+        0.6745157f, 0.6862207f, 0.6980774f, 0.71008706f, 0.722251f, 0.73457056f, 0.74704707f, 0.7596818f,
+        0.7724762f, 0.7854315f, 0.79854906f, 0.8118303f, 0.82527643f, 0.83888894f, 0.8526692f, 0.8666185f,
+        0.88073826f, 0.89502984f, 0.9094947f, 0.92413414f, 0.93894964f, 0.95394254f, 0.9691143f, 0.9844663f,
+        1.0f,
+      };
+      const float easeOutQuart[lut_size+1] =
+      {
+        0.0f, 0.015533686f, 0.030885693f, 0.046057444f, 0.061050355f, 0.075865835f, 0.0905053f, 0.104970135f,
+        0.11926174f, 0.1333815f, 0.14733082f, 0.16111104f, 0.17472357f, 0.18816975f, 0.20145094f, 0.21456851f,
+        0.2275238f, 0.24031816f, 0.25295293f, 0.26542944f, 0.277749f, 0.28991297f, 0.30192262f, 0.3137793f,
+        0.32548428f, 0.33703887f, 0.3484444f, 0.3597021f, 0.3708133f, 0.38177925f, 0.39260125f, 0.40328053f,
+        0.41381836f, 0.424216f, 0.4344747f, 0.4445957f, 0.45458025f, 0.46442956f, 0.47414488f, 0.4837274f,
+        0.49317837f, 0.502499f, 0.51169044f, 0.5207539f, 0.5296907f, 0.53850186f, 0.54718864f, 0.5557522f,
+        0.5641937f, 0.57251436f, 0.5807153f, 0.5887976f, 0.5967626f, 0.6046113f, 0.6123448f, 0.6199643f,
+        0.62747097f, 0.6348659f, 0.6421501f, 0.64932483f, 0.6563911f, 0.66335005f, 0.67020273f, 0.6769503f,
+        0.68359375f, 0.6901342f, 0.6965728f, 0.7029105f, 0.70914835f, 0.7152875f, 0.7213289f, 0.7272737f,
+        0.7331228f, 0.73887736f, 0.74453837f, 0.7501068f, 0.7555837f, 0.76097006f, 0.76626694f, 0.77147526f,
+        0.77659607f, 0.78163034f, 0.786579f, 0.7914431f, 0.7962236f, 0.8009214f, 0.8055375f, 0.8100729f,
+        0.81452847f, 0.8189052f, 0.823204f, 0.8274258f, 0.8315715f, 0.8356421f, 0.8396385f, 0.8435615f,
+        0.8474121f, 0.85119116f, 0.85489964f, 0.8585383f, 0.8621082f, 0.86561f, 0.8690447f, 0.87241316f,
+        0.8757162f, 0.8789547f, 0.8821295f, 0.8852414f, 0.8882913f, 0.89128f, 0.8942083f, 0.8970771f,
+        0.8998871f, 0.90263915f, 0.9053341f, 0.9079727f, 0.9105558f, 0.9130841f, 0.9155584f, 0.9179795f,
+        0.92034817f, 0.9226652f, 0.9249312f, 0.92714715f, 0.9293136f, 0.9314314f, 0.93350124f, 0.93552387f,
+        0.9375f, 0.93943036f, 0.94131565f, 0.9431566f, 0.94495386f, 0.9467082f, 0.9484202f, 0.9500907f,
+        0.95172024f, 0.95330954f, 0.9548593f, 0.9563702f, 0.95784277f, 0.95927775f, 0.96067584f, 0.96203756f,
+        0.96336365f, 0.9646547f, 0.96591127f, 0.96713406f, 0.96832365f, 0.96948063f, 0.9706057f, 0.9716993f,
+        0.9727621f, 0.9737947f, 0.97479767f, 0.97577155f, 0.97671694f, 0.9776344f, 0.97852445f, 0.97938764f,
+        0.9802246f, 0.98103577f, 0.9818218f, 0.98258305f, 0.9833202f, 0.98403364f, 0.984724f, 0.9853917f,
+        0.98603725f, 0.9866612f, 0.987264f, 0.9878461f, 0.988408f, 0.98895025f, 0.9894732f, 0.9899774f,
+        0.99046326f, 0.9909312f, 0.99138176f, 0.99181527f, 0.99223226f, 0.9926331f, 0.9930182f, 0.993388f,
+        0.99374294f, 0.9940834f, 0.99440974f, 0.9947224f, 0.99502176f, 0.9953082f, 0.9955821f, 0.9958438f,
+        0.99609375f, 0.9963322f, 0.9965596f, 0.9967763f, 0.9969825f, 0.99717873f, 0.9973652f, 0.99754226f,
+        0.9977102f, 0.99786943f, 0.99802023f, 0.99816287f, 0.99829763f, 0.9984248f, 0.9985448f, 0.99865776f,
+        0.99876404f, 0.9988639f, 0.9989575f, 0.99904525f, 0.9991273f, 0.999204f, 0.9992755f, 0.9993421f,
+        0.99940395f, 0.99946135f, 0.9995145f, 0.99956363f, 0.99960893f, 0.9996506f, 0.99968886f, 0.99972385f,
+        0.99975586f, 0.99978495f, 0.9998114f, 0.9998353f, 0.9998569f, 0.99987626f, 0.9998936f, 0.99990904f,
+        0.99992275f, 0.99993485f, 0.99994546f, 0.9999547f, 0.99996275f, 0.99996966f, 0.99997556f, 0.99998057f,
+        0.99998474f, 0.9999882f, 0.99999106f, 0.9999933f, 0.9999952f, 0.9999966f, 0.9999977f, 0.99999845f,
+        0.99999905f, 0.99999946f, 0.9999997f, 0.9999999f, 0.99999994f, 1.0f, 1.0f, 1.0f,
+        1.0f,
+      };
+      const float easeInOutQuart[lut_size+1] =
+      {
+        0.0f, 1.8626451e-09f, 2.9802322e-08f, 1.5087426e-07f, 4.7683716e-07f, 1.1641532e-06f, 2.413988e-06f, 4.472211e-06f,
+        7.6293945e-06f, 1.2220815e-05f, 1.8626451e-05f, 2.7270988e-05f, 3.862381e-05f, 5.3199008e-05f, 7.1555376e-05f, 9.429641e-05f,
+        0.00012207031f, 0.00015556999f, 0.00019553304f, 0.00024274178f, 0.00029802322f, 0.0003622491f, 0.0004363358f, 0.0005212445f,
+        0.00061798096f, 0.00072759576f, 0.00085118413f, 0.000989886f, 0.001144886f, 0.0013174135f, 0.0015087426f, 0.0017201919f,
+        0.001953125f, 0.00220895f, 0.0024891198f, 0.0027951319f, 0.0031285286f, 0.003490897f, 0.0038838685f, 0.0043091197f,
+        0.0047683716f, 0.00526339f, 0.0057959855f, 0.006368013f, 0.006981373f, 0.0076380093f, 0.008339912f, 0.009089114f,
+        0.009887695f, 0.010737779f, 0.011641532f, 0.012601169f, 0.013618946f, 0.014697166f, 0.015838176f, 0.017044367f,
+        0.018318176f, 0.019662084f, 0.021078616f, 0.022570344f, 0.024139881f, 0.025789889f, 0.02752307f, 0.029342176f,
+        0.03125f, 0.03324938f, 0.0353432f, 0.037534386f, 0.039825916f, 0.0422208f, 0.04472211f, 0.047332942f,
+        0.050056458f, 0.052895844f, 0.05585435f, 0.058935255f, 0.062141895f, 0.06547764f, 0.068945915f, 0.07255018f,
+        0.076293945f, 0.080180764f, 0.08421424f, 0.08839801f, 0.09273577f, 0.09723124f, 0.10188821f, 0.10671049f,
+        0.111701965f, 0.11686653f, 0.12220815f, 0.12773082f, 0.13343859f, 0.13933554f, 0.14542583f, 0.15171361f,
+        0.15820312f, 0.16489863f, 0.17180446f, 0.17892495f, 0.18626451f, 0.1938276f, 0.2016187f, 0.20964235f,
+        0.21790314f, 0.22640568f, 0.23515466f, 0.24415478f, 0.25341082f, 0.26292756f, 0.27270988f, 0.28276265f,
+        0.29309082f, 0.30369937f, 0.31459334f, 0.3257778f, 0.33725786f, 0.3490387f, 0.3611255f, 0.37352353f,
+        0.3862381f, 0.39927453f, 0.41263822f, 0.4263346f, 0.44036913f, 0.45474735f, 0.46947482f, 0.48455715f,
+        0.5f, 0.51544285f, 0.5305252f, 0.5452526f, 0.5596309f, 0.5736654f, 0.5873618f, 0.6007255f,
+        0.6137619f, 0.62647647f, 0.63887453f, 0.6509613f, 0.66274214f, 0.6742222f, 0.6854067f, 0.6963006f,
+        0.7069092f, 0.71723735f, 0.72729015f, 0.7370724f, 0.7465892f, 0.7558452f, 0.7648454f, 0.7735943f,
+        0.78209686f, 0.79035765f, 0.7983813f, 0.8061724f, 0.8137355f, 0.821075f, 0.8281956f, 0.83510137f,
+        0.8417969f, 0.8482864f, 0.8545742f, 0.8606644f, 0.8665614f, 0.87226915f, 0.8777919f, 0.8831335f,
+        0.88829803f, 0.8932895f, 0.8981118f, 0.90276873f, 0.90726423f, 0.91160196f, 0.9157858f, 0.91981924f,
+        0.92370605f, 0.9274498f, 0.9310541f, 0.93452233f, 0.9378581f, 0.9410647f, 0.9441457f, 0.94710416f,
+        0.94994354f, 0.95266706f, 0.9552779f, 0.95777917f, 0.9601741f, 0.9624656f, 0.96465683f, 0.9667506f,
+        0.96875f, 0.9706578f, 0.97247696f, 0.9742101f, 0.9758601f, 0.9774296f, 0.9789214f, 0.9803379f,
+        0.9816818f, 0.98295563f, 0.98416185f, 0.9853028f, 0.98638105f, 0.9873988f, 0.9883585f, 0.9892622f,
+        0.9901123f, 0.9909109f, 0.9916601f, 0.99236196f, 0.9930186f, 0.99363196f, 0.99420404f, 0.9947366f,
+        0.9952316f, 0.9956909f, 0.99611616f, 0.9965091f, 0.9968715f, 0.99720484f, 0.9975109f, 0.99779105f,
+        0.9980469f, 0.9982798f, 0.9984913f, 0.99868256f, 0.9988551f, 0.9990101f, 0.99914885f, 0.9992724f,
+        0.999382f, 0.99947876f, 0.9995637f, 0.9996377f, 0.999702f, 0.99975723f, 0.9998045f, 0.99984443f,
+        0.9998779f, 0.9999057f, 0.9999285f, 0.9999468f, 0.9999614f, 0.9999727f, 0.9999814f, 0.9999878f,
+        0.9999924f, 0.9999955f, 0.9999976f, 0.9999988f, 0.9999995f, 0.9999998f, 1.0f, 1.0f,
+        1.0f,
+      };
+      const float easeInQuint[lut_size+1] =
+      {
+        0.0f, 9.094947e-13f, 2.910383e-11f, 2.2100721e-10f, 9.313226e-10f, 2.842171e-09f, 7.072231e-09f, 1.5285877e-08f,
+        2.9802322e-08f, 5.3704753e-08f, 9.094947e-08f, 1.4647503e-07f, 2.2631139e-07f, 3.3768902e-07f, 4.891481e-07f, 6.9064754e-07f,
+        9.536743e-07f, 1.2913524e-06f, 1.7185521e-06f, 2.251999e-06f, 2.910383e-06f, 3.7144682e-06f, 4.687201e-06f, 5.85382e-06f,
+        7.2419643e-06f, 8.881784e-06f, 1.08060485e-05f, 1.3050255e-05f, 1.5652739e-05f, 1.865478e-05f, 2.2100721e-05f, 2.6038062e-05f,
+        3.0517578e-05f, 3.559343e-05f, 4.1323277e-05f, 4.7768368e-05f, 5.4993667e-05f, 6.3067964e-05f, 7.2063965e-05f, 8.205843e-05f,
+        9.313226e-05f, 0.0001053706f, 0.00011886298f, 0.0001337034f, 0.00014999043f, 0.00016782735f, 0.00018732224f, 0.00020858807f,
+        0.00023174286f, 0.00025690976f, 0.0002842171f, 0.00031379864f, 0.00034579355f, 0.00038034658f, 0.00041760816f, 0.00045773448f,
+        0.00050088763f, 0.0005472357f, 0.000596953f, 0.00065021985f, 0.0007072231f, 0.00076815585f, 0.000833218f, 0.0009026158f,
+        0.0009765625f, 0.0010552782f, 0.0011389898f, 0.0012279316f, 0.0013223449f, 0.0014224782f, 0.0015285878f, 0.0016409371f,
+        0.0017597973f, 0.0018854477f, 0.0020181749f, 0.0021582735f, 0.002306047f, 0.002461806f, 0.0026258698f, 0.0027985666f,
+        0.0029802322f, 0.003171212f, 0.0033718592f, 0.0035825367f, 0.0038036155f, 0.004035476f, 0.004278509f, 0.004533112f,
+        0.004799694f, 0.0050786724f, 0.0053704754f, 0.0056755394f, 0.0059943115f, 0.0063272486f, 0.006674818f, 0.0070374967f,
+        0.0074157715f, 0.0078101405f, 0.008221112f, 0.008649204f, 0.009094947f, 0.009558881f, 0.010041556f, 0.010543536f,
+        0.011065394f, 0.011607713f, 0.012171091f, 0.012756133f, 0.013363461f, 0.013993704f, 0.014647503f, 0.015325515f,
+        0.016028404f, 0.016756851f, 0.017511543f, 0.018293187f, 0.019102495f, 0.0199402f, 0.020807035f, 0.02170376f,
+        0.022631139f, 0.02358995f, 0.024580987f, 0.025605056f, 0.026662976f, 0.027755575f, 0.028883705f, 0.030048221f,
+        0.03125f, 0.032489926f, 0.033768903f, 0.035087842f, 0.036447674f, 0.037849344f, 0.03929381f, 0.040782046f,
+        0.042315036f, 0.043893784f, 0.045519304f, 0.04719263f, 0.04891481f, 0.0506869f, 0.052509986f, 0.054385155f,
+        0.056313515f, 0.058296192f, 0.060334325f, 0.062429067f, 0.064581595f, 0.066793084f, 0.06906475f, 0.07139781f,
+        0.0737935f, 0.07625307f, 0.07877779f, 0.08136894f, 0.084027834f, 0.08675578f, 0.08955413f, 0.09242422f,
+        0.09536743f, 0.09838515f, 0.101478785f, 0.10464975f, 0.107899494f, 0.11122948f, 0.114641175f, 0.11813607f,
+        0.121715695f, 0.12538157f, 0.12913524f, 0.13297829f, 0.13691229f, 0.14093883f, 0.14505959f, 0.14927615f,
+        0.1535902f, 0.15800342f, 0.16251752f, 0.1671342f, 0.17185521f, 0.17668231f, 0.18161726f, 0.18666187f,
+        0.19181797f, 0.19708738f, 0.20247196f, 0.2079736f, 0.21359418f, 0.21933563f, 0.2251999f, 0.23118892f,
+        0.23730469f, 0.24354921f, 0.2499245f, 0.2564326f, 0.2630756f, 0.26985553f, 0.27677453f, 0.28383476f,
+        0.2910383f, 0.29838738f, 0.30588418f, 0.31353092f, 0.3213298f, 0.32928312f, 0.33739316f, 0.3456622f,
+        0.3540926f, 0.36268666f, 0.37144682f, 0.38037542f, 0.3894749f, 0.3987477f, 0.40819627f, 0.41782314f,
+        0.42763075f, 0.43762168f, 0.44779852f, 0.45816377f, 0.4687201f, 0.4794701f, 0.49041647f, 0.5015618f,
+        0.51290894f, 0.5244605f, 0.53621924f, 0.5481879f, 0.5603694f, 0.5727665f, 0.585382f, 0.5982188f,
+        0.61127985f, 0.62456805f, 0.6380864f, 0.6518377f, 0.6658251f, 0.6800517f, 0.6945203f, 0.70923424f,
+        0.72419643f, 0.7394101f, 0.7548784f, 0.7706045f, 0.7865916f, 0.8028429f, 0.8193618f, 0.8361514f,
+        0.8532152f, 0.8705564f, 0.8881784f, 0.90608466f, 0.92427856f, 0.94276357f, 0.9615431f, 0.98062074f,
+        1.0f,
+      };
+      const float easeOutQuint[lut_size+1] =
+      {
+        0.0f, 0.019379256f, 0.0384569f, 0.05723646f, 0.07572144f, 0.093915336f, 0.11182158f, 0.1294436f,
+        0.14678481f, 0.16384856f, 0.18063821f, 0.19715706f, 0.2134084f, 0.2293955f, 0.2451216f, 0.2605899f,
+        0.27580357f, 0.2907658f, 0.30547968f, 0.31994835f, 0.33417487f, 0.3481623f, 0.36191365f, 0.37543193f,
+        0.38872012f, 0.40178117f, 0.41461802f, 0.42723352f, 0.4396306f, 0.4518121f, 0.4637808f, 0.47553954f,
+        0.48709106f, 0.49843815f, 0.50958353f, 0.52052987f, 0.5312799f, 0.5418362f, 0.5522015f, 0.5623783f,
+        0.5723692f, 0.58217686f, 0.5918037f, 0.6012523f, 0.6105251f, 0.61962456f, 0.62855315f, 0.6373133f,
+        0.6459074f, 0.65433776f, 0.66260684f, 0.6707169f, 0.67867017f, 0.6864691f, 0.6941158f, 0.7016126f,
+        0.7089617f, 0.71616524f, 0.7232255f, 0.7301445f, 0.7369244f, 0.7435674f, 0.7500755f, 0.7564508f,
+        0.7626953f, 0.7688111f, 0.7748001f, 0.7806644f, 0.7864058f, 0.7920264f, 0.797528f, 0.8029126f,
+        0.808182f, 0.8133381f, 0.81838274f, 0.8233177f, 0.8281448f, 0.8328658f, 0.83748245f, 0.84199655f,
+        0.8464098f, 0.85072386f, 0.8549404f, 0.8590612f, 0.8630877f, 0.86702174f, 0.87086475f, 0.8746184f,
+        0.87828434f, 0.88186395f, 0.8853588f, 0.8887705f, 0.8921005f, 0.8953503f, 0.89852124f, 0.90161484f,
+        0.90463257f, 0.9075758f, 0.91044587f, 0.9132442f, 0.9159722f, 0.9186311f, 0.9212222f, 0.92374694f,
+        0.92620647f, 0.92860216f, 0.93093526f, 0.9332069f, 0.9354184f, 0.9375709f, 0.9396657f, 0.9417038f,
+        0.9436865f, 0.9456149f, 0.94749004f, 0.9493131f, 0.9510852f, 0.95280737f, 0.9544807f, 0.95610625f,
+        0.957685f, 0.95921797f, 0.9607062f, 0.96215063f, 0.9635523f, 0.9649122f, 0.9662311f, 0.96751004f,
+        0.96875f, 0.96995175f, 0.9711163f, 0.97224444f, 0.97333705f, 0.9743949f, 0.975419f, 0.97641003f,
+        0.97736883f, 0.9782962f, 0.979193f, 0.9800598f, 0.9808975f, 0.9817068f, 0.98248845f, 0.98324317f,
+        0.9839716f, 0.9846745f, 0.9853525f, 0.9860063f, 0.9866365f, 0.9872439f, 0.9878289f, 0.9883923f,
+        0.98893464f, 0.9894565f, 0.98995847f, 0.99044114f, 0.99090505f, 0.99135077f, 0.9917789f, 0.9921899f,
+        0.9925842f, 0.9929625f, 0.9933252f, 0.9936727f, 0.9940057f, 0.99432445f, 0.9946295f, 0.9949213f,
+        0.9952003f, 0.9954669f, 0.9957215f, 0.9959645f, 0.9961964f, 0.99641746f, 0.99662817f, 0.9968288f,
+        0.99701977f, 0.99720144f, 0.9973741f, 0.9975382f, 0.99769396f, 0.9978417f, 0.99798185f, 0.9981145f,
+        0.99824023f, 0.9983591f, 0.99847144f, 0.99857754f, 0.9986777f, 0.9987721f, 0.998861f, 0.9989447f,
+        0.99902344f, 0.9990974f, 0.9991668f, 0.9992318f, 0.9992928f, 0.9993498f, 0.99940306f, 0.99945277f,
+        0.9994991f, 0.99954224f, 0.9995824f, 0.99961966f, 0.99965423f, 0.9996862f, 0.9997158f, 0.9997431f,
+        0.99976826f, 0.9997914f, 0.99981266f, 0.99983215f, 0.99985003f, 0.9998663f, 0.99988115f, 0.9998946f,
+        0.9999069f, 0.9999179f, 0.99992794f, 0.99993694f, 0.999945f, 0.99995226f, 0.9999587f, 0.9999644f,
+        0.9999695f, 0.99997395f, 0.9999779f, 0.99998134f, 0.9999843f, 0.99998695f, 0.9999892f, 0.9999911f,
+        0.9999927f, 0.99999416f, 0.9999953f, 0.9999963f, 0.9999971f, 0.99999774f, 0.9999983f, 0.9999987f,
+        0.99999905f, 0.9999993f, 0.9999995f, 0.99999964f, 0.99999976f, 0.9999999f, 0.9999999f, 0.99999994f,
+        1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+        1.0f,
+      };
+      const float easeInOutQuint[lut_size+1] =
+      {
+        0.0f, 1.4551915e-11f, 4.656613e-10f, 3.5361154e-09f, 1.4901161e-08f, 4.5474735e-08f, 1.1315569e-07f, 2.4457404e-07f,
+        4.7683716e-07f, 8.5927604e-07f, 1.4551915e-06f, 2.3436005e-06f, 3.6209822e-06f, 5.4030243e-06f, 7.826369e-06f, 1.1050361e-05f,
+        1.5258789e-05f, 2.0661639e-05f, 2.7496833e-05f, 3.6031983e-05f, 4.656613e-05f, 5.943149e-05f, 7.4995216e-05f, 9.366112e-05f,
+        0.00011587143f, 0.00014210855f, 0.00017289678f, 0.00020880408f, 0.00025044382f, 0.0002984765f, 0.00035361154f, 0.000416609f,
+        0.00048828125f, 0.0005694949f, 0.00066117244f, 0.0007642939f, 0.00087989867f, 0.0010090874f, 0.0011530234f, 0.0013129349f,
+        0.0014901161f, 0.0016859296f, 0.0019018077f, 0.0021392545f, 0.002399847f, 0.0026852377f, 0.0029971558f, 0.003337409f,
+        0.0037078857f, 0.004110556f, 0.0045474735f, 0.005020778f, 0.005532697f, 0.0060855453f, 0.0066817305f, 0.0073237517f,
+        0.008014202f, 0.008755771f, 0.009551248f, 0.010403518f, 0.011315569f, 0.012290494f, 0.013331488f, 0.014441852f,
+        0.015625f, 0.016884452f, 0.018223837f, 0.019646905f, 0.021157518f, 0.022759652f, 0.024457404f, 0.026254993f,
+        0.028156757f, 0.030167162f, 0.032290798f, 0.034532376f, 0.03689675f, 0.039388895f, 0.042013917f, 0.044777066f,
+        0.047683716f, 0.050739393f, 0.053949747f, 0.057320587f, 0.060857847f, 0.06456762f, 0.06845614f, 0.07252979f,
+        0.0767951f, 0.08125876f, 0.085927606f, 0.09080863f, 0.095908985f, 0.10123598f, 0.10679709f, 0.11259995f,
+        0.118652344f, 0.12496225f, 0.1315378f, 0.13838726f, 0.14551915f, 0.15294209f, 0.1606649f, 0.16869658f,
+        0.1770463f, 0.18572341f, 0.19473745f, 0.20409814f, 0.21381538f, 0.22389926f, 0.23436005f, 0.24520823f,
+        0.25645447f, 0.26810962f, 0.2801847f, 0.292691f, 0.30563992f, 0.3190432f, 0.33291256f, 0.34726015f,
+        0.36209822f, 0.3774392f, 0.3932958f, 0.4096809f, 0.4266076f, 0.4440892f, 0.46213928f, 0.48077154f,
+        0.5f, 0.51922846f, 0.53786075f, 0.55591077f, 0.5733924f, 0.5903191f, 0.6067042f, 0.6225608f,
+        0.6379018f, 0.6527398f, 0.66708744f, 0.68095684f, 0.6943601f, 0.707309f, 0.7198153f, 0.7318904f,
+        0.74354553f, 0.75479174f, 0.76563996f, 0.77610075f, 0.7861846f, 0.79590183f, 0.80526257f, 0.8142766f,
+        0.8229537f, 0.8313034f, 0.8393351f, 0.8470579f, 0.85448086f, 0.86161274f, 0.8684622f, 0.8750377f,
+        0.88134766f, 0.88740003f, 0.8932029f, 0.898764f, 0.904091f, 0.90919137f, 0.9140724f, 0.9187412f,
+        0.9232049f, 0.9274702f, 0.9315439f, 0.9354324f, 0.93914217f, 0.9426794f, 0.9460502f, 0.9492606f,
+        0.9523163f, 0.95522296f, 0.95798606f, 0.9606111f, 0.96310323f, 0.96546763f, 0.9677092f, 0.96983284f,
+        0.97184324f, 0.973745f, 0.9755426f, 0.9772403f, 0.9788425f, 0.9803531f, 0.9817762f, 0.98311555f,
+        0.984375f, 0.98555815f, 0.9866685f, 0.9877095f, 0.9886844f, 0.9895965f, 0.9904488f, 0.99124426f,
+        0.9919858f, 0.99267626f, 0.99331826f, 0.9939144f, 0.9944673f, 0.9949792f, 0.9954525f, 0.9958894f,
+        0.9962921f, 0.9966626f, 0.99700284f, 0.99731475f, 0.99760014f, 0.9978607f, 0.9980982f, 0.9983141f,
+        0.9985099f, 0.9986871f, 0.99884695f, 0.9989909f, 0.9991201f, 0.9992357f, 0.9993388f, 0.9994305f,
+        0.9995117f, 0.99958336f, 0.99964637f, 0.9997015f, 0.99974954f, 0.9997912f, 0.9998271f, 0.9998579f,
+        0.9998841f, 0.99990636f, 0.999925f, 0.9999406f, 0.99995345f, 0.99996394f, 0.9999725f, 0.9999793f,
+        0.99998474f, 0.999989f, 0.9999922f, 0.9999946f, 0.99999636f, 0.9999977f, 0.99999857f, 0.99999917f,
+        0.9999995f, 0.99999976f, 0.9999999f, 0.99999994f, 1.0f, 1.0f, 1.0f, 1.0f,
+        1.0f,
+      };
+      const float easeInSine[lut_size+1] =
+      {
+        0.0f, 1.8824718e-05f, 7.529816e-05f, 0.0001694182f, 0.0003011813f, 0.0004705825f, 0.0006776154f, 0.0009222723f,
+        0.0012045437f, 0.0015244194f, 0.0018818871f, 0.0022769333f, 0.0027095433f, 0.0031797008f, 0.0036873878f, 0.0042325854f,
+        0.0048152735f, 0.005435429f, 0.00609303f, 0.0067880508f, 0.007520465f, 0.008290246f, 0.009097365f, 0.009941789f,
+        0.01082349f, 0.011742433f, 0.012698581f, 0.013691903f, 0.0147223575f, 0.015789907f, 0.016894512f, 0.01803613f,
+        0.01921472f, 0.020430235f, 0.02168263f, 0.022971857f, 0.02429787f, 0.025660617f, 0.027060049f, 0.028496109f,
+        0.029968746f, 0.031477906f, 0.03302353f, 0.03460556f, 0.036223933f, 0.037878595f, 0.039569482f, 0.041296527f,
+        0.043059666f, 0.044858832f, 0.04669396f, 0.048564978f, 0.05047182f, 0.05241441f, 0.054392673f, 0.056406543f,
+        0.058455937f, 0.060540777f, 0.062660985f, 0.06481649f, 0.0670072f, 0.06923304f, 0.071493916f, 0.07378976f,
+        0.076120466f, 0.07848596f, 0.08088615f, 0.08332094f, 0.08579025f, 0.08829397f, 0.09083202f, 0.09340429f,
+        0.09601071f, 0.098651156f, 0.101325534f, 0.10403375f, 0.1067757f, 0.10955127f, 0.11236038f, 0.115202904f,
+        0.11807874f, 0.12098777f, 0.1239299f, 0.12690502f, 0.129913f, 0.13295375f, 0.13602714f, 0.13913307f,
+        0.14227138f, 0.14544201f, 0.1486448f, 0.15187965f, 0.15514643f, 0.15844502f, 0.16177529f, 0.16513713f,
+        0.16853039f, 0.17195496f, 0.1754107f, 0.17889749f, 0.18241519f, 0.18596368f, 0.1895428f, 0.19315244f,
+        0.19679247f, 0.20046273f, 0.20416309f, 0.20789342f, 0.21165358f, 0.2154434f, 0.21926278f, 0.22311154f,
+        0.22698955f, 0.23089667f, 0.23483273f, 0.23879762f, 0.24279116f, 0.24681321f, 0.2508636f, 0.2549422f,
+        0.25904888f, 0.26318344f, 0.26734573f, 0.2715356f, 0.27575293f, 0.2799975f, 0.28426918f, 0.2885678f,
+        0.29289323f, 0.29724526f, 0.30162376f, 0.30602854f, 0.31045946f, 0.31491634f, 0.319399f, 0.3239073f,
+        0.32844105f, 0.33300006f, 0.33758423f, 0.3421933f, 0.34682715f, 0.3514856f, 0.35616845f, 0.36087555f,
+        0.36560673f, 0.37036178f, 0.37514052f, 0.37994277f, 0.3847684f, 0.3896172f, 0.39448896f, 0.39938352f,
+        0.4043007f, 0.4092403f, 0.41420215f, 0.41918606f, 0.4241918f, 0.42921925f, 0.43426818f, 0.43933842f,
+        0.44442976f, 0.44954202f, 0.45467502f, 0.45982853f, 0.4650024f, 0.47019637f, 0.4754103f, 0.48064402f,
+        0.48589724f, 0.49116987f, 0.49646163f, 0.50177234f, 0.50710183f, 0.51244986f, 0.51781625f, 0.52320075f,
+        0.52860326f, 0.5340235f, 0.5394613f, 0.5449164f, 0.5503887f, 0.55587786f, 0.5613838f, 0.56690615f,
+        0.5724449f, 0.5779997f, 0.5835704f, 0.5891568f, 0.5947587f, 0.6003758f, 0.60600793f, 0.61165494f,
+        0.61731654f, 0.6229926f, 0.6286828f, 0.634387f, 0.64010495f, 0.6458365f, 0.65158135f, 0.6573393f,
+        0.66311014f, 0.6688937f, 0.6746897f, 0.68049794f, 0.6863183f, 0.69215035f, 0.69799405f, 0.70384914f,
+        0.7097153f, 0.71559244f, 0.7214803f, 0.72737867f, 0.7332872f, 0.7392059f, 0.74513435f, 0.7510724f,
+        0.7570198f, 0.7629764f, 0.7689419f, 0.7749161f, 0.78089875f, 0.7868897f, 0.79288864f, 0.79889536f,
+        0.8049097f, 0.8109313f, 0.8169601f, 0.8229958f, 0.8290381f, 0.8350869f, 0.8411419f, 0.84720284f,
+        0.8532695f, 0.85934174f, 0.86541927f, 0.87150186f, 0.87758934f, 0.88368136f, 0.8897778f, 0.8958784f,
+        0.90198284f, 0.90809107f, 0.9142027f, 0.9203176f, 0.9264354f, 0.9325561f, 0.9386793f, 0.9448047f,
+        0.9509323f, 0.95706177f, 0.96319276f, 0.9693252f, 0.9754588f, 0.98159325f, 0.9877285f, 0.9938641f,
+        1.0f,
+      };
+      const float easeOutSine[lut_size+1] =
+      {
+        0.0f, 0.0061358847f, 0.012271538f, 0.01840673f, 0.024541229f, 0.030674804f, 0.036807224f, 0.04293826f,
+        0.049067676f, 0.055195246f, 0.061320737f, 0.06744392f, 0.07356457f, 0.07968244f, 0.08579731f, 0.091908954f,
+        0.09801714f, 0.10412163f, 0.110222206f, 0.11631863f, 0.12241068f, 0.1284981f, 0.1345807f, 0.14065824f,
+        0.14673047f, 0.15279719f, 0.15885815f, 0.16491312f, 0.17096189f, 0.17700422f, 0.18303989f, 0.18906866f,
+        0.19509032f, 0.20110464f, 0.20711137f, 0.21311031f, 0.21910124f, 0.22508392f, 0.2310581f, 0.2370236f,
+        0.24298018f, 0.24892761f, 0.25486565f, 0.2607941f, 0.26671275f, 0.27262136f, 0.2785197f, 0.28440753f,
+        0.29028466f, 0.2961509f, 0.30200595f, 0.30784965f, 0.31368175f, 0.31950203f, 0.3253103f, 0.3311063f,
+        0.33688986f, 0.34266073f, 0.34841868f, 0.35416353f, 0.35989505f, 0.36561298f, 0.3713172f, 0.37700742f,
+        0.38268343f, 0.38834503f, 0.39399204f, 0.3996242f, 0.4052413f, 0.41084316f, 0.41642955f, 0.42200026f,
+        0.42755508f, 0.43309382f, 0.43861625f, 0.44412214f, 0.44961134f, 0.45508358f, 0.46053872f, 0.4659765f,
+        0.47139674f, 0.47679922f, 0.48218378f, 0.48755017f, 0.4928982f, 0.49822766f, 0.50353837f, 0.50883013f,
+        0.51410276f, 0.519356f, 0.52458966f, 0.52980363f, 0.53499764f, 0.54017144f, 0.545325f, 0.55045795f,
+        0.55557024f, 0.56066155f, 0.5657318f, 0.57078075f, 0.57580817f, 0.58081394f, 0.58579785f, 0.5907597f,
+        0.5956993f, 0.60061646f, 0.60551107f, 0.6103828f, 0.6152316f, 0.6200572f, 0.6248595f, 0.62963825f,
+        0.6343933f, 0.63912445f, 0.64383155f, 0.6485144f, 0.65317285f, 0.6578067f, 0.6624158f, 0.66699994f,
+        0.671559f, 0.6760927f, 0.680601f, 0.6850837f, 0.68954057f, 0.69397146f, 0.69837624f, 0.70275474f,
+        0.70710677f, 0.7114322f, 0.71573085f, 0.72000253f, 0.7242471f, 0.72846437f, 0.7326543f, 0.7368166f,
+        0.7409511f, 0.74505776f, 0.7491364f, 0.7531868f, 0.7572088f, 0.7612024f, 0.76516724f, 0.76910335f,
+        0.77301043f, 0.7768885f, 0.7807372f, 0.78455657f, 0.7883464f, 0.79210657f, 0.7958369f, 0.79953724f,
+        0.8032075f, 0.8068476f, 0.81045717f, 0.8140363f, 0.8175848f, 0.8211025f, 0.8245893f, 0.82804507f,
+        0.8314696f, 0.8348629f, 0.8382247f, 0.841555f, 0.8448536f, 0.84812033f, 0.8513552f, 0.854558f,
+        0.8577286f, 0.86086696f, 0.86397284f, 0.86704624f, 0.87008697f, 0.873095f, 0.8760701f, 0.8790122f,
+        0.8819213f, 0.8847971f, 0.88763964f, 0.89044875f, 0.8932243f, 0.89596623f, 0.8986745f, 0.9013488f,
+        0.9039893f, 0.9065957f, 0.909168f, 0.91170603f, 0.9142098f, 0.9166791f, 0.9191139f, 0.92151403f,
+        0.9238795f, 0.9262102f, 0.9285061f, 0.93076694f, 0.9329928f, 0.9351835f, 0.937339f, 0.9394592f,
+        0.94154406f, 0.94359344f, 0.9456073f, 0.9475856f, 0.94952816f, 0.951435f, 0.953306f, 0.9551412f,
+        0.95694035f, 0.95870346f, 0.9604305f, 0.9621214f, 0.96377605f, 0.96539444f, 0.96697646f, 0.9685221f,
+        0.97003126f, 0.9715039f, 0.97293997f, 0.97433937f, 0.9757021f, 0.97702813f, 0.9783174f, 0.9795698f,
+        0.98078525f, 0.9819639f, 0.9831055f, 0.9842101f, 0.98527765f, 0.9863081f, 0.9873014f, 0.9882576f,
+        0.9891765f, 0.9900582f, 0.99090266f, 0.99170977f, 0.99247956f, 0.9932119f, 0.993907f, 0.9945646f,
+        0.9951847f, 0.9957674f, 0.9963126f, 0.9968203f, 0.99729043f, 0.99772304f, 0.9981181f, 0.99847555f,
+        0.99879545f, 0.99907774f, 0.99932235f, 0.9995294f, 0.9996988f, 0.9998306f, 0.9999247f, 0.99998116f,
+        1.0f,
+      };
+      const float easeInOutSine[lut_size+1] =
+      {
+        -0.0f, 3.764908e-05f, 0.00015059065f, 0.0003388077f, 0.0006022719f, 0.00094094354f, 0.0013547717f, 0.0018436939f,
+        0.0024076367f, 0.003046515f, 0.0037602326f, 0.0045486824f, 0.005411745f, 0.0063492907f, 0.0073611788f, 0.008447256f,
+        0.00960736f, 0.010841315f, 0.012148935f, 0.013530024f, 0.014984373f, 0.016511764f, 0.018111967f, 0.019784741f,
+        0.021529833f, 0.02334698f, 0.02523591f, 0.027196337f, 0.029227968f, 0.031330492f, 0.0335036f, 0.035746958f,
+        0.038060233f, 0.040443074f, 0.042895123f, 0.04541601f, 0.048005354f, 0.050662767f, 0.05338785f, 0.05618019f,
+        0.05903937f, 0.06196495f, 0.0649565f, 0.06801357f, 0.07113569f, 0.0743224f, 0.07757322f, 0.080887645f,
+        0.084265195f, 0.08770535f, 0.09120759f, 0.0947714f, 0.098396234f, 0.102081545f, 0.10582679f, 0.10963139f,
+        0.113494776f, 0.11741637f, 0.12139558f, 0.1254318f, 0.12952444f, 0.13367286f, 0.13787647f, 0.14213459f,
+        0.14644662f, 0.15081188f, 0.15522973f, 0.1596995f, 0.16422053f, 0.16879211f, 0.17341357f, 0.17808422f,
+        0.18280336f, 0.18757026f, 0.1923842f, 0.19724448f, 0.20215034f, 0.20710108f, 0.2120959f, 0.21713409f,
+        0.22221488f, 0.22733751f, 0.2325012f, 0.23770516f, 0.24294862f, 0.24823081f, 0.25355092f, 0.25890812f,
+        0.26430163f, 0.26973066f, 0.27519435f, 0.2806919f, 0.28622246f, 0.2917852f, 0.29737934f, 0.30300397f,
+        0.30865827f, 0.3143414f, 0.32005247f, 0.32579067f, 0.33155507f, 0.33734486f, 0.34315914f, 0.34899703f,
+        0.35485765f, 0.36074015f, 0.3666436f, 0.37256718f, 0.3785099f, 0.38447094f, 0.39044937f, 0.39644432f,
+        0.40245485f, 0.40848005f, 0.41451904f, 0.42057094f, 0.42663476f, 0.43270963f, 0.43879467f, 0.4448889f,
+        0.45099142f, 0.45710135f, 0.4632177f, 0.46933964f, 0.47546616f, 0.48159638f, 0.4877294f, 0.49386424f,
+        0.5f, 0.50613576f, 0.5122706f, 0.5184036f, 0.5245338f, 0.5306604f, 0.53678226f, 0.54289865f,
+        0.54900855f, 0.5551111f, 0.5612053f, 0.56729037f, 0.5733652f, 0.5794291f, 0.5854809f, 0.59151995f,
+        0.59754515f, 0.6035557f, 0.6095506f, 0.61552906f, 0.62149006f, 0.6274328f, 0.6333564f, 0.6392598f,
+        0.6451423f, 0.651003f, 0.65684086f, 0.6626552f, 0.66844493f, 0.67420936f, 0.6799475f, 0.6856586f,
+        0.6913417f, 0.69699603f, 0.7026207f, 0.70821476f, 0.71377754f, 0.71930814f, 0.72480565f, 0.7302694f,
+        0.73569834f, 0.7410919f, 0.7464491f, 0.7517692f, 0.75705135f, 0.7622948f, 0.7674988f, 0.7726625f,
+        0.7777851f, 0.7828659f, 0.7879041f, 0.79289895f, 0.79784966f, 0.80275553f, 0.8076158f, 0.8124297f,
+        0.81719667f, 0.82191575f, 0.8265864f, 0.8312079f, 0.8357795f, 0.8403005f, 0.84477025f, 0.84918815f,
+        0.8535534f, 0.8578654f, 0.86212355f, 0.8663271f, 0.8704756f, 0.8745682f, 0.8786044f, 0.8825836f,
+        0.88650525f, 0.89036864f, 0.8941732f, 0.89791846f, 0.90160376f, 0.9052286f, 0.90879244f, 0.9122946f,
+        0.9157348f, 0.9191123f, 0.92242676f, 0.9256776f, 0.9288643f, 0.93198645f, 0.9350435f, 0.9380351f,
+        0.94096065f, 0.9438198f, 0.9466122f, 0.94933724f, 0.95199466f, 0.954584f, 0.95710486f, 0.95955694f,
+        0.96193975f, 0.96425307f, 0.9664964f, 0.96866953f, 0.970772f, 0.97280365f, 0.9747641f, 0.97665304f,
+        0.97847015f, 0.98021525f, 0.98188806f, 0.98348826f, 0.98501563f, 0.98647f, 0.9878511f, 0.9891587f,
+        0.9903926f, 0.99155277f, 0.9926388f, 0.99365073f, 0.99458826f, 0.99545133f, 0.9962398f, 0.9969535f,
+        0.9975924f, 0.9981563f, 0.99864525f, 0.9990591f, 0.99939775f, 0.9996612f, 0.99984944f, 0.99996233f,
+        1.0f,
+      };
+      const float easeInExpo[lut_size+1] =
+      {
+        0.0f, 0.0010033651f, 0.0010309035f, 0.0010591976f, 0.0010882684f, 0.0011181368f, 0.0011488252f, 0.0011803558f,
+        0.0012127517f, 0.0012460368f, 0.0012802356f, 0.0013153729f, 0.0013514746f, 0.001388567f, 0.0014266776f, 0.0014658341f,
+        0.0015060653f, 0.0015474006f, 0.0015898705f, 0.001633506f, 0.0016783392f, 0.0017244028f, 0.0017717306f, 0.0018203575f,
+        0.0018703189f, 0.0019216515f, 0.0019743931f, 0.0020285822f, 0.0020842587f, 0.002141463f, 0.0022002375f, 0.0022606251f,
+        0.00232267f, 0.002386418f, 0.0024519155f, 0.0025192108f, 0.002588353f, 0.0026593925f, 0.0027323822f, 0.002807375f,
+        0.0028844262f, 0.0029635918f, 0.0030449305f, 0.0031285016f, 0.0032143663f, 0.0033025874f, 0.0033932303f, 0.0034863607f,
+        0.003582047f, 0.0036803598f, 0.0037813706f, 0.003885154f, 0.003991786f, 0.004101344f, 0.004213909f, 0.004329564f,
+        0.004448393f, 0.0045704837f, 0.004695925f, 0.004824809f, 0.0049572303f, 0.0050932863f, 0.0052330764f, 0.005376703f,
+        0.0055242716f, 0.0056758905f, 0.005831671f, 0.0059917266f, 0.0061561754f, 0.0063251373f, 0.006498737f, 0.0066771004f,
+        0.00686036f, 0.0070486492f, 0.007242106f, 0.0074408725f, 0.0076450943f, 0.007854921f, 0.008070507f, 0.008292009f,
+        0.008519592f, 0.00875342f, 0.008993666f, 0.009240505f, 0.00949412f, 0.009754695f, 0.010022422f, 0.010297497f,
+        0.010580122f, 0.010870503f, 0.011168854f, 0.011475394f, 0.011790347f, 0.012113945f, 0.012446423f, 0.012788027f,
+        0.013139007f, 0.013499619f, 0.013870128f, 0.014250807f, 0.014641935f, 0.015043796f, 0.015456688f, 0.01588091f,
+        0.016316777f, 0.016764607f, 0.017224727f, 0.017697478f, 0.018183202f, 0.018682256f, 0.019195009f, 0.019721834f,
+        0.020263119f, 0.020819258f, 0.021390663f, 0.02197775f, 0.02258095f, 0.023200706f, 0.023837471f, 0.024491712f,
+        0.025163911f, 0.02585456f, 0.026564162f, 0.02729324f, 0.02804233f, 0.028811978f, 0.02960275f, 0.030415226f,
+        0.03125f, 0.032107685f, 0.032988913f, 0.033894323f, 0.034824587f, 0.035780378f, 0.036762405f, 0.037771385f,
+        0.038808055f, 0.03987318f, 0.04096754f, 0.042091932f, 0.043247186f, 0.044434145f, 0.045653682f, 0.04690669f,
+        0.048194088f, 0.04951682f, 0.050875857f, 0.052272193f, 0.053706855f, 0.05518089f, 0.05669538f, 0.05825144f,
+        0.059850205f, 0.06149285f, 0.06318058f, 0.06491463f, 0.06669628f, 0.06852682f, 0.0704076f, 0.072340004f,
+        0.07432544f, 0.076365374f, 0.0784613f, 0.080614746f, 0.08282729f, 0.08510056f, 0.08743623f, 0.089836f,
+        0.09230164f, 0.09483494f, 0.09743778f, 0.10011205f, 0.10285972f, 0.1056828f, 0.10858337f, 0.11156354f,
+        0.114625506f, 0.117771514f, 0.12100386f, 0.124324925f, 0.12773715f, 0.131243f, 0.1348451f, 0.13854605f,
+        0.14234857f, 0.14625548f, 0.1502696f, 0.15439388f, 0.15863137f, 0.16298516f, 0.16745844f, 0.1720545f,
+        0.17677669f, 0.1816285f, 0.18661347f, 0.19173525f, 0.19699761f, 0.2024044f, 0.20795958f, 0.21366721f,
+        0.21953152f, 0.22555678f, 0.23174739f, 0.23810792f, 0.24464302f, 0.25135747f, 0.25825623f, 0.2653443f,
+        0.27262694f, 0.28010944f, 0.2877973f, 0.29569617f, 0.30381185f, 0.31215024f, 0.3207175f, 0.3295199f,
+        0.3385639f, 0.3478561f, 0.35740334f, 0.3672126f, 0.3772911f, 0.38764623f, 0.39828554f, 0.40921685f,
+        0.4204482f, 0.43198782f, 0.4438441f, 0.45602584f, 0.46854192f, 0.48140147f, 0.494614f, 0.50818914f,
+        0.52213687f, 0.53646743f, 0.5511913f, 0.5663193f, 0.58186245f, 0.5978322f, 0.6142403f, 0.6310987f,
+        0.6484198f, 0.66621625f, 0.68450123f, 0.703288f, 0.7225904f, 0.7424226f, 0.7627991f, 0.7837348f,
+        0.80524516f, 0.8273459f, 0.8500532f, 0.8733837f, 0.89735454f, 0.9219833f, 0.947288f, 0.9732872f,
+        1.0f,
+      };
+      const float easeOutExpo[lut_size+1] =
+      {
+        0.0f, 0.026712792f, 0.05271201f, 0.07801671f, 0.102645464f, 0.12661631f, 0.14994682f, 0.17265412f,
+        0.19475484f, 0.21626519f, 0.23720093f, 0.25757742f, 0.27740958f, 0.296712f, 0.3154988f, 0.33378372f,
+        0.35158023f, 0.3689013f, 0.38575974f, 0.4021678f, 0.41813758f, 0.43368074f, 0.4488087f, 0.46353257f,
+        0.4778631f, 0.49181083f, 0.505386f, 0.5185985f, 0.5314581f, 0.54397416f, 0.55615586f, 0.5680122f,
+        0.5795518f, 0.5907831f, 0.6017145f, 0.6123538f, 0.6227089f, 0.6327874f, 0.64259666f, 0.6521439f,
+        0.66143614f, 0.6704801f, 0.6792825f, 0.68784976f, 0.69618815f, 0.7043038f, 0.71220267f, 0.71989053f,
+        0.72737306f, 0.7346557f, 0.7417438f, 0.7486425f, 0.75535697f, 0.7618921f, 0.7682526f, 0.7744432f,
+        0.78046846f, 0.7863328f, 0.7920404f, 0.7975956f, 0.8030024f, 0.80826473f, 0.81338656f, 0.8183715f,
+        0.8232233f, 0.82794553f, 0.8325416f, 0.83701485f, 0.8413686f, 0.8456061f, 0.84973043f, 0.8537445f,
+        0.8576514f, 0.86145395f, 0.8651549f, 0.868757f, 0.87226284f, 0.8756751f, 0.87899613f, 0.8822285f,
+        0.8853745f, 0.88843644f, 0.8914166f, 0.8943172f, 0.89714026f, 0.899888f, 0.9025622f, 0.9051651f,
+        0.9076984f, 0.910164f, 0.91256374f, 0.9148994f, 0.91717273f, 0.91938525f, 0.9215387f, 0.92363465f,
+        0.92567456f, 0.92766f, 0.9295924f, 0.9314732f, 0.9333037f, 0.93508536f, 0.93681943f, 0.93850714f,
+        0.9401498f, 0.94174856f, 0.9433046f, 0.9448191f, 0.9462932f, 0.9477278f, 0.94912416f, 0.9504832f,
+        0.9518059f, 0.9530933f, 0.9543463f, 0.95556587f, 0.95675284f, 0.9579081f, 0.9590325f, 0.9601268f,
+        0.96119195f, 0.9622286f, 0.9632376f, 0.9642196f, 0.9651754f, 0.9661057f, 0.9670111f, 0.9678923f,
+        0.96875f, 0.96958476f, 0.97039723f, 0.971188f, 0.9719577f, 0.97270674f, 0.9734358f, 0.9741454f,
+        0.9748361f, 0.9755083f, 0.97616255f, 0.9767993f, 0.9774191f, 0.9780223f, 0.9786093f, 0.97918075f,
+        0.97973686f, 0.9802782f, 0.980805f, 0.98131776f, 0.9818168f, 0.98230255f, 0.9827753f, 0.9832354f,
+        0.9836832f, 0.9841191f, 0.9845433f, 0.9849562f, 0.98535806f, 0.9857492f, 0.9861299f, 0.9865004f,
+        0.986861f, 0.987212f, 0.9875536f, 0.9878861f, 0.98820966f, 0.9885246f, 0.98883116f, 0.9891295f,
+        0.9894199f, 0.9897025f, 0.9899776f, 0.9902453f, 0.9905059f, 0.9907595f, 0.9910063f, 0.9912466f,
+        0.9914804f, 0.991708f, 0.9919295f, 0.99214506f, 0.9923549f, 0.99255913f, 0.9927579f, 0.99295133f,
+        0.9931396f, 0.9933229f, 0.99350125f, 0.9936749f, 0.99384385f, 0.9940083f, 0.99416834f, 0.9943241f,
+        0.9944757f, 0.9946233f, 0.99476695f, 0.9949067f, 0.99504274f, 0.9951752f, 0.99530405f, 0.9954295f,
+        0.9955516f, 0.99567044f, 0.9957861f, 0.99589866f, 0.9960082f, 0.99611485f, 0.9962186f, 0.99631965f,
+        0.99641794f, 0.99651366f, 0.99660677f, 0.9966974f, 0.99678564f, 0.9968715f, 0.9969551f, 0.9970364f,
+        0.99711555f, 0.9971926f, 0.9972676f, 0.9973406f, 0.99741167f, 0.9974808f, 0.9975481f, 0.9976136f,
+        0.9976773f, 0.9977394f, 0.99779975f, 0.9978585f, 0.99791574f, 0.9979714f, 0.9980256f, 0.99807835f,
+        0.99812967f, 0.9981796f, 0.99822825f, 0.9982756f, 0.99832165f, 0.9983665f, 0.9984101f, 0.9984526f,
+        0.9984939f, 0.99853414f, 0.9985733f, 0.99861145f, 0.9986485f, 0.99868464f, 0.99871975f, 0.99875396f,
+        0.9987872f, 0.99881965f, 0.9988512f, 0.9988819f, 0.99891174f, 0.9989408f, 0.9989691f, 0.9989966f,
+        1.0f,
+      };
+      const float easeInOutExpo[lut_size+1] =
+      {
+        0.0f, 0.0005154518f, 0.0005441342f, 0.0005744126f, 0.00060637586f, 0.0006401178f, 0.0006757373f, 0.0007133388f,
+        0.0007530326f, 0.0007949353f, 0.0008391696f, 0.0008858653f, 0.00093515945f, 0.0009871966f, 0.0010421294f, 0.0011001187f,
+        0.001161335f, 0.0012259578f, 0.0012941764f, 0.0013661911f, 0.0014422131f, 0.0015224653f, 0.0016071831f, 0.0016966151f,
+        0.0017910235f, 0.0018906853f, 0.001995893f, 0.0021069546f, 0.0022241964f, 0.0023479625f, 0.0024786151f, 0.0026165382f,
+        0.0027621358f, 0.0029158355f, 0.0030780877f, 0.0032493684f, 0.00343018f, 0.003621053f, 0.0038225472f, 0.0040352535f,
+        0.004259796f, 0.004496833f, 0.00474706f, 0.005011211f, 0.005290061f, 0.005584427f, 0.0058951736f, 0.0062232115f,
+        0.0065695033f, 0.006935064f, 0.0073209675f, 0.007728344f, 0.008158389f, 0.008612364f, 0.009091601f, 0.0095975045f,
+        0.010131559f, 0.010695332f, 0.011290475f, 0.011918736f, 0.012581956f, 0.013282081f, 0.014021165f, 0.014801375f,
+        0.015625f, 0.016494457f, 0.017412294f, 0.018381203f, 0.019404028f, 0.02048377f, 0.021623593f, 0.022826841f,
+        0.024097044f, 0.025437929f, 0.026853427f, 0.02834769f, 0.029925102f, 0.03159029f, 0.03334814f, 0.0352038f,
+        0.03716272f, 0.03923065f, 0.041413646f, 0.043718114f, 0.04615082f, 0.04871889f, 0.05142986f, 0.054291684f,
+        0.057312753f, 0.06050193f, 0.063868575f, 0.06742255f, 0.07117429f, 0.0751348f, 0.079315685f, 0.08372922f,
+        0.088388346f, 0.093306735f, 0.09849881f, 0.10397979f, 0.10976576f, 0.115873694f, 0.12232151f, 0.12912811f,
+        0.13631347f, 0.14389865f, 0.15190592f, 0.16035876f, 0.16928194f, 0.17870167f, 0.18864556f, 0.19914277f,
+        0.2102241f, 0.22192205f, 0.23427096f, 0.247307f, 0.26106843f, 0.27559564f, 0.29093122f, 0.30712014f,
+        0.3242099f, 0.34225062f, 0.3612952f, 0.38139954f, 0.40262258f, 0.4250266f, 0.44867727f, 0.473644f,
+        0.5f, 0.526356f, 0.55132276f, 0.5749734f, 0.5973774f, 0.6186005f, 0.6387048f, 0.6577494f,
+        0.67579013f, 0.69287986f, 0.7090688f, 0.72440434f, 0.73893154f, 0.752693f, 0.76572907f, 0.77807796f,
+        0.7897759f, 0.80085725f, 0.81135446f, 0.82129836f, 0.83071804f, 0.8396413f, 0.8480941f, 0.85610133f,
+        0.86368656f, 0.8708719f, 0.8776785f, 0.8841263f, 0.89023423f, 0.89602023f, 0.9015012f, 0.9066933f,
+        0.9116117f, 0.9162708f, 0.92068434f, 0.9248652f, 0.92882574f, 0.93257743f, 0.9361314f, 0.93949807f,
+        0.9426873f, 0.94570833f, 0.94857013f, 0.95128113f, 0.9538492f, 0.9562819f, 0.95858634f, 0.96076936f,
+        0.9628373f, 0.9647962f, 0.96665186f, 0.9684097f, 0.9700749f, 0.9716523f, 0.97314656f, 0.97456205f,
+        0.975903f, 0.97717315f, 0.9783764f, 0.9795162f, 0.98059595f, 0.9816188f, 0.9825877f, 0.98350555f,
+        0.984375f, 0.9851986f, 0.98597884f, 0.98671794f, 0.98741806f, 0.9880813f, 0.9887095f, 0.98930466f,
+        0.98986846f, 0.9904025f, 0.9909084f, 0.99138767f, 0.9918416f, 0.99227166f, 0.99267906f, 0.99306494f,
+        0.9934305f, 0.9937768f, 0.9941048f, 0.9944156f, 0.99470997f, 0.9949888f, 0.99525297f, 0.9955032f,
+        0.9957402f, 0.99596477f, 0.99617743f, 0.99637896f, 0.9965698f, 0.99675065f, 0.9969219f, 0.99708414f,
+        0.99723786f, 0.9973835f, 0.9975214f, 0.99765205f, 0.9977758f, 0.99789304f, 0.9980041f, 0.99810934f,
+        0.998209f, 0.9983034f, 0.9983928f, 0.9984775f, 0.9985578f, 0.9986338f, 0.9987058f, 0.99877405f,
+        0.99883866f, 0.9988999f, 0.9989579f, 0.9990128f, 0.99906486f, 0.99911416f, 0.9991608f, 0.99920505f,
+        0.99924695f, 0.99928665f, 0.99932426f, 0.9993599f, 0.99939364f, 0.9994256f, 0.99945587f, 0.99948454f,
+        1.0f,
+      };
+      const float easeInCirc[lut_size+1] =
+      {
+        0.0f, 7.629424e-06f, 3.0518044e-05f, 6.866691e-05f, 0.00012207776f, 0.00019075305f, 0.00027469592f, 0.00037391024f,
+        0.0004884005f, 0.00061817205f, 0.0007632307f, 0.0009235832f, 0.001099237f, 0.0012901999f, 0.001496481f, 0.0017180897f,
+        0.001955036f, 0.0022073311f, 0.0024749867f, 0.0027580147f, 0.0030564286f, 0.0033702422f, 0.00369947f, 0.004044127f,
+        0.00440423f, 0.0047797947f, 0.0051708394f, 0.005577382f, 0.005999442f, 0.0064370385f, 0.0068901926f, 0.007358925f,
+        0.007843259f, 0.008343215f, 0.0088588195f, 0.009390095f, 0.0099370675f, 0.010499763f, 0.011078209f, 0.011672432f,
+        0.012282461f, 0.012908325f, 0.013550054f, 0.01420768f, 0.014881234f, 0.015570748f, 0.016276257f, 0.016997796f,
+        0.017735397f, 0.0184891f, 0.01925894f, 0.020044954f, 0.020847185f, 0.02166567f, 0.02250045f, 0.023351567f,
+        0.024219062f, 0.025102982f, 0.02600337f, 0.026920272f, 0.027853735f, 0.028803807f, 0.029770534f, 0.03075397f,
+        0.031754162f, 0.032771166f, 0.03380503f, 0.034855817f, 0.03592357f, 0.037008356f, 0.038110226f, 0.039229244f,
+        0.040365465f, 0.041518956f, 0.042689774f, 0.04387798f, 0.04508365f, 0.04630684f, 0.047547624f, 0.048806068f,
+        0.05008224f, 0.051376216f, 0.052688066f, 0.054017864f, 0.05536569f, 0.056731615f, 0.05811572f, 0.059518088f,
+        0.0609388f, 0.062377937f, 0.06383558f, 0.065311834f, 0.06680677f, 0.068320476f, 0.06985305f, 0.07140459f,
+        0.07297519f, 0.07456494f, 0.07617394f, 0.07780229f, 0.07945011f, 0.08111747f, 0.082804516f, 0.08451133f,
+        0.08623803f, 0.08798473f, 0.08975155f, 0.09153859f, 0.09334599f, 0.095173866f, 0.09702234f, 0.09889154f,
+        0.10078159f, 0.10269263f, 0.104624785f, 0.1065782f, 0.10855301f, 0.11054936f, 0.1125674f, 0.11460727f,
+        0.116669126f, 0.11875312f, 0.12085941f, 0.12298815f, 0.12513952f, 0.12731367f, 0.12951079f, 0.13173103f,
+        0.1339746f, 0.13624164f, 0.13853237f, 0.14084697f, 0.14318563f, 0.14554855f, 0.14793593f, 0.15034798f,
+        0.1527849f, 0.15524691f, 0.15773423f, 0.1602471f, 0.16278572f, 0.16535036f, 0.16794124f, 0.1705586f,
+        0.17320271f, 0.17587382f, 0.1785722f, 0.18129808f, 0.18405178f, 0.18683358f, 0.18964376f, 0.1924826f,
+        0.19535042f, 0.19824754f, 0.20117426f, 0.20413092f, 0.20711784f, 0.21013539f, 0.2131839f, 0.21626373f,
+        0.21937525f, 0.22251886f, 0.22569492f, 0.22890387f, 0.2321461f, 0.23542203f, 0.2387321f, 0.24207677f,
+        0.24545647f, 0.2488717f, 0.25232294f, 0.25581068f, 0.25933546f, 0.26289776f, 0.26649818f, 0.27013728f,
+        0.27381563f, 0.2775338f, 0.28129247f, 0.2850922f, 0.28893372f, 0.29281768f, 0.2967448f, 0.30071577f,
+        0.3047314f, 0.3087924f, 0.31289962f, 0.31705388f, 0.32125604f, 0.32550701f, 0.3298077f, 0.33415908f,
+        0.33856216f, 0.343018f, 0.34752762f, 0.35209218f, 0.35671285f, 0.36139083f, 0.36612743f, 0.37092394f,
+        0.37578174f, 0.3807023f, 0.38568708f, 0.39073768f, 0.39585578f, 0.4010431f, 0.4063014f, 0.41163266f,
+        0.4170388f, 0.422522f, 0.42808443f, 0.43372846f, 0.43945652f, 0.44527122f, 0.45117536f, 0.45717177f,
+        0.46326363f, 0.46945417f, 0.4757469f, 0.48214558f, 0.4886541f, 0.49527684f, 0.5020182f, 0.50888324f,
+        0.51587707f, 0.5230054f, 0.53027445f, 0.53769076f, 0.5452615f, 0.5529946f, 0.5608986f, 0.5689829f,
+        0.5772578f, 0.58573484f, 0.59442663f, 0.6033473f, 0.6125126f, 0.6219404f, 0.63165075f, 0.64166677f,
+        0.65201473f, 0.6627252f, 0.67383397f, 0.68538314f, 0.69742316f, 0.7100152f, 0.72323453f, 0.7371758f,
+        0.7519608f, 0.7677505f, 0.78476596f, 0.80332506f, 0.8239152f, 0.8473561f, 0.8752444f, 0.911698f,
+        1.0f,
+      };
+      const float easeOutCirc[lut_size+1] =
+      {
+        0.0f, 0.08830199f, 0.12475562f, 0.15264393f, 0.1760848f, 0.19667494f, 0.21523403f, 0.23224948f,
+        0.24803919f, 0.26282415f, 0.27676547f, 0.2899848f, 0.3025768f, 0.31461686f, 0.32616603f, 0.33727476f,
+        0.34798527f, 0.35833323f, 0.36834922f, 0.37805963f, 0.3874874f, 0.3966527f, 0.40557337f, 0.41426513f,
+        0.42274216f, 0.43101713f, 0.43910143f, 0.44700542f, 0.4547385f, 0.46230927f, 0.46972555f, 0.47699454f,
+        0.48412293f, 0.49111676f, 0.49798176f, 0.5047232f, 0.51134586f, 0.51785445f, 0.5242531f, 0.53054583f,
+        0.53673637f, 0.5428282f, 0.54882467f, 0.55472875f, 0.5605435f, 0.56627154f, 0.57191557f, 0.577478f,
+        0.5829612f, 0.58836734f, 0.5936986f, 0.59895694f, 0.6041442f, 0.6092623f, 0.61431295f, 0.61929774f,
+        0.6242183f, 0.62907606f, 0.63387257f, 0.6386092f, 0.6432871f, 0.6479078f, 0.6524724f, 0.656982f,
+        0.6614378f, 0.6658409f, 0.6701923f, 0.674493f, 0.67874396f, 0.68294615f, 0.6871004f, 0.6912076f,
+        0.69526863f, 0.6992842f, 0.7032552f, 0.7071823f, 0.71106625f, 0.71490777f, 0.71870756f, 0.7224662f,
+        0.72618437f, 0.7298627f, 0.7335018f, 0.7371022f, 0.74066454f, 0.7441893f, 0.7476771f, 0.7511283f,
+        0.75454354f, 0.75792325f, 0.7612679f, 0.764578f, 0.7678539f, 0.7710961f, 0.77430505f, 0.77748114f,
+        0.78062475f, 0.7837363f, 0.7868161f, 0.7898646f, 0.79288214f, 0.79586905f, 0.79882574f, 0.80175245f,
+        0.8046496f, 0.8075174f, 0.81035626f, 0.81316644f, 0.8159482f, 0.8187019f, 0.8214278f, 0.8241262f,
+        0.8267973f, 0.82944137f, 0.8320588f, 0.8346496f, 0.8372143f, 0.8397529f, 0.8422658f, 0.8447531f,
+        0.8472151f, 0.84965205f, 0.8520641f, 0.8544515f, 0.8568144f, 0.85915303f, 0.8614676f, 0.8637583f,
+        0.8660254f, 0.86826897f, 0.87048924f, 0.8726863f, 0.87486047f, 0.87701184f, 0.8791406f, 0.88124686f,
+        0.8833309f, 0.8853927f, 0.8874326f, 0.8894506f, 0.891447f, 0.8934218f, 0.8953752f, 0.8973074f,
+        0.89921844f, 0.90110844f, 0.90297765f, 0.9048261f, 0.906654f, 0.9084614f, 0.91024846f, 0.91201526f,
+        0.913762f, 0.91548866f, 0.9171955f, 0.91888255f, 0.92054987f, 0.9221977f, 0.92382604f, 0.92543507f,
+        0.9270248f, 0.9285954f, 0.93014693f, 0.93167955f, 0.9331932f, 0.93468815f, 0.93616444f, 0.9376221f,
+        0.9390612f, 0.9404819f, 0.9418843f, 0.94326836f, 0.9446343f, 0.94598216f, 0.94731194f, 0.9486238f,
+        0.94991773f, 0.9511939f, 0.95245236f, 0.95369315f, 0.95491636f, 0.95612204f, 0.9573102f, 0.9584811f,
+        0.95963454f, 0.9607707f, 0.96188974f, 0.96299165f, 0.9640764f, 0.96514416f, 0.966195f, 0.96722883f,
+        0.96824586f, 0.96924603f, 0.97022945f, 0.9711962f, 0.9721463f, 0.97307974f, 0.97399664f, 0.974897f,
+        0.97578096f, 0.97664845f, 0.97749954f, 0.9783343f, 0.9791528f, 0.979955f, 0.9807411f, 0.9815109f,
+        0.9822646f, 0.9830022f, 0.98372376f, 0.98442924f, 0.98511875f, 0.98579234f, 0.98644996f, 0.98709166f,
+        0.98771757f, 0.98832756f, 0.98892176f, 0.9895002f, 0.99006295f, 0.9906099f, 0.9911412f, 0.9916568f,
+        0.99215674f, 0.9926411f, 0.9931098f, 0.99356294f, 0.99400055f, 0.9944226f, 0.9948292f, 0.9952202f,
+        0.99559575f, 0.9959559f, 0.9963005f, 0.9966298f, 0.9969436f, 0.997242f, 0.99752504f, 0.99779266f,
+        0.99804497f, 0.9982819f, 0.9985035f, 0.9987098f, 0.9989008f, 0.9990764f, 0.99923676f, 0.99938184f,
+        0.9995116f, 0.9996261f, 0.9997253f, 0.99980927f, 0.9998779f, 0.99993134f, 0.9999695f, 0.9999924f,
+        1.0f,
+      };
+      const float easeInOutCirc[lut_size+1] =
+      {
+        0.0f, 1.5259022e-05f, 6.103888e-05f, 0.00013734796f, 0.00024420026f, 0.00038161536f, 0.0005496185f, 0.0007482405f,
+        0.000977518f, 0.0012374934f, 0.0015282143f, 0.001849735f, 0.002202115f, 0.0025854197f, 0.002999721f, 0.0034450963f,
+        0.0039216294f, 0.0044294097f, 0.0049685338f, 0.0055391043f, 0.0061412305f, 0.006775027f, 0.007440617f, 0.008138129f,
+        0.008867699f, 0.00962947f, 0.010423592f, 0.011250225f, 0.012109531f, 0.013001685f, 0.013926867f, 0.014885267f,
+        0.015877081f, 0.016902516f, 0.017961785f, 0.019055113f, 0.020182732f, 0.021344887f, 0.022541825f, 0.023773812f,
+        0.02504112f, 0.026344033f, 0.027682845f, 0.02905786f, 0.0304694f, 0.03191779f, 0.033403385f, 0.034926526f,
+        0.036487594f, 0.03808697f, 0.039725054f, 0.041402258f, 0.043119013f, 0.044875775f, 0.046672996f, 0.04851117f,
+        0.050390795f, 0.052312393f, 0.054276504f, 0.0562837f, 0.058334563f, 0.060429703f, 0.06256976f, 0.064755395f,
+        0.0669873f, 0.069266185f, 0.071592815f, 0.07396796f, 0.07639245f, 0.078867115f, 0.08139286f, 0.08397062f,
+        0.086601354f, 0.0892861f, 0.09202589f, 0.09482188f, 0.09767521f, 0.10058713f, 0.10355892f, 0.10659195f,
+        0.10968763f, 0.11284746f, 0.11607305f, 0.11936605f, 0.122728236f, 0.12616147f, 0.12966773f, 0.13324909f,
+        0.13690782f, 0.14064623f, 0.14446686f, 0.1483724f, 0.1523657f, 0.15644981f, 0.16062802f, 0.16490385f,
+        0.16928108f, 0.17376381f, 0.17835642f, 0.18306372f, 0.18789087f, 0.19284354f, 0.19792789f, 0.2031507f,
+        0.2085194f, 0.21404222f, 0.21972826f, 0.22558768f, 0.23163182f, 0.23787345f, 0.24432705f, 0.2510091f,
+        0.25793853f, 0.26513723f, 0.27263075f, 0.2804493f, 0.2886289f, 0.29721332f, 0.3062563f, 0.31582537f,
+        0.32600737f, 0.33691698f, 0.34871158f, 0.36161727f, 0.3759804f, 0.39238298f, 0.4119576f, 0.4376222f,
+        0.5f, 0.5623778f, 0.5880424f, 0.607617f, 0.62401956f, 0.63838273f, 0.6512884f, 0.663083f,
+        0.67399263f, 0.6841746f, 0.6937437f, 0.7027867f, 0.71137106f, 0.7195507f, 0.72736925f, 0.73486274f,
+        0.74206144f, 0.7489909f, 0.75567293f, 0.76212656f, 0.7683682f, 0.77441233f, 0.7802717f, 0.78595775f,
+        0.7914806f, 0.7968493f, 0.8020721f, 0.80715644f, 0.8121091f, 0.8169363f, 0.8216436f, 0.8262362f,
+        0.83071893f, 0.8350961f, 0.839372f, 0.8435502f, 0.8476343f, 0.8516276f, 0.8555331f, 0.8593538f,
+        0.8630922f, 0.8667509f, 0.8703323f, 0.87383854f, 0.8772718f, 0.88063395f, 0.8839269f, 0.88715255f,
+        0.8903124f, 0.89340806f, 0.8964411f, 0.8994129f, 0.9023248f, 0.9051781f, 0.9079741f, 0.9107139f,
+        0.9133986f, 0.9160294f, 0.9186071f, 0.92113286f, 0.9236075f, 0.926032f, 0.9284072f, 0.9307338f,
+        0.9330127f, 0.9352446f, 0.93743026f, 0.9395703f, 0.9416654f, 0.9437163f, 0.9457235f, 0.9476876f,
+        0.9496092f, 0.95148885f, 0.953327f, 0.9551242f, 0.956881f, 0.9585977f, 0.96027493f, 0.96191305f,
+        0.9635124f, 0.96507347f, 0.9665966f, 0.9680822f, 0.9695306f, 0.97094214f, 0.97231716f, 0.97365594f,
+        0.9749589f, 0.9762262f, 0.9774582f, 0.9786551f, 0.9798173f, 0.9809449f, 0.9820382f, 0.9830975f,
+        0.98412293f, 0.98511475f, 0.98607314f, 0.9869983f, 0.9878905f, 0.9887498f, 0.9895764f, 0.9903705f,
+        0.9911323f, 0.9918619f, 0.9925594f, 0.993225f, 0.99385875f, 0.9944609f, 0.9950315f, 0.9955706f,
+        0.9960784f, 0.9965549f, 0.9970003f, 0.9974146f, 0.9977979f, 0.9981503f, 0.9984718f, 0.9987625f,
+        0.9990225f, 0.9992518f, 0.9994504f, 0.9996184f, 0.9997558f, 0.9998627f, 0.99993896f, 0.99998474f,
+        1.0f,
+      };
+      const float easeInBack[lut_size+1] =
+      {
+        0.0f, -2.5803023e-05f, -0.00010256799f, -0.00022932873f, -0.0004051191f, -0.0006289729f, -0.000899924f, -0.0012170064f,
+        -0.0015792536f, -0.0019856996f, -0.0024353783f, -0.0029273236f, -0.003460569f, -0.004034149f, -0.0046470966f, -0.005298446f,
+        -0.0059872316f, -0.0067124865f, -0.0074732443f, -0.00826854f, -0.009097407f, -0.009958878f, -0.010851988f, -0.01177577f,
+        -0.012729259f, -0.013711489f, -0.014721492f, -0.015758304f, -0.016820958f, -0.017908486f, -0.019019924f, -0.020154305f,
+        -0.021310665f, -0.022488033f, -0.023685448f, -0.024901941f, -0.026136547f, -0.027388299f, -0.028656231f, -0.029939376f,
+        -0.031236771f, -0.032547448f, -0.033870436f, -0.03520478f, -0.0365495f, -0.037903644f, -0.039266232f, -0.04063631f,
+        -0.042012904f, -0.043395054f, -0.044781785f, -0.04617214f, -0.047565147f, -0.048959844f, -0.05035526f, -0.051750433f,
+        -0.053144395f, -0.05453618f, -0.05592482f, -0.05730935f, -0.058688812f, -0.060062226f, -0.061428633f, -0.06278707f,
+        -0.064136565f, -0.06547615f, -0.06680486f, -0.068121746f, -0.069425814f, -0.07071612f, -0.07199168f, -0.073251545f,
+        -0.074494734f, -0.075720295f, -0.07692725f, -0.078114636f, -0.079281494f, -0.08042684f, -0.081549734f, -0.082649186f,
+        -0.083724245f, -0.084773935f, -0.085797295f, -0.08679336f, -0.08776116f, -0.08869973f, -0.08960811f, -0.09048532f,
+        -0.09133041f, -0.092142396f, -0.09292033f, -0.09366324f, -0.09437015f, -0.095040105f, -0.09567214f, -0.09626527f,
+        -0.09681855f, -0.09733101f, -0.097801685f, -0.098229595f, -0.09861378f, -0.09895329f, -0.09924714f, -0.09949437f,
+        -0.09969401f, -0.099845104f, -0.09994667f, -0.09999776f, -0.099997394f, -0.099944614f, -0.09983845f, -0.099677935f,
+        -0.09946211f, -0.09918999f, -0.09886063f, -0.09847306f, -0.098026305f, -0.097519405f, -0.09695139f, -0.0963213f,
+        -0.09562816f, -0.09487101f, -0.09404889f, -0.093160816f, -0.09220584f, -0.09118298f, -0.09009128f, -0.08892978f,
+        -0.0876975f, -0.08639348f, -0.08501676f, -0.08356635f, -0.082041316f, -0.08044068f, -0.07876346f, -0.07700871f,
+        -0.07517546f, -0.07326273f, -0.07126957f, -0.06919501f, -0.067038074f, -0.06479781f, -0.062473245f, -0.060063414f,
+        -0.057567347f, -0.054984085f, -0.052312657f, -0.049552094f, -0.04670144f, -0.043759715f, -0.040725965f, -0.037599217f,
+        -0.034378506f, -0.03106287f, -0.027651338f, -0.024142945f, -0.020536726f, -0.016831713f, -0.0130269425f, -0.009121446f,
+        -0.005114258f, -0.0010044123f, 0.003209057f, 0.007527116f, 0.011950731f, 0.016480869f, 0.021118494f, 0.025864575f,
+        0.030720076f, 0.035685964f, 0.040763203f, 0.045952763f, 0.05125561f, 0.056672703f, 0.06220502f, 0.06785352f,
+        0.073619165f, 0.07950293f, 0.085505776f, 0.09162867f, 0.09787258f, 0.10423847f, 0.11072731f, 0.11734006f,
+        0.124077685f, 0.13094117f, 0.13793145f, 0.14504951f, 0.15229632f, 0.15967284f, 0.16718003f, 0.17481887f,
+        0.1825903f, 0.19049533f, 0.19853489f, 0.20670997f, 0.2150215f, 0.22347048f, 0.23205787f, 0.24078463f,
+        0.24965172f, 0.2586601f, 0.2678108f, 0.2771047f, 0.2865428f, 0.29612607f, 0.30585548f, 0.315732f,
+        0.32575658f, 0.3359302f, 0.3462538f, 0.35672837f, 0.3673549f, 0.37813428f, 0.38906756f, 0.40015566f,
+        0.41139957f, 0.4228002f, 0.43435863f, 0.4460757f, 0.45795244f, 0.4699898f, 0.4821888f, 0.4945503f,
+        0.50707537f, 0.5197649f, 0.5326199f, 0.5456413f, 0.55883014f, 0.5721873f, 0.5857138f, 0.5994106f,
+        0.6132786f, 0.62731886f, 0.6415323f, 0.6559199f, 0.67048264f, 0.68522143f, 0.7001373f, 0.7152312f,
+        0.73050404f, 0.74595684f, 0.76159054f, 0.77740616f, 0.79340464f, 0.8095869f, 0.82595396f, 0.84250677f,
+        0.85924625f, 0.87617344f, 0.8932893f, 0.91059476f, 0.92809075f, 0.94577837f, 0.96365845f, 0.981732f,
+        1.0f,
+      };
+      const float easeOutBack[lut_size+1] =
+      {
+        2.220446e-16f, 0.018268004f, 0.036341563f, 0.05422165f, 0.07190922f, 0.08940525f, 0.1067107f, 0.12382654f,
+        0.14075373f, 0.15749325f, 0.17404605f, 0.1904131f, 0.20659538f, 0.22259383f, 0.23840944f, 0.25404316f,
+        0.26949596f, 0.28476882f, 0.2998627f, 0.31477857f, 0.32951736f, 0.3440801f, 0.35846767f, 0.37268114f,
+        0.38672137f, 0.40058944f, 0.4142862f, 0.4278127f, 0.44116986f, 0.4543587f, 0.4673801f, 0.4802351f,
+        0.49292466f, 0.5054497f, 0.51781124f, 0.53001016f, 0.54204756f, 0.5539243f, 0.5656414f, 0.57719976f,
+        0.58860046f, 0.59984434f, 0.6109324f, 0.6218657f, 0.63264513f, 0.6432716f, 0.6537462f, 0.66406983f,
+        0.67424345f, 0.684268f, 0.6941445f, 0.70387393f, 0.7134572f, 0.7228953f, 0.73218924f, 0.74133986f,
+        0.75034827f, 0.75921535f, 0.76794213f, 0.7765295f, 0.7849785f, 0.79329f, 0.8014651f, 0.8095047f,
+        0.8174097f, 0.8251811f, 0.83282f, 0.84032714f, 0.8477037f, 0.8549505f, 0.86206853f, 0.86905885f,
+        0.8759223f, 0.88266f, 0.8892727f, 0.89576155f, 0.90212744f, 0.9083713f, 0.9144942f, 0.92049706f,
+        0.9263808f, 0.9321465f, 0.937795f, 0.9433273f, 0.9487444f, 0.95404726f, 0.9592368f, 0.96431404f,
+        0.96927994f, 0.9741354f, 0.9788815f, 0.98351914f, 0.98804927f, 0.9924729f, 0.99679095f, 1.0010045f,
+        1.0051143f, 1.0091214f, 1.013027f, 1.0168318f, 1.0205368f, 1.024143f, 1.0276513f, 1.0310628f,
+        1.0343785f, 1.0375992f, 1.040726f, 1.0437597f, 1.0467014f, 1.0495521f, 1.0523126f, 1.0549841f,
+        1.0575674f, 1.0600634f, 1.0624733f, 1.0647978f, 1.067038f, 1.069195f, 1.0712695f, 1.0732627f,
+        1.0751754f, 1.0770087f, 1.0787635f, 1.0804406f, 1.0820413f, 1.0835663f, 1.0850167f, 1.0863935f,
+        1.0876975f, 1.0889298f, 1.0900912f, 1.091183f, 1.0922059f, 1.0931609f, 1.0940489f, 1.094871f,
+        1.0956281f, 1.0963213f, 1.0969514f, 1.0975194f, 1.0980263f, 1.0984731f, 1.0988606f, 1.09919f,
+        1.0994622f, 1.0996779f, 1.0998385f, 1.0999446f, 1.0999974f, 1.0999978f, 1.0999466f, 1.099845f,
+        1.099694f, 1.0994943f, 1.0992471f, 1.0989532f, 1.0986137f, 1.0982296f, 1.0978017f, 1.097331f,
+        1.0968186f, 1.0962653f, 1.0956721f, 1.0950401f, 1.0943701f, 1.0936632f, 1.0929203f, 1.0921423f,
+        1.0913304f, 1.0904853f, 1.0896081f, 1.0886997f, 1.0877612f, 1.0867933f, 1.0857973f, 1.0847739f,
+        1.0837243f, 1.0826492f, 1.0815498f, 1.0804268f, 1.0792814f, 1.0781146f, 1.0769273f, 1.0757203f,
+        1.0744947f, 1.0732515f, 1.0719917f, 1.0707161f, 1.0694258f, 1.0681218f, 1.0668049f, 1.0654762f,
+        1.0641365f, 1.062787f, 1.0614287f, 1.0600622f, 1.0586888f, 1.0573094f, 1.0559248f, 1.0545362f,
+        1.0531443f, 1.0517504f, 1.0503553f, 1.0489599f, 1.0475651f, 1.0461721f, 1.0447818f, 1.043395f,
+        1.0420129f, 1.0406363f, 1.0392662f, 1.0379037f, 1.0365494f, 1.0352048f, 1.0338705f, 1.0325475f,
+        1.0312368f, 1.0299394f, 1.0286562f, 1.0273883f, 1.0261365f, 1.024902f, 1.0236855f, 1.022488f,
+        1.0213107f, 1.0201544f, 1.01902f, 1.0179085f, 1.0168209f, 1.0157583f, 1.0147215f, 1.0137115f,
+        1.0127293f, 1.0117757f, 1.010852f, 1.0099589f, 1.0090975f, 1.0082686f, 1.0074732f, 1.0067124f,
+        1.0059873f, 1.0052985f, 1.0046471f, 1.0040342f, 1.0034605f, 1.0029273f, 1.0024353f, 1.0019857f,
+        1.0015793f, 1.001217f, 1.0008999f, 1.000629f, 1.0004051f, 1.0002294f, 1.0001025f, 1.0000257f,
+        1.0f,
+      };
+      const float easeInOutBack[lut_size+1] =
+      {
+        -0.0f, -7.833326e-05f, -0.00030990466f, -0.00068957167f, -0.0012121917f, -0.0018726222f, -0.0026657206f, -0.0035863444f,
+        -0.0046293507f, -0.0057895975f, -0.007061942f, -0.008441241f, -0.009922354f, -0.011500136f, -0.013169445f, -0.01492514f,
+        -0.016762076f, -0.018675113f, -0.020659108f, -0.022708915f, -0.024819396f, -0.026985405f, -0.029201802f, -0.031463444f,
+        -0.033765186f, -0.03610189f, -0.03846841f, -0.040859602f, -0.043270327f, -0.04569544f, -0.0481298f, -0.050568264f,
+        -0.05300569f, -0.055436935f, -0.057856858f, -0.06026031f, -0.06264216f, -0.06499725f, -0.06732045f, -0.06960662f,
+        -0.0718506f, -0.07404726f, -0.07619146f, -0.07827805f, -0.080301896f, -0.082257845f, -0.08414076f, -0.0859455f,
+        -0.08766692f, -0.08929988f, -0.09083923f, -0.09227984f, -0.09361655f, -0.09484424f, -0.09595774f, -0.09695193f,
+        -0.09782167f, -0.09856179f, -0.099167176f, -0.09963267f, -0.09995314f, -0.10012343f, -0.1001384f, -0.09999292f,
+        -0.09968185f, -0.09920002f, -0.09854231f, -0.09770357f, -0.09667866f, -0.095462434f, -0.09404976f, -0.09243548f,
+        -0.09061446f, -0.08858156f, -0.086331636f, -0.08385954f, -0.08116013f, -0.078228265f, -0.07505881f, -0.071646616f,
+        -0.06798653f, -0.064073436f, -0.059902165f, -0.055467587f, -0.050764557f, -0.045787934f, -0.04053257f, -0.034993332f,
+        -0.029165069f, -0.023042643f, -0.016620908f, -0.009894725f, -0.0028589498f, 0.0044915606f, 0.012161949f, 0.020157356f,
+        0.028482925f, 0.0371438f, 0.046145122f, 0.055492036f, 0.06518968f, 0.075243205f, 0.08565774f, 0.09643844f,
+        0.10759044f, 0.119118884f, 0.13102892f, 0.14332569f, 0.15601432f, 0.16909999f, 0.18258779f, 0.19648291f,
+        0.21079047f, 0.2255156f, 0.24066348f, 0.2562392f, 0.27224797f, 0.2886949f, 0.3055851f, 0.32292375f,
+        0.34071597f, 0.35896695f, 0.3776818f, 0.39686564f, 0.4165236f, 0.43666092f, 0.45728263f, 0.47839397f,
+        0.5f, 0.521606f, 0.54271734f, 0.5633391f, 0.58347636f, 0.6031344f, 0.6223182f, 0.64103305f,
+        0.659284f, 0.6770762f, 0.6944149f, 0.71130514f, 0.72775203f, 0.74376076f, 0.75933653f, 0.7744844f,
+        0.78920954f, 0.8035171f, 0.8174122f, 0.8309f, 0.8439857f, 0.8566743f, 0.86897105f, 0.88088113f,
+        0.89240956f, 0.90356153f, 0.9143423f, 0.9247568f, 0.93481034f, 0.94450796f, 0.95385486f, 0.9628562f,
+        0.9715171f, 0.97984266f, 0.98783803f, 0.99550843f, 1.002859f, 1.0098947f, 1.0166209f, 1.0230427f,
+        1.029165f, 1.0349933f, 1.0405326f, 1.0457879f, 1.0507646f, 1.0554676f, 1.0599022f, 1.0640734f,
+        1.0679865f, 1.0716466f, 1.0750588f, 1.0782282f, 1.0811602f, 1.0838596f, 1.0863316f, 1.0885816f,
+        1.0906144f, 1.0924355f, 1.0940498f, 1.0954624f, 1.0966786f, 1.0977036f, 1.0985423f, 1.0992f,
+        1.0996819f, 1.0999929f, 1.1001384f, 1.1001234f, 1.0999532f, 1.0996326f, 1.0991672f, 1.0985618f,
+        1.0978217f, 1.096952f, 1.0959578f, 1.0948442f, 1.0936166f, 1.0922798f, 1.0908393f, 1.0892999f,
+        1.0876669f, 1.0859455f, 1.0841408f, 1.0822579f, 1.0803019f, 1.0782781f, 1.0761914f, 1.0740472f,
+        1.0718507f, 1.0696067f, 1.0673205f, 1.0649972f, 1.0626421f, 1.0602603f, 1.0578568f, 1.055437f,
+        1.0530057f, 1.0505682f, 1.0481298f, 1.0456954f, 1.0432703f, 1.0408596f, 1.0384684f, 1.0361019f,
+        1.0337652f, 1.0314634f, 1.0292017f, 1.0269854f, 1.0248194f, 1.0227089f, 1.0206591f, 1.0186751f,
+        1.016762f, 1.0149251f, 1.0131694f, 1.0115001f, 1.0099224f, 1.0084412f, 1.007062f, 1.0057896f,
+        1.0046294f, 1.0035863f, 1.0026658f, 1.0018727f, 1.0012122f, 1.0006896f, 1.00031f, 1.0000783f,
+        1.0f,
+      };
+      const float easeInElastic[lut_size+1] =
+      {
+        0.0f, -0.0004289939f, -0.0003631358f, -0.0002908436f, -0.00021231061f, -0.00012778847f, -3.7588507e-05f, 5.7917314e-05f,
+        0.00015829586f, 0.0002630528f, 0.00037163278f, 0.00048342047f, 0.00059774186f, 0.0007138661f, 0.00083100784f, 0.0009483304f,
+        0.001064949f, 0.0011799351f, 0.001292321f, 0.0014011048f, 0.0015052566f, 0.0016037243f, 0.0016954405f, 0.0017793302f,
+        0.0018543181f, 0.0019193368f, 0.001973336f, 0.0020152905f, 0.0020442102f, 0.002059149f, 0.0020592154f, 0.0020435809f,
+        0.0020114915f, 0.0019622757f, 0.0018953563f, 0.0018102585f, 0.0017066196f, 0.0015841983f, 0.0014428832f, 0.0012827006f,
+        0.001103822f, 0.0009065717f, 0.00069143146f, 0.0004590465f, 0.00021022961f, -5.403605e-05f, -0.0003325947f, -0.0006241173f,
+        -0.000927102f, -0.0012398758f, -0.0015605983f, -0.0018872656f, -0.0022177172f, -0.0025496439f, -0.002880596f, -0.0032079953f,
+        -0.0035291475f, -0.0038412556f, -0.004141436f, -0.0044267355f, -0.0046941508f, -0.0049406467f, -0.0051631797f, -0.0053587193f,
+        -0.0055242716f, -0.005656906f, -0.0057537793f, -0.005812162f, -0.005829468f, -0.0058032786f, -0.005731374f, -0.0056117587f,
+        -0.0054426896f, -0.0052227043f, -0.0049506477f, -0.004625697f, -0.004247387f, -0.0038156332f, -0.0033307548f, -0.002793494f,
+        -0.0022050326f, -0.0015670097f, -0.00088153343f, -0.00015119067f, 0.0006209452f, 0.001431311f, 0.002275854f, 0.0031500354f,
+        0.0040488373f, 0.004966775f, 0.0058979127f, 0.0068358844f, 0.0077739162f, 0.008704858f, 0.009621215f, 0.010515188f,
+        0.011378713f, 0.012203511f, 0.012981135f, 0.013703032f, 0.014360594f, 0.014945226f, 0.015448412f, 0.015861781f,
+        0.016177185f, 0.016386766f, 0.016483037f, 0.016458958f, 0.016308017f, 0.016024306f, 0.015602599f, 0.015038434f,
+        0.014328188f, 0.0134691475f, 0.012459584f, 0.011298821f, 0.009987298f, 0.008526629f, 0.0069196527f, 0.0051704836f,
+        0.0032845496f, 0.001268623f, -0.000869155f, -0.0031192617f, -0.005470787f, -0.007911441f, -0.01042757f, -0.013004185f,
+        -0.015625f, -0.01827249f, -0.020927943f, -0.023571558f, -0.02618251f, -0.02873907f, -0.031218715f, -0.033598255f,
+        -0.03585397f, -0.037961766f, -0.03989734f, -0.041636348f, -0.04315459f, -0.044428196f, -0.045433845f, -0.04614896f,
+        -0.046551913f, -0.04662227f, -0.046340976f, -0.04569062f, -0.044655617f, -0.043222457f, -0.04137992f, -0.039119277f,
+        -0.036434498f, -0.033322457f, -0.029783119f, -0.025819696f, -0.021438815f, -0.016650658f, -0.011469079f, -0.0059117028f,
+        2.7306726e-17f, 0.006240661f, 0.01278099f, 0.019587785f, 0.02662396f, 0.03384862f, 0.041217152f, 0.04868137f,
+        0.056189675f, 0.06368725f, 0.07111633f, 0.07841644f, 0.08552473f, 0.092376314f, 0.09890466f, 0.10504199f,
+        0.11071973f, 0.11586903f, 0.12042119f, 0.12430829f, 0.12746365f, 0.12982251f, 0.13132253f, 0.13190453f,
+        0.13151294f, 0.1300966f, 0.12760927f, 0.12401033f, 0.11926538f, 0.11334683f, 0.10623451f, 0.09791624f,
+        0.088388346f, 0.07765619f, 0.0657346f, 0.052648317f, 0.038432326f, 0.023132185f, 0.0068042465f, -0.010484153f,
+        -0.028654613f, -0.04761764f, -0.067272715f, -0.087508455f, -0.10820284f, -0.12922357f, -0.15042849f, -0.17166613f,
+        -0.19277635f, -0.21359107f, -0.23393509f, -0.25362706f, -0.27248055f, -0.2903051f, -0.3069075f, -0.32209316f,
+        -0.33566743f, -0.34743708f, -0.35721198f, -0.36480656f, -0.37004155f, -0.37274578f, -0.3727578f, -0.36992767f,
+        -0.3641188f, -0.35520986f, -0.34309614f, -0.3276918f, -0.30893114f, -0.28677052f, -0.26118976f, -0.23219359f,
+        -0.19981314f, -0.16410701f, -0.12516245f, -0.083096296f, -0.038055625f, 0.00978157f, 0.060206074f, 0.1129773f,
+        0.16782339f, 0.2244415f, 0.28249845f, 0.34163156f, 0.4014497f, 0.46153486f, 0.5214436f, 0.5807092f,
+        0.63884395f, 0.6953415f, 0.74968f, 0.8013247f, 0.84973204f, 0.8943526f, 0.9346354f, 0.9700318f,
+        1.0f,
+      };
+      const float easeOutElastic[lut_size+1] =
+      {
+        0.0f, 0.029968204f, 0.06536462f, 0.1056474f, 0.15026796f, 0.19867527f, 0.25032002f, 0.30465847f,
+        0.36115605f, 0.4192908f, 0.47855642f, 0.53846514f, 0.59855026f, 0.6583684f, 0.7175015f, 0.7755585f,
+        0.8321766f, 0.8870227f, 0.93979394f, 0.9902184f, 1.0380557f, 1.0830963f, 1.1251625f, 1.164107f,
+        1.1998131f, 1.2321936f, 1.2611897f, 1.2867706f, 1.3089311f, 1.3276918f, 1.3430961f, 1.3552098f,
+        1.3641188f, 1.3699276f, 1.3727578f, 1.3727458f, 1.3700416f, 1.3648065f, 1.357212f, 1.3474371f,
+        1.3356674f, 1.3220931f, 1.3069075f, 1.2903051f, 1.2724806f, 1.2536271f, 1.2339351f, 1.2135911f,
+        1.1927763f, 1.1716661f, 1.1504285f, 1.1292236f, 1.1082028f, 1.0875084f, 1.0672727f, 1.0476177f,
+        1.0286546f, 1.0104841f, 0.9931958f, 0.9768678f, 0.9615677f, 0.9473517f, 0.9342654f, 0.9223438f,
+        0.9116117f, 0.90208375f, 0.8937655f, 0.8866532f, 0.8807346f, 0.8759897f, 0.87239075f, 0.8699034f,
+        0.86848706f, 0.86809546f, 0.86867744f, 0.8701775f, 0.87253636f, 0.8756917f, 0.8795788f, 0.88413095f,
+        0.88928026f, 0.894958f, 0.90109533f, 0.9076237f, 0.91447526f, 0.92158353f, 0.9288837f, 0.93631274f,
+        0.94381034f, 0.9513186f, 0.95878285f, 0.96615136f, 0.97337604f, 0.98041224f, 0.98721904f, 0.99375933f,
+        1.0f, 1.0059117f, 1.0114691f, 1.0166507f, 1.0214388f, 1.0258197f, 1.0297831f, 1.0333225f,
+        1.0364345f, 1.0391192f, 1.0413799f, 1.0432224f, 1.0446556f, 1.0456907f, 1.046341f, 1.0466223f,
+        1.046552f, 1.046149f, 1.0454339f, 1.0444282f, 1.0431546f, 1.0416363f, 1.0398973f, 1.0379617f,
+        1.035854f, 1.0335983f, 1.0312188f, 1.0287391f, 1.0261825f, 1.0235716f, 1.0209279f, 1.0182725f,
+        1.015625f, 1.0130042f, 1.0104276f, 1.0079114f, 1.0054708f, 1.0031192f, 1.0008692f, 0.9987314f,
+        0.9967154f, 0.99482954f, 0.9930803f, 0.9914734f, 0.9900127f, 0.98870116f, 0.9875404f, 0.98653084f,
+        0.9856718f, 0.98496157f, 0.9843974f, 0.9839757f, 0.983692f, 0.9835411f, 0.983517f, 0.98361325f,
+        0.9838228f, 0.9841382f, 0.9845516f, 0.9850548f, 0.9856394f, 0.98629695f, 0.9870189f, 0.9877965f,
+        0.9886213f, 0.9894848f, 0.9903788f, 0.99129516f, 0.99222606f, 0.9931641f, 0.99410206f, 0.9950332f,
+        0.9959512f, 0.99684995f, 0.9977242f, 0.9985687f, 0.99937904f, 1.0001512f, 1.0008816f, 1.001567f,
+        1.002205f, 1.0027936f, 1.0033307f, 1.0038157f, 1.0042474f, 1.0046257f, 1.0049506f, 1.0052227f,
+        1.0054427f, 1.0056118f, 1.0057313f, 1.0058032f, 1.0058295f, 1.0058122f, 1.0057538f, 1.005657f,
+        1.0055243f, 1.0053587f, 1.0051632f, 1.0049406f, 1.0046941f, 1.0044267f, 1.0041414f, 1.0038413f,
+        1.0035292f, 1.003208f, 1.0028806f, 1.0025496f, 1.0022178f, 1.0018873f, 1.0015606f, 1.0012399f,
+        1.0009271f, 1.0006241f, 1.0003326f, 1.000054f, 0.9997898f, 0.9995409f, 0.9993086f, 0.9990934f,
+        0.9988962f, 0.9987173f, 0.9985571f, 0.9984158f, 0.9982934f, 0.99818975f, 0.99810463f, 0.9980377f,
+        0.9979885f, 0.9979564f, 0.9979408f, 0.99794084f, 0.9979558f, 0.9979847f, 0.99802667f, 0.9980807f,
+        0.9981457f, 0.9982207f, 0.99830455f, 0.9983963f, 0.99849474f, 0.9985989f, 0.99870765f, 0.99882007f,
+        0.99893504f, 0.9990517f, 0.999169f, 0.9992861f, 0.9994023f, 0.9995166f, 0.99962837f, 0.99973696f,
+        0.9998417f, 0.99994206f, 1.0000376f, 1.0001278f, 1.0002123f, 1.0002909f, 1.0003631f, 1.000429f,
+        1.0f,
+      };
+      const float easeInOutElastic[lut_size+1] =
+      {
+        0.0f, 0.00014423835f, 0.00020823113f, 0.000276286f, 0.0003478029f, 0.00042205898f, 0.0004982058f, 0.0005752682f,
+        0.00065214536f, 0.0007276134f, 0.00080033025f, 0.0008688437f, 0.00093160087f, 0.0009869616f, 0.0010332137f, 0.0010685916f,
+        0.001091298f, 0.0010995282f, 0.0010914974f, 0.0010654712f, 0.0010197986f, 0.0009529467f, 0.0008635388f, 0.00075039366f,
+        0.00061256613f, 0.00044938922f, 0.0002605163f, 4.5962974e-05f, -0.0001938515f, -0.00045806472f, -0.00074533396f, -0.0010538021f,
+        -0.0013810679f, -0.0017241616f, -0.0020795257f, -0.0024430044f, -0.0028098389f, -0.003174674f, -0.003531573f, -0.0038740444f,
+        -0.00419508f, -0.004487205f, -0.004742542f, -0.004952888f, -0.005109806f, -0.00520473f, -0.005229083f, -0.0051744115f,
+        -0.0050325315f, -0.0047956877f, -0.0044567226f, -0.004009258f, -0.0034478842f, -0.0027683536f, -0.0019677824f, -0.0010448503f,
+        3.7222743e-18f, 0.0011643673f, 0.0024437062f, 0.0038311519f, 0.0053173644f, 0.006890388f, 0.008535544f, 0.010235344f,
+        0.011969444f, 0.013714639f, 0.015444892f, 0.017131425f, 0.018742852f, 0.02024537f, 0.02160301f, 0.022777967f,
+        0.023730956f, 0.024421679f, 0.02480933f, 0.02485318f, 0.02451321f, 0.023750838f, 0.022529675f, 0.020816347f,
+        0.01858136f, 0.015800014f, 0.012453323f, 0.008528981f, 0.0040223086f, -0.0010627969f, -0.006712944f, -0.012904367f,
+        -0.019602116f, -0.026759319f, -0.03431656f, -0.042201355f, -0.050327823f, -0.058596462f, -0.06689417f, -0.075094454f,
+        -0.08305788f, -0.09063275f, -0.09765613f, -0.103955045f, -0.109348066f, -0.113647215f, -0.116660096f, -0.11819244f,
+        -0.118050925f, -0.116046295f, -0.11199679f, -0.105731875f, -0.09709613f, -0.0859535f, -0.07219153f, -0.055725925f,
+        -0.036505032f, -0.014514397f, 0.010218755f, 0.037621178f, 0.06756949f, 0.09988634f, 0.13433708f, 0.1706268f,
+        0.2083981f, 0.2472295f, 0.28663474f, 0.326063f, 0.3649f, 0.40247047f, 0.43804184f, 0.4708288f,
+        0.5f, 0.52917117f, 0.5619582f, 0.59752953f, 0.6351f, 0.673937f, 0.71336526f, 0.7527705f,
+        0.7916019f, 0.8293732f, 0.86566293f, 0.90011364f, 0.9324305f, 0.9623788f, 0.98978126f, 1.0145144f,
+        1.036505f, 1.0557259f, 1.0721915f, 1.0859535f, 1.0970961f, 1.1057318f, 1.1119968f, 1.1160463f,
+        1.1180509f, 1.1181924f, 1.1166601f, 1.1136472f, 1.109348f, 1.103955f, 1.0976561f, 1.0906328f,
+        1.0830579f, 1.0750945f, 1.0668942f, 1.0585965f, 1.0503278f, 1.0422014f, 1.0343165f, 1.0267593f,
+        1.0196021f, 1.0129044f, 1.0067129f, 1.0010628f, 0.9959777f, 0.991471f, 0.9875467f, 0.9842f,
+        0.9814186f, 0.9791837f, 0.97747034f, 0.97624916f, 0.9754868f, 0.97514683f, 0.97519064f, 0.9755783f,
+        0.97626907f, 0.977222f, 0.978397f, 0.9797546f, 0.98125714f, 0.98286855f, 0.9845551f, 0.9862854f,
+        0.98803055f, 0.98976463f, 0.99146444f, 0.9931096f, 0.9946826f, 0.99616885f, 0.99755627f, 0.9988356f,
+        1.0f, 1.0010449f, 1.0019678f, 1.0027684f, 1.0034479f, 1.0040092f, 1.0044568f, 1.0047957f,
+        1.0050325f, 1.0051744f, 1.0052291f, 1.0052047f, 1.0051098f, 1.0049529f, 1.0047425f, 1.0044872f,
+        1.0041951f, 1.0038741f, 1.0035316f, 1.0031747f, 1.0028099f, 1.002443f, 1.0020795f, 1.0017241f,
+        1.001381f, 1.0010538f, 1.0007453f, 1.0004581f, 1.0001938f, 0.99995404f, 0.99973947f, 0.9995506f,
+        0.99938744f, 0.9992496f, 0.99913645f, 0.99904704f, 0.9989802f, 0.9989345f, 0.9989085f, 0.9989005f,
+        0.9989087f, 0.9989314f, 0.9989668f, 0.99901307f, 0.9990684f, 0.99913114f, 0.9991997f, 0.9992724f,
+        0.99934787f, 0.99942476f, 0.99950176f, 0.99957794f, 0.9996522f, 0.99972373f, 0.99979174f, 0.99985576f,
+        1.0f,
+      };
+      const float easeOutBounce[lut_size+1] =
+      {
+        0.0f, 0.00011539459f, 0.00046157837f, 0.0010385513f, 0.0018463135f, 0.0028848648f, 0.0041542053f, 0.005654335f,
+        0.007385254f, 0.009346962f, 0.011539459f, 0.013962746f, 0.016616821f, 0.019501686f, 0.02261734f, 0.025963783f,
+        0.029541016f, 0.033349037f, 0.037387848f, 0.041657448f, 0.046157837f, 0.050889015f, 0.055850983f, 0.06104374f,
+        0.066467285f, 0.07212162f, 0.078006744f, 0.08412266f, 0.09046936f, 0.09704685f, 0.10385513f, 0.1108942f,
+        0.11816406f, 0.12566471f, 0.13339615f, 0.14135838f, 0.14955139f, 0.1579752f, 0.16662979f, 0.17551517f,
+        0.18463135f, 0.19397831f, 0.20355606f, 0.2133646f, 0.22340393f, 0.23367405f, 0.24417496f, 0.25490665f,
+        0.26586914f, 0.27706242f, 0.28848648f, 0.30014133f, 0.31202698f, 0.3241434f, 0.33649063f, 0.34906864f,
+        0.36187744f, 0.37491703f, 0.3881874f, 0.40168858f, 0.41542053f, 0.42938328f, 0.4435768f, 0.45800114f,
+        0.47265625f, 0.48754215f, 0.50265884f, 0.5180063f, 0.5335846f, 0.54939365f, 0.5654335f, 0.58170414f,
+        0.59820557f, 0.6149378f, 0.6319008f, 0.6490946f, 0.66651917f, 0.68417454f, 0.7020607f, 0.72017765f,
+        0.7385254f, 0.7571039f, 0.77591324f, 0.79495335f, 0.81422424f, 0.8337259f, 0.8534584f, 0.87342167f,
+        0.8936157f, 0.91404057f, 0.9346962f, 0.9555826f, 0.9766998f, 0.9980478f, 0.99032974f, 0.97991276f,
+        0.96972656f, 0.95977116f, 0.95004654f, 0.9405527f, 0.9312897f, 0.9222574f, 0.91345596f, 0.9048853f,
+        0.8965454f, 0.8884363f, 0.880558f, 0.8729105f, 0.8654938f, 0.85830784f, 0.8513527f, 0.84462833f,
+        0.83813477f, 0.831872f, 0.82584f, 0.8200388f, 0.8144684f, 0.80912876f, 0.8040199f, 0.7991419f,
+        0.7944946f, 0.79007816f, 0.7858925f, 0.7819376f, 0.7782135f, 0.7747202f, 0.7714577f, 0.76842594f,
+        0.765625f, 0.76305485f, 0.7607155f, 0.7586069f, 0.7567291f, 0.75508213f, 0.7536659f, 0.7524805f,
+        0.7515259f, 0.75080204f, 0.750309f, 0.75004673f, 0.75001526f, 0.7502146f, 0.7506447f, 0.7513056f,
+        0.75219727f, 0.75331974f, 0.754673f, 0.75625706f, 0.7580719f, 0.76011753f, 0.76239395f, 0.76490116f,
+        0.76763916f, 0.77060795f, 0.7738075f, 0.7772379f, 0.78089905f, 0.784791f, 0.7889137f, 0.79326725f,
+        0.79785156f, 0.80266666f, 0.80771255f, 0.81298923f, 0.8184967f, 0.82423496f, 0.830204f, 0.83640385f,
+        0.8428345f, 0.8494959f, 0.8563881f, 0.8635111f, 0.87086487f, 0.87844944f, 0.8862648f, 0.89431095f,
+        0.9025879f, 0.9110956f, 0.91983414f, 0.92880344f, 0.93800354f, 0.9474344f, 0.9570961f, 0.96698856f,
+        0.9771118f, 0.98746586f, 0.9980507f, 0.9956827f, 0.99061584f, 0.98577976f, 0.98117447f, 0.97679996f,
+        0.97265625f, 0.9687433f, 0.9650612f, 0.96160984f, 0.9583893f, 0.9553995f, 0.95264053f, 0.95011234f,
+        0.94781494f, 0.9457483f, 0.9439125f, 0.9423075f, 0.9409332f, 0.9397898f, 0.9388771f, 0.9381952f,
+        0.93774414f, 0.93752384f, 0.93753433f, 0.9377756f, 0.9382477f, 0.93895054f, 0.9398842f, 0.9410486f,
+        0.94244385f, 0.94406986f, 0.94592667f, 0.94801426f, 0.95033264f, 0.9528818f, 0.9556618f, 0.9586725f,
+        0.96191406f, 0.9653864f, 0.9690895f, 0.9730234f, 0.9771881f, 0.9815836f, 0.98620987f, 0.99106693f,
+        0.9961548f, 0.99927616f, 0.99676895f, 0.99449253f, 0.9924469f, 0.99063206f, 0.989048f, 0.98769474f,
+        0.98657227f, 0.9856806f, 0.9850197f, 0.9845896f, 0.98439026f, 0.98442173f, 0.984684f, 0.98517704f,
+        0.9859009f, 0.9868555f, 0.9880409f, 0.98945713f, 0.9911041f, 0.9929819f, 0.9950905f, 0.99742985f,
+        1.0f,
+      };
+      const float easeInBounce[lut_size+1] =
+      {
+        0.0f, 0.0025701523f, 0.0049095154f, 0.0070180893f, 0.008895874f, 0.01054287f, 0.011959076f, 0.013144493f,
+        0.014099121f, 0.01482296f, 0.0153160095f, 0.01557827f, 0.015609741f, 0.015410423f, 0.014980316f, 0.01431942f,
+        0.013427734f, 0.01230526f, 0.010951996f, 0.009367943f, 0.0075531006f, 0.005507469f, 0.0032310486f, 0.0007238388f,
+        0.0038452148f, 0.008933067f, 0.013790131f, 0.018416405f, 0.02281189f, 0.026976585f, 0.030910492f, 0.03461361f,
+        0.038085938f, 0.041327477f, 0.044338226f, 0.047118187f, 0.04966736f, 0.05198574f, 0.054073334f, 0.055930138f,
+        0.057556152f, 0.058951378f, 0.060115814f, 0.06104946f, 0.06175232f, 0.062224388f, 0.062465668f, 0.06247616f,
+        0.06225586f, 0.06180477f, 0.061122894f, 0.060210228f, 0.059066772f, 0.057692528f, 0.056087494f, 0.05425167f,
+        0.05218506f, 0.049887657f, 0.047359467f, 0.044600487f, 0.041610718f, 0.03839016f, 0.034938812f, 0.031256676f,
+        0.02734375f, 0.023200035f, 0.018825531f, 0.014220238f, 0.009384155f, 0.0043172836f, 0.0019493103f, 0.012534142f,
+        0.022888184f, 0.033011436f, 0.0429039f, 0.052565575f, 0.06199646f, 0.071196556f, 0.08016586f, 0.08890438f,
+        0.09741211f, 0.10568905f, 0.1137352f, 0.12155056f, 0.12913513f, 0.13648891f, 0.14361191f, 0.15050411f,
+        0.15716553f, 0.16359615f, 0.16979599f, 0.17576504f, 0.1815033f, 0.18701077f, 0.19228745f, 0.19733334f,
+        0.20214844f, 0.20673275f, 0.21108627f, 0.215209f, 0.21910095f, 0.22276211f, 0.22619247f, 0.22939205f,
+        0.23236084f, 0.23509884f, 0.23760605f, 0.23988247f, 0.2419281f, 0.24374294f, 0.245327f, 0.24668026f,
+        0.24780273f, 0.24869442f, 0.24935532f, 0.24978542f, 0.24998474f, 0.24995327f, 0.24969101f, 0.24919796f,
+        0.24847412f, 0.2475195f, 0.24633408f, 0.24491787f, 0.24327087f, 0.24139309f, 0.23928452f, 0.23694515f,
+        0.234375f, 0.23157406f, 0.22854233f, 0.22527981f, 0.2217865f, 0.2180624f, 0.21410751f, 0.20992184f,
+        0.20550537f, 0.20085812f, 0.19598007f, 0.19087124f, 0.18553162f, 0.1799612f, 0.17416f, 0.16812801f,
+        0.16186523f, 0.15537167f, 0.14864731f, 0.14169216f, 0.13450623f, 0.1270895f, 0.119441986f, 0.11156368f,
+        0.10345459f, 0.09511471f, 0.08654404f, 0.07774258f, 0.06871033f, 0.05944729f, 0.04995346f, 0.040228844f,
+        0.030273438f, 0.020087242f, 0.009670258f, 0.0019521713f, 0.02330017f, 0.04441738f, 0.0653038f, 0.085959435f,
+        0.10638428f, 0.12657833f, 0.1465416f, 0.16627407f, 0.18577576f, 0.20504665f, 0.22408676f, 0.24289608f,
+        0.2614746f, 0.27982235f, 0.2979393f, 0.31582546f, 0.33348083f, 0.35090542f, 0.3680992f, 0.38506222f,
+        0.40179443f, 0.41829586f, 0.4345665f, 0.45060635f, 0.4664154f, 0.48199368f, 0.49734116f, 0.51245785f,
+        0.52734375f, 0.54199886f, 0.5564232f, 0.5706167f, 0.58457947f, 0.5983114f, 0.6118126f, 0.62508297f,
+        0.63812256f, 0.65093136f, 0.66350937f, 0.6758566f, 0.687973f, 0.69985867f, 0.7115135f, 0.7229376f,
+        0.73413086f, 0.74509335f, 0.75582504f, 0.76632595f, 0.77659607f, 0.7866354f, 0.79644394f, 0.8060217f,
+        0.81536865f, 0.8244848f, 0.8333702f, 0.8420248f, 0.8504486f, 0.8586416f, 0.86660385f, 0.8743353f,
+        0.88183594f, 0.8891058f, 0.89614487f, 0.90295315f, 0.90953064f, 0.91587734f, 0.92199326f, 0.9278784f,
+        0.9335327f, 0.93895626f, 0.944149f, 0.949111f, 0.95384216f, 0.95834255f, 0.96261215f, 0.96665096f,
+        0.970459f, 0.9740362f, 0.97738266f, 0.9804983f, 0.9833832f, 0.98603725f, 0.98846054f, 0.99065304f,
+        0.99261475f, 0.99434566f, 0.9958458f, 0.99711514f, 0.9981537f, 0.99896145f, 0.9995384f, 0.9998846f,
+        1.0f,
+      };
+      const float easeInOutBounce[lut_size+1] =
+      {
+        0.0f, 0.0024547577f, 0.004447937f, 0.005979538f, 0.0070495605f, 0.0076580048f, 0.0078048706f, 0.007490158f,
+        0.006713867f, 0.005475998f, 0.0037765503f, 0.0016155243f, 0.0019226074f, 0.0068950653f, 0.011405945f, 0.015455246f,
+        0.019042969f, 0.022169113f, 0.02483368f, 0.027036667f, 0.028778076f, 0.030057907f, 0.03087616f, 0.031232834f,
+        0.03112793f, 0.030561447f, 0.029533386f, 0.028043747f, 0.02609253f, 0.023679733f, 0.020805359f, 0.017469406f,
+        0.013671875f, 0.0094127655f, 0.0046920776f, 0.00097465515f, 0.011444092f, 0.02145195f, 0.03099823f, 0.04008293f,
+        0.048706055f, 0.0568676f, 0.064567566f, 0.071805954f, 0.07858276f, 0.084897995f, 0.09075165f, 0.09614372f,
+        0.10107422f, 0.10554314f, 0.109550476f, 0.11309624f, 0.11618042f, 0.118803024f, 0.12096405f, 0.1226635f,
+        0.12390137f, 0.12467766f, 0.12499237f, 0.124845505f, 0.12423706f, 0.12316704f, 0.12163544f, 0.11964226f,
+        0.1171875f, 0.114271164f, 0.11089325f, 0.10705376f, 0.102752686f, 0.097990036f, 0.09276581f, 0.08708f,
+        0.08093262f, 0.074323654f, 0.06725311f, 0.059720993f, 0.051727295f, 0.04327202f, 0.034355164f, 0.02497673f,
+        0.015136719f, 0.004835129f, 0.011650085f, 0.0326519f, 0.05319214f, 0.0732708f, 0.09288788f, 0.11204338f,
+        0.1307373f, 0.14896965f, 0.16674042f, 0.1840496f, 0.20089722f, 0.21728325f, 0.2332077f, 0.24867058f,
+        0.26367188f, 0.2782116f, 0.29228973f, 0.3059063f, 0.31906128f, 0.33175468f, 0.3439865f, 0.35575676f,
+        0.36706543f, 0.37791252f, 0.38829803f, 0.39822197f, 0.40768433f, 0.4166851f, 0.4252243f, 0.43330193f,
+        0.44091797f, 0.44807243f, 0.45476532f, 0.46099663f, 0.46676636f, 0.4720745f, 0.47692108f, 0.48130608f,
+        0.4852295f, 0.48869133f, 0.4916916f, 0.49423027f, 0.49630737f, 0.4979229f, 0.49907684f, 0.4997692f,
+        0.5f, 0.5002308f, 0.50092316f, 0.5020771f, 0.5036926f, 0.5057697f, 0.5083084f, 0.51130867f,
+        0.5147705f, 0.5186939f, 0.5230789f, 0.5279255f, 0.53323364f, 0.5390034f, 0.5452347f, 0.55192757f,
+        0.55908203f, 0.5666981f, 0.5747757f, 0.5833149f, 0.5923157f, 0.60177803f, 0.61170197f, 0.6220875f,
+        0.6329346f, 0.64424324f, 0.6560135f, 0.6682453f, 0.6809387f, 0.6940937f, 0.70771027f, 0.7217884f,
+        0.7363281f, 0.7513294f, 0.7667923f, 0.78271675f, 0.7991028f, 0.8159504f, 0.8332596f, 0.85103035f,
+        0.8692627f, 0.8879566f, 0.9071121f, 0.9267292f, 0.94680786f, 0.9673481f, 0.9883499f, 0.9951649f,
+        0.9848633f, 0.97502327f, 0.96564484f, 0.956728f, 0.9482727f, 0.940279f, 0.9327469f, 0.92567635f,
+        0.9190674f, 0.91292f, 0.9072342f, 0.90200996f, 0.8972473f, 0.89294624f, 0.88910675f, 0.88572884f,
+        0.8828125f, 0.88035774f, 0.87836456f, 0.87683296f, 0.87576294f, 0.8751545f, 0.8750076f, 0.87532234f,
+        0.87609863f, 0.8773365f, 0.87903595f, 0.881197f, 0.8838196f, 0.88690376f, 0.8904495f, 0.89445686f,
+        0.8989258f, 0.9038563f, 0.90924835f, 0.915102f, 0.92141724f, 0.92819405f, 0.93543243f, 0.9431324f,
+        0.95129395f, 0.95991707f, 0.96900177f, 0.97854805f, 0.9885559f, 0.99902534f, 0.9953079f, 0.99058723f,
+        0.9863281f, 0.9825306f, 0.97919464f, 0.97632027f, 0.9739075f, 0.97195625f, 0.9704666f, 0.96943855f,
+        0.9688721f, 0.96876717f, 0.96912384f, 0.9699421f, 0.9712219f, 0.97296333f, 0.9751663f, 0.9778309f,
+        0.98095703f, 0.98454475f, 0.98859406f, 0.99310493f, 0.9980774f, 0.9983845f, 0.99622345f, 0.994524f,
+        0.99328613f, 0.99250984f, 0.9921951f, 0.992342f, 0.99295044f, 0.99402046f, 0.99555206f, 0.99754524f,
+        1.0f,
+      };
+      const float Cubic_Polynomial_C1[lut_size+1] =
+      {
+        0.0f, 4.5657158e-05f, 0.0001821518f, 0.00040876865f, 0.0007247925f, 0.001129508f, 0.0016222f, 0.0022021532f,
+        0.0028686523f, 0.0036209822f, 0.0044584274f, 0.005380273f, 0.006385803f, 0.0074743032f, 0.008645058f, 0.009897351f,
+        0.011230469f, 0.012643695f, 0.014136314f, 0.015707612f, 0.017356873f, 0.01908338f, 0.020886421f, 0.022765279f,
+        0.024719238f, 0.026747584f, 0.028849602f, 0.031024575f, 0.03327179f, 0.03559053f, 0.03798008f, 0.040439725f,
+        0.04296875f, 0.04556644f, 0.04823208f, 0.05096495f, 0.053764343f, 0.05662954f, 0.059559822f, 0.06255448f,
+        0.06561279f, 0.06873405f, 0.071917534f, 0.07516253f, 0.07846832f, 0.0818342f, 0.08525944f, 0.08874333f,
+        0.092285156f, 0.095884204f, 0.09953976f, 0.1032511f, 0.10701752f, 0.110838294f, 0.114712715f, 0.118640065f,
+        0.12261963f, 0.12665069f, 0.13073254f, 0.13486445f, 0.13904572f, 0.14327562f, 0.14755344f, 0.15187848f,
+        0.15625f, 0.1606673f, 0.16512966f, 0.16963637f, 0.1741867f, 0.17877996f, 0.18341541f, 0.18809235f,
+        0.19281006f, 0.19756782f, 0.20236492f, 0.20720065f, 0.21207428f, 0.2169851f, 0.22193241f, 0.22691548f,
+        0.2319336f, 0.23698604f, 0.2420721f, 0.24719107f, 0.25234222f, 0.25752485f, 0.26273823f, 0.26798165f,
+        0.2732544f, 0.27855575f, 0.283885f, 0.28924143f, 0.29462433f, 0.30003297f, 0.30546665f, 0.31092465f,
+        0.31640625f, 0.32191074f, 0.3274374f, 0.33298552f, 0.33855438f, 0.34414327f, 0.34975147f, 0.35537827f,
+        0.36102295f, 0.3666848f, 0.3723631f, 0.37805712f, 0.38376617f, 0.38948953f, 0.39522648f, 0.4009763f,
+        0.40673828f, 0.4125117f, 0.41829586f, 0.42409003f, 0.4298935f, 0.43570554f, 0.44152546f, 0.44735253f,
+        0.45318604f, 0.45902526f, 0.4648695f, 0.47071803f, 0.47657013f, 0.4824251f, 0.4882822f, 0.49414074f,
+        0.5f, 0.50585926f, 0.5117178f, 0.5175749f, 0.5234299f, 0.529282f, 0.5351305f, 0.54097474f,
+        0.54681396f, 0.5526475f, 0.55847454f, 0.56429446f, 0.5701065f, 0.57591f, 0.58170414f, 0.5874883f,
+        0.5932617f, 0.5990237f, 0.6047735f, 0.61051047f, 0.6162338f, 0.6219429f, 0.6276369f, 0.6333152f,
+        0.63897705f, 0.64462173f, 0.6502485f, 0.6558567f, 0.6614456f, 0.6670145f, 0.6725626f, 0.67808926f,
+        0.68359375f, 0.68907535f, 0.69453335f, 0.699967f, 0.7053757f, 0.71075857f, 0.716115f, 0.72144425f,
+        0.7267456f, 0.73201835f, 0.7372618f, 0.74247515f, 0.7476578f, 0.7528089f, 0.7579279f, 0.76301396f,
+        0.7680664f, 0.7730845f, 0.7780676f, 0.7830149f, 0.7879257f, 0.79279935f, 0.7976351f, 0.8024322f,
+        0.80718994f, 0.81190765f, 0.8165846f, 0.82122004f, 0.8258133f, 0.83036363f, 0.83487034f, 0.8393327f,
+        0.84375f, 0.8481215f, 0.85244656f, 0.8567244f, 0.8609543f, 0.86513555f, 0.86926746f, 0.8733493f,
+        0.8773804f, 0.88135993f, 0.8852873f, 0.8891617f, 0.8929825f, 0.8967489f, 0.90046024f, 0.9041158f,
+        0.90771484f, 0.9112567f, 0.91474056f, 0.9181658f, 0.9215317f, 0.92483747f, 0.92808247f, 0.93126595f,
+        0.9343872f, 0.9374455f, 0.9404402f, 0.94337046f, 0.94623566f, 0.94903505f, 0.9517679f, 0.95443356f,
+        0.95703125f, 0.9595603f, 0.9620199f, 0.9644095f, 0.9667282f, 0.9689754f, 0.9711504f, 0.9732524f,
+        0.97528076f, 0.9772347f, 0.9791136f, 0.9809166f, 0.9826431f, 0.9842924f, 0.9858637f, 0.9873563f,
+        0.98876953f, 0.99010265f, 0.99135494f, 0.9925257f, 0.9936142f, 0.9946197f, 0.9955416f, 0.996379f,
+        0.99713135f, 0.99779785f, 0.9983778f, 0.9988705f, 0.9992752f, 0.99959123f, 0.99981785f, 0.99995434f,
+        1.0f,
+      };
+      const float Cubic_Polynomial_C1_inv[lut_size+1] =
+      {
+        5.551115e-17f, 0.036531996f, 0.051938146f, 0.06387479f, 0.07401811f, 0.08301713f, 0.09120458f, 0.09877808f,
+        0.10586631f, 0.11255867f, 0.1189202f, 0.125f, 0.1308362f, 0.13645914f, 0.14189337f, 0.14715916f,
+        0.15227343f, 0.15725048f, 0.16210255f, 0.16684021f, 0.17147261f, 0.17600782f, 0.18045291f, 0.18481421f,
+        0.18909734f, 0.19330731f, 0.1974487f, 0.2015256f, 0.20554173f, 0.20950052f, 0.21340507f, 0.21725823f,
+        0.22106265f, 0.22482073f, 0.22853474f, 0.23220675f, 0.23583867f, 0.23943233f, 0.2429894f, 0.24651147f,
+        0.25f, 0.25345635f, 0.25688186f, 0.26027775f, 0.26364514f, 0.26698515f, 0.2702988f, 0.27358708f,
+        0.2768509f, 0.28009114f, 0.28330863f, 0.28650418f, 0.28967854f, 0.29283243f, 0.29596654f, 0.29908153f,
+        0.30217803f, 0.30525666f, 0.30831796f, 0.3113625f, 0.31439084f, 0.31740344f, 0.32040083f, 0.32338348f,
+        0.32635182f, 0.3293063f, 0.33224738f, 0.33517542f, 0.33809084f, 0.340994f, 0.34388527f, 0.34676504f,
+        0.3496336f, 0.35249135f, 0.35533857f, 0.3581756f, 0.3610027f, 0.36382025f, 0.36662847f, 0.36942765f,
+        0.37221807f, 0.375f, 0.3777737f, 0.38053942f, 0.3832974f, 0.38604793f, 0.38879117f, 0.3915274f,
+        0.39425683f, 0.39697966f, 0.39969614f, 0.40240645f, 0.40511084f, 0.40780947f, 0.41050252f, 0.41319025f,
+        0.4158728f, 0.41855037f, 0.42122316f, 0.42389137f, 0.4265551f, 0.4292146f, 0.43187f, 0.43452153f,
+        0.43716928f, 0.43981346f, 0.44245425f, 0.44509178f, 0.44772622f, 0.4503577f, 0.45298645f, 0.45561257f,
+        0.45823622f, 0.46085754f, 0.46347672f, 0.46609387f, 0.46870914f, 0.47132272f, 0.4739347f, 0.4765453f,
+        0.4791546f, 0.48176274f, 0.4843699f, 0.48697624f, 0.48958182f, 0.49218687f, 0.49479148f, 0.4973958f,
+        0.5f, 0.5026042f, 0.5052085f, 0.50781316f, 0.5104182f, 0.5130238f, 0.51563007f, 0.51823723f,
+        0.5208454f, 0.5234547f, 0.5260653f, 0.5286773f, 0.5312908f, 0.53390616f, 0.5365233f, 0.5391425f,
+        0.5417638f, 0.54438746f, 0.5470135f, 0.54964226f, 0.5522738f, 0.5549082f, 0.5575458f, 0.5601865f,
+        0.5628307f, 0.5654785f, 0.56812996f, 0.5707854f, 0.5734449f, 0.57610863f, 0.57877684f, 0.5814496f,
+        0.5841272f, 0.58680975f, 0.58949745f, 0.59219056f, 0.59488916f, 0.59759355f, 0.6003038f, 0.6030203f,
+        0.60574317f, 0.6084726f, 0.6112088f, 0.61395204f, 0.61670256f, 0.6194606f, 0.6222263f, 0.625f,
+        0.6277819f, 0.6305724f, 0.63337153f, 0.63617975f, 0.63899726f, 0.6418244f, 0.6446614f, 0.6475086f,
+        0.65036637f, 0.65323496f, 0.65611476f, 0.659006f, 0.66190916f, 0.6648246f, 0.6677526f, 0.6706937f,
+        0.6736482f, 0.67661655f, 0.67959917f, 0.68259656f, 0.68560916f, 0.6886375f, 0.69168204f, 0.69474334f,
+        0.697822f, 0.70091844f, 0.70403343f, 0.70716757f, 0.7103215f, 0.7134958f, 0.7166914f, 0.71990883f,
+        0.7231491f, 0.7264129f, 0.72970116f, 0.7330148f, 0.7363548f, 0.73972225f, 0.7431181f, 0.74654365f,
+        0.75f, 0.75348854f, 0.7570106f, 0.76056767f, 0.76416135f, 0.76779324f, 0.77146524f, 0.77517927f,
+        0.77893734f, 0.7827418f, 0.7865949f, 0.7904995f, 0.79445827f, 0.79847443f, 0.8025513f, 0.80669266f,
+        0.81090266f, 0.8151858f, 0.81954706f, 0.8239922f, 0.8285274f, 0.8331598f, 0.8378974f, 0.84274954f,
+        0.8477266f, 0.85284084f, 0.8581066f, 0.8635409f, 0.8691638f, 0.875f, 0.8810798f, 0.88744134f,
+        0.8941337f, 0.90122193f, 0.9087954f, 0.9169829f, 0.9259819f, 0.9361252f, 0.9480618f, 0.963468f,
+        1.0f,
+      };
+      const float Quartic_Polynomial_C1[lut_size+1] =
+      {
+        0.0f, 3.0517345e-05f, 0.00012206659f, 0.00027463934f, 0.00048822165f, 0.00076279393f, 0.0010983311f, 0.0014948023f,
+        0.0019521713f, 0.0024703962f, 0.0030494295f, 0.003689218f, 0.0043897033f, 0.005150821f, 0.005972501f, 0.0068546683f,
+        0.007797241f, 0.008800134f, 0.009863254f, 0.010986503f, 0.012169778f, 0.013412971f, 0.014715966f, 0.016078644f,
+        0.017500877f, 0.018982537f, 0.020523485f, 0.022123579f, 0.02378267f, 0.025500607f, 0.027277227f, 0.029112369f,
+        0.03100586f, 0.032957524f, 0.03496718f, 0.037034642f, 0.039159715f, 0.041342203f, 0.0435819f, 0.045878597f,
+        0.04823208f, 0.050642125f, 0.05310851f, 0.055631f, 0.05820936f, 0.060843345f, 0.06353271f, 0.06627719f,
+        0.06907654f, 0.07193048f, 0.07483876f, 0.07780107f, 0.08081716f, 0.08388673f, 0.08700949f, 0.09018513f,
+        0.09341335f, 0.09669385f, 0.10002631f, 0.10341039f, 0.106845796f, 0.11033217f, 0.11386919f, 0.117456496f,
+        0.12109375f, 0.124780595f, 0.12851667f, 0.13230161f, 0.13613504f, 0.14001659f, 0.14394587f, 0.14792249f,
+        0.15194607f, 0.15601619f, 0.16013247f, 0.16429447f, 0.1685018f, 0.17275402f, 0.17705071f, 0.18139143f,
+        0.18577576f, 0.19020323f, 0.19467342f, 0.19918585f, 0.20374006f, 0.2083356f, 0.21297199f, 0.21764873f,
+        0.22236538f, 0.22712141f, 0.23191637f, 0.23674971f, 0.24162096f, 0.2465296f, 0.2514751f, 0.25645694f,
+        0.2614746f, 0.26652756f, 0.27161527f, 0.27673715f, 0.28189272f, 0.28708136f, 0.29230255f, 0.29755569f,
+        0.30284023f, 0.3081556f, 0.31350118f, 0.31887642f, 0.32428068f, 0.3297134f, 0.33517396f, 0.34066173f,
+        0.34617615f, 0.35171652f, 0.35728228f, 0.36287275f, 0.3684873f, 0.3741253f, 0.37978607f, 0.385469f,
+        0.39117336f, 0.39689854f, 0.40264386f, 0.4084086f, 0.41419214f, 0.41999373f, 0.42581272f, 0.43164837f,
+        0.4375f, 0.4433669f, 0.4492483f, 0.45514354f, 0.46105188f, 0.46697256f, 0.47290486f, 0.478848f,
+        0.4848013f, 0.49076393f, 0.49673516f, 0.5027142f, 0.5087003f, 0.51469266f, 0.52069056f, 0.5266931f,
+        0.5326996f, 0.53870916f, 0.544721f, 0.55073434f, 0.55674833f, 0.56276214f, 0.568775f, 0.574786f,
+        0.58079433f, 0.58679914f, 0.5927996f, 0.5987948f, 0.60478395f, 0.6107661f, 0.61674047f, 0.62270606f,
+        0.6286621f, 0.6346076f, 0.6405418f, 0.64646363f, 0.6523723f, 0.65826684f, 0.66414636f, 0.6700099f,
+        0.6758566f, 0.68168545f, 0.6874955f, 0.6932859f, 0.6990556f, 0.7048037f, 0.7105292f, 0.71623117f,
+        0.72190857f, 0.72756046f, 0.7331859f, 0.7387838f, 0.74435323f, 0.7498932f, 0.7554026f, 0.76088053f,
+        0.76632595f, 0.7717378f, 0.77711505f, 0.7824567f, 0.7877616f, 0.7930289f, 0.79825735f, 0.803446f,
+        0.80859375f, 0.81369954f, 0.8187623f, 0.82378095f, 0.82875437f, 0.8336815f, 0.83856124f, 0.8433925f,
+        0.8481741f, 0.852905f, 0.85758406f, 0.86221015f, 0.8667821f, 0.87129885f, 0.87575924f, 0.88016206f,
+        0.8845062f, 0.88879055f, 0.89301383f, 0.89717495f, 0.9012727f, 0.9053059f, 0.90927345f, 0.91317403f,
+        0.9170065f, 0.92076963f, 0.92446226f, 0.9280831f, 0.931631f, 0.9351047f, 0.938503f, 0.9418246f,
+        0.94506836f, 0.9482329f, 0.9513171f, 0.95431954f, 0.9572391f, 0.9600744f, 0.9628243f, 0.96548736f,
+        0.9680624f, 0.9705481f, 0.9729431f, 0.9752462f, 0.97745603f, 0.9795713f, 0.9815906f, 0.98351276f,
+        0.9853363f, 0.98705995f, 0.9886824f, 0.9902022f, 0.9916181f, 0.9929287f, 0.9941326f, 0.9952284f,
+        0.99621487f, 0.9970905f, 0.99785393f, 0.9985038f, 0.99903864f, 0.9994571f, 0.99975777f, 0.9999392f,
+        1.0f,
+      };
+      const float Quartic_Polynomial_C1_inv[lut_size+1] =
+      {
+        0.0f, 0.04421579f, 0.062561244f, 0.07665926f, 0.088562176f, 0.09906452f, 0.10857362f, 0.1173313f,
+        0.12549508f, 0.13317432f, 0.14044859f, 0.14737795f, 0.15400906f, 0.160379f, 0.1665178f, 0.17245023f,
+        0.17819698f, 0.18377553f, 0.18920085f, 0.19448581f, 0.19964163f, 0.20467815f, 0.20960401f, 0.21442692f,
+        0.21915375f, 0.22379062f, 0.2283431f, 0.23281619f, 0.23721445f, 0.24154203f, 0.24580272f, 0.25f,
+        0.25413707f, 0.2582169f, 0.2622422f, 0.26621553f, 0.27013922f, 0.27401546f, 0.27784628f, 0.28163365f,
+        0.2853793f, 0.28908494f, 0.29275215f, 0.2963824f, 0.2999771f, 0.30353758f, 0.30706507f, 0.31056076f,
+        0.31402576f, 0.31746116f, 0.32086796f, 0.3242471f, 0.32759953f, 0.3309261f, 0.33422762f, 0.33750492f,
+        0.34075874f, 0.34398982f, 0.34719884f, 0.3503865f, 0.35355338f, 0.35670015f, 0.35982737f, 0.3629356f,
+        0.36602542f, 0.3690973f, 0.3721518f, 0.37518936f, 0.37821048f, 0.38121563f, 0.38420522f, 0.38717967f,
+        0.3901394f, 0.39308482f, 0.3960163f, 0.39893422f, 0.4018389f, 0.40473077f, 0.4076101f, 0.41047725f,
+        0.41333255f, 0.4161763f, 0.4190088f, 0.42183036f, 0.42464125f, 0.42744175f, 0.43023214f, 0.4330127f,
+        0.43578368f, 0.43854532f, 0.4412979f, 0.4440416f, 0.44677675f, 0.4495035f, 0.45222214f, 0.45493287f,
+        0.45763588f, 0.46033138f, 0.46301964f, 0.4657008f, 0.46837512f, 0.47104275f, 0.47370392f, 0.4763588f,
+        0.47900757f, 0.48165044f, 0.4842876f, 0.48691916f, 0.48954538f, 0.4921664f, 0.49478242f, 0.49739355f,
+        0.5f, 0.5026019f, 0.5051995f, 0.5077929f, 0.51038224f, 0.5129677f, 0.5155495f, 0.5181276f,
+        0.5207024f, 0.52327394f, 0.52584237f, 0.5284078f, 0.5309705f, 0.53353053f, 0.536088f, 0.5386432f,
+        0.5411961f, 0.54374695f, 0.54629594f, 0.5488431f, 0.5513887f, 0.5539327f, 0.55647546f, 0.559017f,
+        0.5615575f, 0.56409705f, 0.5666359f, 0.5691741f, 0.57171184f, 0.5742492f, 0.57678646f, 0.57932365f,
+        0.58186096f, 0.5843985f, 0.58693653f, 0.58947504f, 0.5920143f, 0.5945544f, 0.59709555f, 0.59963787f,
+        0.6021815f, 0.6047266f, 0.60727334f, 0.6098219f, 0.61237246f, 0.6149251f, 0.61748004f, 0.62003744f,
+        0.62259746f, 0.6251603f, 0.6277261f, 0.63029504f, 0.63286734f, 0.63544315f, 0.63802266f, 0.6406061f,
+        0.6431936f, 0.6457854f, 0.6483817f, 0.6509827f, 0.6535886f, 0.6561996f, 0.6588159f, 0.6614378f,
+        0.66406554f, 0.66669923f, 0.6693392f, 0.6719857f, 0.67463887f, 0.67729914f, 0.6799667f, 0.68264174f,
+        0.68532467f, 0.6880157f, 0.6907152f, 0.6934234f, 0.69614065f, 0.69886726f, 0.7016036f, 0.70435f,
+        0.70710677f, 0.7098744f, 0.71265316f, 0.7154435f, 0.71824586f, 0.7210606f, 0.7238882f, 0.7267292f,
+        0.72958404f, 0.7324531f, 0.73533714f, 0.7382365f, 0.74115187f, 0.7440838f, 0.747033f, 0.75f,
+        0.7529856f, 0.75599045f, 0.7590154f, 0.7620612f, 0.7651287f, 0.76821876f, 0.77133244f, 0.7744706f,
+        0.77763444f, 0.78082496f, 0.78404343f, 0.78729117f, 0.7905694f, 0.79387975f, 0.7972236f, 0.8006028f,
+        0.80401903f, 0.8074743f, 0.81097066f, 0.8145104f, 0.81809604f, 0.8217302f, 0.82541585f, 0.8291562f,
+        0.8329548f, 0.8368157f, 0.8407431f, 0.844742f, 0.8488177f, 0.85297644f, 0.8572251f, 0.8615718f,
+        0.8660254f, 0.87059665f, 0.8752979f, 0.88014376f, 0.88515174f, 0.8903432f, 0.8957442f, 0.9013878f,
+        0.90731657f, 0.9135866f, 0.92027545f, 0.92749435f, 0.9354144f, 0.9443235f, 0.95478356f, 0.96824586f,
+        1.0f,
+      };
+      const float Quintic_Polynomial_C2[lut_size+1] =
+      {
+        0.0f, 5.9255945e-07f, 4.712667e-06f, 1.581169e-05f, 3.725849e-05f, 7.234007e-05f, 0.00012426224f, 0.00019615026f,
+        0.00029104948f, 0.00041192607f, 0.00056166755f, 0.0007430836f, 0.0009589065f, 0.001211792f, 0.00150432f, 0.0018389949f,
+        0.0022182465f, 0.0026444306f, 0.0031198298f, 0.0036466538f, 0.0042270403f, 0.004863056f, 0.005556696f, 0.0063098865f,
+        0.0071244836f, 0.008002275f, 0.008944978f, 0.009954248f, 0.011031667f, 0.012178755f, 0.013396966f, 0.014687688f,
+        0.016052246f, 0.017491901f, 0.01900785f, 0.02060123f, 0.022273114f, 0.024024516f, 0.02585639f, 0.02776963f,
+        0.02976507f, 0.031843483f, 0.034005594f, 0.03625206f, 0.038583487f, 0.04100043f, 0.043503378f, 0.04609277f,
+        0.048768997f, 0.05153239f, 0.054383237f, 0.057321757f, 0.06034814f, 0.0634625f, 0.06666493f, 0.069955446f,
+        0.07333404f, 0.07680064f, 0.08035513f, 0.08399735f, 0.08772709f, 0.091544114f, 0.09544811f, 0.09943874f,
+        0.103515625f, 0.10767834f, 0.11192641f, 0.11625933f, 0.120676555f, 0.12517749f, 0.1297615f, 0.13442793f,
+        0.13917607f, 0.14400518f, 0.14891447f, 0.15390313f, 0.15897031f, 0.16411513f, 0.16933666f, 0.17463395f,
+        0.18000603f, 0.18545185f, 0.19097039f, 0.19656056f, 0.20222124f, 0.2079513f, 0.21374957f, 0.21961486f,
+        0.22554594f, 0.23154156f, 0.23760043f, 0.24372126f, 0.24990274f, 0.25614348f, 0.26244214f, 0.26879728f,
+        0.27520752f, 0.2816714f, 0.28818747f, 0.2947542f, 0.30137017f, 0.3080338f, 0.31474352f, 0.32149786f,
+        0.32829517f, 0.33513388f, 0.3420124f, 0.3489291f, 0.35588235f, 0.36287048f, 0.36989182f, 0.37694472f,
+        0.38402748f, 0.3911384f, 0.3982758f, 0.4054379f, 0.412623f, 0.4198294f, 0.4270553f, 0.43429896f,
+        0.44155866f, 0.4488326f, 0.45611903f, 0.46341613f, 0.4707222f, 0.4780354f, 0.48535395f, 0.49267608f,
+        0.5f, 0.5073239f, 0.51464605f, 0.5219646f, 0.5292778f, 0.53658384f, 0.543881f, 0.5511674f,
+        0.55844134f, 0.565701f, 0.5729447f, 0.58017063f, 0.587377f, 0.5945621f, 0.6017242f, 0.6088616f,
+        0.6159725f, 0.6230553f, 0.6301082f, 0.63712955f, 0.64411765f, 0.6510709f, 0.6579876f, 0.6648661f,
+        0.6717048f, 0.67850214f, 0.6852565f, 0.69196624f, 0.69862986f, 0.7052458f, 0.71181256f, 0.7183286f,
+        0.7247925f, 0.7312027f, 0.7375579f, 0.74385655f, 0.7500973f, 0.75627875f, 0.76239955f, 0.7684584f,
+        0.77445406f, 0.78038514f, 0.7862504f, 0.7920487f, 0.7977788f, 0.80343944f, 0.8090296f, 0.81454813f,
+        0.819994f, 0.825366f, 0.8306633f, 0.83588487f, 0.8410297f, 0.8460969f, 0.85108554f, 0.8559948f,
+        0.8608239f, 0.8655721f, 0.8702385f, 0.8748225f, 0.8793234f, 0.88374066f, 0.88807356f, 0.89232165f,
+        0.8964844f, 0.9005613f, 0.90455186f, 0.9084559f, 0.91227293f, 0.91600263f, 0.9196449f, 0.92319936f,
+        0.92666596f, 0.93004453f, 0.93333507f, 0.9365375f, 0.93965185f, 0.9426782f, 0.9456168f, 0.9484676f,
+        0.951231f, 0.95390725f, 0.9564966f, 0.9589996f, 0.9614165f, 0.9637479f, 0.9659944f, 0.9681565f,
+        0.97023493f, 0.9722304f, 0.9741436f, 0.97597545f, 0.9777269f, 0.9793988f, 0.98099214f, 0.9825081f,
+        0.98394775f, 0.9853123f, 0.986603f, 0.9878212f, 0.9889683f, 0.9900457f, 0.991055f, 0.9919977f,
+        0.9928755f, 0.99369013f, 0.9944433f, 0.9951369f, 0.99577296f, 0.9963533f, 0.9968802f, 0.9973556f,
+        0.99778175f, 0.998161f, 0.9984957f, 0.99878824f, 0.9990411f, 0.9992569f, 0.99943835f, 0.9995881f,
+        0.99970895f, 0.99980384f, 0.9998757f, 0.99992764f, 0.99996275f, 0.9999842f, 0.9999953f, 0.9999994f,
+        1.0f,
+      };
+      const float Quadratic_Rational_C1[lut_size+1] =
+      {
+        0.0f, 1.5378464e-05f, 6.199628e-05f, 0.00014058546f, 0.00025188917f, 0.0003966617f, 0.0005756684f, 0.00078968576f,
+        0.001039501f, 0.0013259125f, 0.0016497294f, 0.0020117713f, 0.0024128687f, 0.002853862f, 0.0033356023f, 0.0038589512f,
+        0.0044247787f, 0.005033966f, 0.0056874035f, 0.00638599f, 0.007130633f, 0.007922251f, 0.008761767f, 0.009650115f,
+        0.010588235f, 0.011577075f, 0.01261759f, 0.013710739f, 0.01485749f, 0.016058812f, 0.017315684f, 0.018629085f,
+        0.02f, 0.021429414f, 0.02291832f, 0.024467703f, 0.026078558f, 0.027751876f, 0.029488645f, 0.031289857f,
+        0.0331565f, 0.03508955f, 0.037089992f, 0.039158795f, 0.04129693f, 0.04350535f, 0.04578501f, 0.04813685f,
+        0.050561797f, 0.053060774f, 0.05563468f, 0.05828441f, 0.06101083f, 0.063814804f, 0.066697165f, 0.06965873f,
+        0.0727003f, 0.07582264f, 0.0790265f, 0.08231261f, 0.08568165f, 0.08913429f, 0.09267116f, 0.09629288f,
+        0.1f, 0.103793055f, 0.107672535f, 0.111638896f, 0.115692556f, 0.11983388f, 0.124063194f, 0.12838079f,
+        0.13278688f, 0.13728167f, 0.14186528f, 0.1465378f, 0.15129924f, 0.1561496f, 0.16108875f, 0.16611658f,
+        0.17123288f, 0.17643736f, 0.18172973f, 0.18710956f, 0.19257642f, 0.19812976f, 0.20376901f, 0.2094935f,
+        0.2153025f, 0.22119519f, 0.22717074f, 0.23322819f, 0.23936652f, 0.24558464f, 0.25188142f, 0.2582556f,
+        0.2647059f, 0.2712309f, 0.2778292f, 0.2844993f, 0.29123953f, 0.29804826f, 0.3049238f, 0.31186432f,
+        0.31886792f, 0.3259327f, 0.3330567f, 0.34023774f, 0.34747377f, 0.3547626f, 0.362102f, 0.36948958f,
+        0.37692308f, 0.3844f, 0.39191797f, 0.3994744f, 0.4070668f, 0.41469252f, 0.42234895f, 0.43003342f,
+        0.4377432f, 0.44547558f, 0.45322776f, 0.46099702f, 0.4687805f, 0.47657537f, 0.4843788f, 0.49218798f,
+        0.5f, 0.507812f, 0.5156212f, 0.5234246f, 0.5312195f, 0.539003f, 0.54677224f, 0.5545244f,
+        0.5622568f, 0.5699666f, 0.5776511f, 0.5853075f, 0.5929332f, 0.60052556f, 0.60808206f, 0.6156f,
+        0.6230769f, 0.6305104f, 0.637898f, 0.6452374f, 0.6525262f, 0.65976226f, 0.6669433f, 0.67406726f,
+        0.6811321f, 0.6881357f, 0.6950762f, 0.70195174f, 0.7087605f, 0.7155007f, 0.72217077f, 0.7287691f,
+        0.7352941f, 0.7417444f, 0.7481186f, 0.75441533f, 0.76063347f, 0.7667718f, 0.77282923f, 0.7788048f,
+        0.78469753f, 0.7905065f, 0.796231f, 0.8018702f, 0.8074236f, 0.8128904f, 0.81827027f, 0.8235626f,
+        0.8287671f, 0.8338834f, 0.83891124f, 0.84385043f, 0.84870076f, 0.8534622f, 0.8581347f, 0.86271834f,
+        0.86721313f, 0.8716192f, 0.8759368f, 0.8801661f, 0.88430744f, 0.8883611f, 0.8923275f, 0.896207f,
+        0.9f, 0.90370715f, 0.90732884f, 0.9108657f, 0.9143184f, 0.9176874f, 0.9209735f, 0.92417735f,
+        0.9272997f, 0.93034124f, 0.9333028f, 0.9361852f, 0.93898916f, 0.9417156f, 0.9443653f, 0.94693923f,
+        0.9494382f, 0.95186317f, 0.954215f, 0.9564946f, 0.9587031f, 0.9608412f, 0.96291f, 0.96491045f,
+        0.9668435f, 0.9687101f, 0.9705114f, 0.97224814f, 0.9739214f, 0.9755323f, 0.97708166f, 0.9785706f,
+        0.98f, 0.9813709f, 0.9826843f, 0.9839412f, 0.9851425f, 0.98628926f, 0.9873824f, 0.98842293f,
+        0.9894118f, 0.9903499f, 0.99123824f, 0.99207777f, 0.9928694f, 0.993614f, 0.9943126f, 0.99496603f,
+        0.99557525f, 0.9961411f, 0.9966644f, 0.9971461f, 0.99758714f, 0.9979882f, 0.99835026f, 0.9986741f,
+        0.9989605f, 0.9992103f, 0.99942434f, 0.99960333f, 0.9997481f, 0.9998594f, 0.999938f, 0.9999846f,
+        1.0f,
+      };
+      const float Quadratic_Rational_C1_inv[lut_size+1] =
+      {
+        0.0f, 0.058931965f, 0.08150339f, 0.09819982f, 0.111891195f, 0.12368284f, 0.13413866f, 0.14359196f,
+        0.15225881f, 0.16028866f, 0.16778977f, 0.17484355f, 0.18151292f, 0.18784775f, 0.19388829f, 0.19966757f,
+        0.2052131f, 0.21054804f, 0.21569215f, 0.22066237f, 0.2254734f, 0.23013811f, 0.23466776f, 0.23907234f,
+        0.24336073f, 0.24754088f, 0.2516199f, 0.25560424f, 0.2594997f, 0.26331156f, 0.26704466f, 0.27070343f,
+        0.27429187f, 0.27781376f, 0.28127247f, 0.28467122f, 0.28801295f, 0.29130036f, 0.29453602f, 0.29772228f,
+        0.30086136f, 0.30395535f, 0.30700618f, 0.31001568f, 0.31298554f, 0.3159174f, 0.3188128f, 0.32167315f,
+        0.3244998f, 0.32729405f, 0.33005714f, 0.33279023f, 0.33549437f, 0.33817068f, 0.34082007f, 0.34344357f,
+        0.34604204f, 0.34861633f, 0.35116732f, 0.35369578f, 0.35620245f, 0.35868806f, 0.36115333f, 0.36359888f,
+        0.36602542f, 0.36843348f, 0.3708237f, 0.3731967f, 0.37555292f, 0.377893f, 0.38021737f, 0.38252655f,
+        0.38482103f, 0.38710126f, 0.3893677f, 0.39162078f, 0.39386088f, 0.39608845f, 0.39830387f, 0.4005075f,
+        0.40269974f, 0.40488094f, 0.40705144f, 0.4092116f, 0.41136175f, 0.4135022f, 0.41563323f, 0.41775522f,
+        0.4198684f, 0.42197314f, 0.42406964f, 0.42615822f, 0.42823917f, 0.43031272f, 0.43237916f, 0.43443874f,
+        0.43649167f, 0.43853825f, 0.4405787f, 0.44261324f, 0.44464216f, 0.4466656f, 0.44868386f, 0.45069712f,
+        0.45270562f, 0.45470956f, 0.45670915f, 0.4587046f, 0.46069613f, 0.46268392f, 0.4646682f, 0.46664914f,
+        0.46862698f, 0.47060186f, 0.47257397f, 0.47454357f, 0.47651076f, 0.4784758f, 0.48043886f, 0.4824001f,
+        0.4843597f, 0.48631787f, 0.4882748f, 0.49023065f, 0.4921856f, 0.49413982f, 0.4960935f, 0.49804685f,
+        0.5f, 0.5019532f, 0.5039065f, 0.5058602f, 0.5078144f, 0.5097694f, 0.5117252f, 0.5136821f,
+        0.5156403f, 0.5175999f, 0.5195612f, 0.5215242f, 0.52348924f, 0.5254564f, 0.527426f, 0.52939814f,
+        0.531373f, 0.5333508f, 0.5353318f, 0.5373161f, 0.5393039f, 0.5412954f, 0.54329085f, 0.54529047f,
+        0.5472944f, 0.5493029f, 0.55131614f, 0.5533344f, 0.5553579f, 0.55738676f, 0.5594213f, 0.56146175f,
+        0.56350833f, 0.5655613f, 0.5676208f, 0.56968725f, 0.57176083f, 0.57384175f, 0.57593036f, 0.5780269f,
+        0.5801316f, 0.5822448f, 0.58436674f, 0.58649784f, 0.58863825f, 0.59078836f, 0.59294856f, 0.59511906f,
+        0.59730023f, 0.5994925f, 0.60169613f, 0.6039115f, 0.6061391f, 0.60837924f, 0.6106323f, 0.6128987f,
+        0.61517894f, 0.6174734f, 0.6197826f, 0.622107f, 0.62444705f, 0.62680334f, 0.62917626f, 0.6315665f,
+        0.6339746f, 0.6364011f, 0.6388467f, 0.64131194f, 0.6437975f, 0.6463042f, 0.6488327f, 0.65138364f,
+        0.65395796f, 0.6565564f, 0.6591799f, 0.66182935f, 0.6645056f, 0.6672098f, 0.66994286f, 0.67270595f,
+        0.6755002f, 0.67832685f, 0.6811872f, 0.68408257f, 0.68701446f, 0.6899843f, 0.6929938f, 0.6960446f,
+        0.69913864f, 0.7022777f, 0.705464f, 0.70869964f, 0.7119871f, 0.71532875f, 0.7187275f, 0.72218627f,
+        0.7257081f, 0.72929657f, 0.73295534f, 0.73668844f, 0.74050033f, 0.7443958f, 0.7483801f, 0.7524591f,
+        0.75663924f, 0.7609277f, 0.7653322f, 0.7698619f, 0.7745266f, 0.77933764f, 0.78430784f, 0.78945196f,
+        0.79478693f, 0.8003324f, 0.8061117f, 0.81215227f, 0.8184871f, 0.82515645f, 0.83221024f, 0.83971137f,
+        0.8477412f, 0.85640806f, 0.86586136f, 0.87631714f, 0.8881088f, 0.90180016f, 0.9184966f, 0.94106805f,
+        1.0f,
+      };
+      const float Cubic_Rational_C2[lut_size+1] =
+      {
+        0.0f, 6.030863e-08f, 4.881897e-07f, 1.6672528e-06f, 3.999232e-06f, 7.9047e-06f, 1.3823809e-05f, 2.2217051e-05f,
+        3.356606e-05f, 4.8374408e-05f, 6.7168476e-05f, 9.049832e-05f, 0.00011893854f, 0.00015308926f, 0.00019357709f, 0.000241056f,
+        0.00029620854f, 0.0003597467f, 0.00043241307f, 0.000514982f, 0.0006082607f, 0.00071309024f, 0.0008303472f, 0.0009609443f,
+        0.0011058323f, 0.0012660007f, 0.0014424794f, 0.0016363403f, 0.0018486978f, 0.0020807113f, 0.0023335859f, 0.002608574f,
+        0.0029069767f, 0.003230146f, 0.0035794845f, 0.0039564497f, 0.004362553f, 0.004799362f, 0.0052685025f, 0.0057716602f,
+        0.0063105817f, 0.006887075f, 0.007503014f, 0.008160336f, 0.008861046f, 0.009607218f, 0.010400995f, 0.011244589f,
+        0.012140288f, 0.013090449f, 0.014097507f, 0.015163968f, 0.016292417f, 0.017485516f, 0.018746f, 0.020076685f,
+        0.021480462f, 0.0229603f, 0.024519246f, 0.026160425f, 0.027887031f, 0.02970234f, 0.031609695f, 0.033612516f,
+        0.035714287f, 0.037918556f, 0.040228944f, 0.042649128f, 0.045182828f, 0.047833834f, 0.050605975f, 0.053503115f,
+        0.056529157f, 0.059688035f, 0.0629837f, 0.06642011f, 0.07000122f, 0.07373101f, 0.07761341f, 0.081652336f,
+        0.08585165f, 0.09021518f, 0.094746664f, 0.0994498f, 0.10432813f, 0.109385155f, 0.11462418f, 0.12004841f,
+        0.12566088f, 0.13146442f, 0.13746168f, 0.1436551f, 0.15004687f, 0.15663889f, 0.16343284f, 0.17043006f,
+        0.17763157f, 0.18503809f, 0.19264993f, 0.20046705f, 0.208489f, 0.21671495f, 0.22514358f, 0.2337732f,
+        0.24260159f, 0.2516261f, 0.26084358f, 0.2702504f, 0.27984247f, 0.2896151f, 0.2995632f, 0.3096811f,
+        0.31996268f, 0.33040133f, 0.34098995f, 0.35172093f, 0.36258623f, 0.37357742f, 0.38468555f, 0.39590138f,
+        0.40721524f, 0.41861716f, 0.43009678f, 0.4416436f, 0.4532467f, 0.46489516f, 0.47657776f, 0.48828316f,
+        0.5f, 0.51171684f, 0.52342224f, 0.5351048f, 0.5467533f, 0.5583564f, 0.5699032f, 0.5813829f,
+        0.59278476f, 0.6040986f, 0.6153144f, 0.6264226f, 0.6374138f, 0.6482791f, 0.65901005f, 0.66959864f,
+        0.6800373f, 0.6903189f, 0.70043683f, 0.7103849f, 0.7201575f, 0.72974956f, 0.7391564f, 0.7483739f,
+        0.7573984f, 0.7662268f, 0.7748564f, 0.7832851f, 0.791511f, 0.79953295f, 0.8073501f, 0.8149619f,
+        0.82236844f, 0.82956994f, 0.83656716f, 0.8433611f, 0.8499531f, 0.8563449f, 0.86253834f, 0.8685356f,
+        0.8743391f, 0.8799516f, 0.8853758f, 0.89061487f, 0.89567184f, 0.9005502f, 0.90525335f, 0.90978485f,
+        0.91414833f, 0.91834766f, 0.9223866f, 0.926269f, 0.92999876f, 0.9335799f, 0.9370163f, 0.94031197f,
+        0.94347084f, 0.9464969f, 0.94939405f, 0.95216614f, 0.9548172f, 0.95735085f, 0.95977104f, 0.96208143f,
+        0.96428573f, 0.9663875f, 0.9683903f, 0.97029763f, 0.97211295f, 0.9738396f, 0.97548074f, 0.9770397f,
+        0.97851956f, 0.9799233f, 0.981254f, 0.9825145f, 0.9837076f, 0.98483604f, 0.9859025f, 0.98690957f,
+        0.9878597f, 0.9887554f, 0.989599f, 0.9903928f, 0.99113894f, 0.99183965f, 0.99249697f, 0.9931129f,
+        0.9936894f, 0.99422836f, 0.9947315f, 0.99520063f, 0.9956375f, 0.99604356f, 0.9964205f, 0.99676985f,
+        0.997093f, 0.9973914f, 0.9976664f, 0.99791926f, 0.9981513f, 0.9983637f, 0.9985575f, 0.998734f,
+        0.99889416f, 0.99903905f, 0.99916965f, 0.9992869f, 0.99939173f, 0.999485f, 0.99956757f, 0.9996402f,
+        0.99970376f, 0.99975896f, 0.9998064f, 0.99984694f, 0.9998811f, 0.9999095f, 0.9999328f, 0.9999516f,
+        0.99996644f, 0.99997777f, 0.9999862f, 0.9999921f, 0.999996f, 0.99999833f, 0.9999995f, 0.99999994f,
+        1.0f,
+      };
+      const float Cubic_Rational_C2_inv[lut_size+1] =
+      {
+        0.0f, 0.13621518f, 0.16593309f, 0.18569052f, 0.20084123f, 0.21326795f, 0.2238736f, 0.23316698f,
+        0.24146536f, 0.24898095f, 0.25586316f, 0.26222146f, 0.2681386f, 0.27367878f, 0.27889284f, 0.28382185f,
+        0.28849936f, 0.2929533f, 0.29720712f, 0.30128062f, 0.30519086f, 0.3089525f, 0.31257832f, 0.31607947f,
+        0.3194658f, 0.32274604f, 0.32592788f, 0.32901832f, 0.33202353f, 0.33494917f, 0.33780023f, 0.3405814f,
+        0.34329683f, 0.34595034f, 0.34854546f, 0.35108542f, 0.35357317f, 0.35601148f, 0.35840285f, 0.36074966f,
+        0.36305407f, 0.36531812f, 0.36754373f, 0.36973262f, 0.3718865f, 0.37400687f, 0.37609524f, 0.3781529f,
+        0.38018125f, 0.3821814f, 0.38415456f, 0.38610178f, 0.3880241f, 0.3899225f, 0.39179787f, 0.3936511f,
+        0.39548302f, 0.39729443f, 0.39908606f, 0.40085864f, 0.40261284f, 0.40434933f, 0.4060687f, 0.4077716f,
+        0.40945858f, 0.41113013f, 0.41278687f, 0.41442925f, 0.41605774f, 0.4176728f, 0.41927496f, 0.42086455f,
+        0.42244205f, 0.4240078f, 0.42556223f, 0.42710572f, 0.42863858f, 0.4301612f, 0.4316739f, 0.43317702f,
+        0.43467084f, 0.43615568f, 0.43763185f, 0.4390996f, 0.44055927f, 0.4420111f, 0.44345534f, 0.44489223f,
+        0.44632205f, 0.44774505f, 0.44916144f, 0.45057148f, 0.45197535f, 0.4533733f, 0.45476556f, 0.4561523f,
+        0.45753375f, 0.4589101f, 0.46028155f, 0.46164832f, 0.46301055f, 0.46436846f, 0.4657222f, 0.46707198f,
+        0.46841797f, 0.46976033f, 0.47109923f, 0.47243485f, 0.47376737f, 0.4750969f, 0.47642365f, 0.47774774f,
+        0.47906938f, 0.48038867f, 0.48170578f, 0.48302087f, 0.4843341f, 0.48564562f, 0.48695555f, 0.48826402f,
+        0.48957124f, 0.49087733f, 0.4921824f, 0.49348664f, 0.49479017f, 0.49609312f, 0.49739563f, 0.4986979f,
+        0.5f, 0.5013021f, 0.50260437f, 0.5039069f, 0.50520986f, 0.50651336f, 0.50781757f, 0.50912267f,
+        0.5104287f, 0.511736f, 0.5130445f, 0.5143544f, 0.5156659f, 0.5169791f, 0.5182942f, 0.51961136f,
+        0.52093065f, 0.52225226f, 0.5235764f, 0.5249031f, 0.52623266f, 0.5275651f, 0.52890074f, 0.5302397f,
+        0.53158206f, 0.532928f, 0.5342778f, 0.53563154f, 0.53698945f, 0.53835166f, 0.53971845f, 0.5410899f,
+        0.5424662f, 0.5438477f, 0.54523444f, 0.5466267f, 0.54802465f, 0.5494285f, 0.55083853f, 0.552255f,
+        0.5536779f, 0.5551078f, 0.55654466f, 0.5579889f, 0.55944073f, 0.5609004f, 0.56236815f, 0.5638443f,
+        0.5653292f, 0.566823f, 0.5683261f, 0.5698388f, 0.5713614f, 0.5728943f, 0.57443774f, 0.57599217f,
+        0.577558f, 0.5791354f, 0.5807251f, 0.5823272f, 0.5839423f, 0.58557075f, 0.58721316f, 0.58886987f,
+        0.5905414f, 0.5922284f, 0.5939313f, 0.5956507f, 0.5973872f, 0.59914136f, 0.60091394f, 0.6027056f,
+        0.604517f, 0.6063489f, 0.60820216f, 0.6100775f, 0.6119759f, 0.6138982f, 0.61584544f, 0.6178186f,
+        0.61981875f, 0.6218471f, 0.62390476f, 0.62599313f, 0.6281135f, 0.6302674f, 0.6324563f, 0.6346819f,
+        0.6369459f, 0.63925034f, 0.64159715f, 0.64398855f, 0.6464268f, 0.6489146f, 0.65145457f, 0.6540497f,
+        0.6567032f, 0.6594186f, 0.66219974f, 0.66505086f, 0.66797644f, 0.67098165f, 0.6740721f, 0.67725396f,
+        0.6805342f, 0.68392056f, 0.6874217f, 0.6910475f, 0.69480914f, 0.6987194f, 0.7027929f, 0.7070467f,
+        0.71150064f, 0.7161782f, 0.7211072f, 0.7263212f, 0.7318614f, 0.73777854f, 0.7441368f, 0.75101906f,
+        0.7585346f, 0.766833f, 0.7761264f, 0.786732f, 0.79915875f, 0.8143095f, 0.8340669f, 0.86378485f,
+        1.0f,
+      };
+      const float Cubic_Rational_C2_inv_alt[lut_size+1] =
+      {
+        0.0f, 0.13621518f, 0.16593309f, 0.18569052f, 0.20084123f, 0.21326795f, 0.2238736f, 0.23316698f,
+        0.24146536f, 0.24898095f, 0.25586316f, 0.26222146f, 0.2681386f, 0.27367878f, 0.27889284f, 0.28382185f,
+        0.28849936f, 0.2929533f, 0.29720712f, 0.30128062f, 0.30519086f, 0.3089525f, 0.31257832f, 0.31607947f,
+        0.3194658f, 0.32274604f, 0.32592788f, 0.32901832f, 0.33202353f, 0.33494917f, 0.33780023f, 0.3405814f,
+        0.34329683f, 0.34595034f, 0.34854546f, 0.35108542f, 0.35357317f, 0.35601148f, 0.35840285f, 0.36074966f,
+        0.36305407f, 0.36531812f, 0.36754373f, 0.36973262f, 0.3718865f, 0.37400687f, 0.37609524f, 0.3781529f,
+        0.38018125f, 0.3821814f, 0.38415456f, 0.38610178f, 0.3880241f, 0.3899225f, 0.39179787f, 0.3936511f,
+        0.39548302f, 0.39729443f, 0.39908606f, 0.40085864f, 0.40261284f, 0.40434933f, 0.4060687f, 0.4077716f,
+        0.40945858f, 0.41113013f, 0.41278687f, 0.41442925f, 0.41605774f, 0.4176728f, 0.41927496f, 0.42086455f,
+        0.42244205f, 0.4240078f, 0.42556223f, 0.42710572f, 0.42863858f, 0.4301612f, 0.4316739f, 0.43317702f,
+        0.43467084f, 0.43615568f, 0.43763185f, 0.4390996f, 0.44055927f, 0.4420111f, 0.44345534f, 0.44489223f,
+        0.44632205f, 0.44774505f, 0.44916144f, 0.45057148f, 0.45197535f, 0.4533733f, 0.45476556f, 0.4561523f,
+        0.45753375f, 0.4589101f, 0.46028155f, 0.46164832f, 0.46301055f, 0.46436846f, 0.4657222f, 0.46707198f,
+        0.46841797f, 0.46976033f, 0.47109923f, 0.47243485f, 0.47376737f, 0.4750969f, 0.47642365f, 0.47774774f,
+        0.47906938f, 0.48038867f, 0.48170578f, 0.48302087f, 0.4843341f, 0.48564562f, 0.48695555f, 0.48826402f,
+        0.48957124f, 0.49087733f, 0.4921824f, 0.49348664f, 0.49479017f, 0.49609312f, 0.49739563f, 0.4986979f,
+        0.5f, 0.5013021f, 0.50260437f, 0.5039069f, 0.50520986f, 0.50651336f, 0.50781757f, 0.50912267f,
+        0.5104287f, 0.511736f, 0.5130445f, 0.5143544f, 0.5156659f, 0.5169791f, 0.5182942f, 0.51961136f,
+        0.52093065f, 0.52225226f, 0.5235764f, 0.5249031f, 0.52623266f, 0.5275651f, 0.52890074f, 0.5302397f,
+        0.53158206f, 0.532928f, 0.5342778f, 0.53563154f, 0.53698945f, 0.53835166f, 0.53971845f, 0.5410899f,
+        0.5424662f, 0.5438477f, 0.54523444f, 0.5466267f, 0.54802465f, 0.5494285f, 0.55083853f, 0.552255f,
+        0.5536779f, 0.5551078f, 0.55654466f, 0.5579889f, 0.55944073f, 0.5609004f, 0.56236815f, 0.5638443f,
+        0.5653292f, 0.566823f, 0.5683261f, 0.5698388f, 0.5713614f, 0.5728943f, 0.57443774f, 0.57599217f,
+        0.577558f, 0.5791354f, 0.5807251f, 0.5823272f, 0.5839423f, 0.58557075f, 0.58721316f, 0.58886987f,
+        0.5905414f, 0.5922284f, 0.5939313f, 0.5956507f, 0.5973872f, 0.59914136f, 0.60091394f, 0.6027056f,
+        0.604517f, 0.6063489f, 0.60820216f, 0.6100775f, 0.6119759f, 0.6138982f, 0.61584544f, 0.6178186f,
+        0.61981875f, 0.6218471f, 0.62390476f, 0.62599313f, 0.6281135f, 0.6302674f, 0.6324563f, 0.6346819f,
+        0.6369459f, 0.63925034f, 0.64159715f, 0.64398855f, 0.6464268f, 0.6489146f, 0.65145457f, 0.6540497f,
+        0.6567032f, 0.6594186f, 0.66219974f, 0.66505086f, 0.66797644f, 0.67098165f, 0.6740721f, 0.67725396f,
+        0.6805342f, 0.68392056f, 0.6874217f, 0.6910475f, 0.69480914f, 0.6987194f, 0.7027929f, 0.7070467f,
+        0.71150064f, 0.7161782f, 0.7211072f, 0.7263212f, 0.7318614f, 0.73777854f, 0.7441368f, 0.75101906f,
+        0.7585346f, 0.766833f, 0.7761264f, 0.786732f, 0.79915875f, 0.8143095f, 0.8340669f, 0.86378485f,
+        1.0f,
+      };
+      const float Piecewise_Quadratic_C1[lut_size+1] =
+      {
+        0.0f, 3.0517578e-05f, 0.00012207031f, 0.0002746582f, 0.00048828125f, 0.00076293945f, 0.0010986328f, 0.0014953613f,
+        0.001953125f, 0.0024719238f, 0.0030517578f, 0.003692627f, 0.0043945312f, 0.0051574707f, 0.0059814453f, 0.006866455f,
+        0.0078125f, 0.00881958f, 0.009887695f, 0.011016846f, 0.012207031f, 0.013458252f, 0.014770508f, 0.016143799f,
+        0.017578125f, 0.019073486f, 0.020629883f, 0.022247314f, 0.023925781f, 0.025665283f, 0.02746582f, 0.029327393f,
+        0.03125f, 0.033233643f, 0.03527832f, 0.037384033f, 0.03955078f, 0.041778564f, 0.044067383f, 0.046417236f,
+        0.048828125f, 0.05130005f, 0.053833008f, 0.056427002f, 0.05908203f, 0.061798096f, 0.064575195f, 0.06741333f,
+        0.0703125f, 0.073272705f, 0.076293945f, 0.07937622f, 0.08251953f, 0.08572388f, 0.08898926f, 0.092315674f,
+        0.095703125f, 0.09915161f, 0.10266113f, 0.10623169f, 0.10986328f, 0.11355591f, 0.11730957f, 0.12112427f,
+        0.125f, 0.12893677f, 0.13293457f, 0.13699341f, 0.14111328f, 0.14529419f, 0.14953613f, 0.15383911f,
+        0.15820312f, 0.16262817f, 0.16711426f, 0.17166138f, 0.17626953f, 0.18093872f, 0.18566895f, 0.1904602f,
+        0.1953125f, 0.20022583f, 0.2052002f, 0.2102356f, 0.21533203f, 0.2204895f, 0.22570801f, 0.23098755f,
+        0.23632812f, 0.24172974f, 0.24719238f, 0.25271606f, 0.25830078f, 0.26394653f, 0.26965332f, 0.27542114f,
+        0.28125f, 0.2871399f, 0.29309082f, 0.29910278f, 0.30517578f, 0.3113098f, 0.31750488f, 0.323761f,
+        0.33007812f, 0.3364563f, 0.3428955f, 0.34939575f, 0.35595703f, 0.36257935f, 0.3692627f, 0.37600708f,
+        0.3828125f, 0.38967896f, 0.39660645f, 0.40359497f, 0.41064453f, 0.41775513f, 0.42492676f, 0.43215942f,
+        0.43945312f, 0.44680786f, 0.45422363f, 0.46170044f, 0.46923828f, 0.47683716f, 0.48449707f, 0.49221802f,
+        0.5f, 0.507782f, 0.5155029f, 0.52316284f, 0.5307617f, 0.53829956f, 0.54577637f, 0.55319214f,
+        0.5605469f, 0.5678406f, 0.57507324f, 0.5822449f, 0.58935547f, 0.596405f, 0.60339355f, 0.61032104f,
+        0.6171875f, 0.6239929f, 0.6307373f, 0.63742065f, 0.64404297f, 0.65060425f, 0.6571045f, 0.6635437f,
+        0.6699219f, 0.676239f, 0.6824951f, 0.6886902f, 0.6948242f, 0.7008972f, 0.7069092f, 0.7128601f,
+        0.71875f, 0.72457886f, 0.7303467f, 0.73605347f, 0.7416992f, 0.74728394f, 0.7528076f, 0.75827026f,
+        0.7636719f, 0.76901245f, 0.774292f, 0.7795105f, 0.78466797f, 0.7897644f, 0.7947998f, 0.79977417f,
+        0.8046875f, 0.8095398f, 0.81433105f, 0.8190613f, 0.82373047f, 0.8283386f, 0.83288574f, 0.8373718f,
+        0.8417969f, 0.8461609f, 0.85046387f, 0.8547058f, 0.8588867f, 0.8630066f, 0.8670654f, 0.87106323f,
+        0.875f, 0.87887573f, 0.8826904f, 0.8864441f, 0.8901367f, 0.8937683f, 0.89733887f, 0.9008484f,
+        0.9042969f, 0.9076843f, 0.91101074f, 0.9142761f, 0.91748047f, 0.9206238f, 0.92370605f, 0.9267273f,
+        0.9296875f, 0.93258667f, 0.9354248f, 0.9382019f, 0.94091797f, 0.943573f, 0.946167f, 0.94869995f,
+        0.9511719f, 0.95358276f, 0.9559326f, 0.95822144f, 0.9604492f, 0.96261597f, 0.9647217f, 0.96676636f,
+        0.96875f, 0.9706726f, 0.9725342f, 0.9743347f, 0.9760742f, 0.9777527f, 0.9793701f, 0.9809265f,
+        0.9824219f, 0.9838562f, 0.9852295f, 0.98654175f, 0.98779297f, 0.98898315f, 0.9901123f, 0.9911804f,
+        0.9921875f, 0.99313354f, 0.99401855f, 0.9948425f, 0.99560547f, 0.9963074f, 0.99694824f, 0.9975281f,
+        0.9980469f, 0.99850464f, 0.99890137f, 0.99923706f, 0.9995117f, 0.99972534f, 0.9998779f, 0.9999695f,
+        1.0f,
+      };
+      const float Piecewise_Quadratic_C1_inv[lut_size+1] =
+      {
+        0.0f, 0.044194173f, 0.0625f, 0.07654656f, 0.088388346f, 0.09882118f, 0.10825317f, 0.1169268f,
+        0.125f, 0.13258252f, 0.13975425f, 0.1465755f, 0.15309311f, 0.15934436f, 0.16535945f, 0.1711633f,
+        0.17677669f, 0.18221724f, 0.1875f, 0.19263794f, 0.19764236f, 0.20252314f, 0.20728905f, 0.21194781f,
+        0.21650635f, 0.22097087f, 0.22534695f, 0.22963966f, 0.2338536f, 0.23799291f, 0.24206147f, 0.24606274f,
+        0.25f, 0.2538762f, 0.2576941f, 0.26145625f, 0.26516503f, 0.26882267f, 0.2724312f, 0.2759925f,
+        0.2795085f, 0.2829808f, 0.286411f, 0.28980058f, 0.293151f, 0.29646352f, 0.29973948f, 0.30298f,
+        0.30618623f, 0.30935922f, 0.3125f, 0.3156095f, 0.31868872f, 0.32173845f, 0.3247595f, 0.32775277f,
+        0.3307189f, 0.3336587f, 0.3365728f, 0.3394619f, 0.3423266f, 0.34516752f, 0.34798527f, 0.35078037f,
+        0.35355338f, 0.35630482f, 0.35903516f, 0.3617449f, 0.36443448f, 0.36710438f, 0.369755f, 0.37238672f,
+        0.375f, 0.3775952f, 0.38017267f, 0.38273278f, 0.38527587f, 0.3878023f, 0.39031237f, 0.3928064f,
+        0.3952847f, 0.39774758f, 0.40019527f, 0.4026281f, 0.40504628f, 0.40745014f, 0.4098399f, 0.4122158f,
+        0.4145781f, 0.416927f, 0.41926274f, 0.42158556f, 0.42389563f, 0.42619318f, 0.42847842f, 0.43075153f,
+        0.4330127f, 0.43526214f, 0.4375f, 0.43972647f, 0.44194174f, 0.44414595f, 0.44633928f, 0.44852188f,
+        0.4506939f, 0.45285553f, 0.45500687f, 0.45714808f, 0.45927933f, 0.46140072f, 0.4635124f, 0.46561453f,
+        0.4677072f, 0.46979052f, 0.47186464f, 0.4739297f, 0.47598583f, 0.47803307f, 0.4800716f, 0.48210153f,
+        0.48412293f, 0.4861359f, 0.4881406f, 0.4901371f, 0.49212548f, 0.49410588f, 0.49607837f, 0.49804303f,
+        0.5f, 0.50195694f, 0.5039216f, 0.5058941f, 0.5078745f, 0.5098629f, 0.5118594f, 0.5138641f,
+        0.51587707f, 0.5178985f, 0.5199284f, 0.52196693f, 0.5240142f, 0.5260703f, 0.52813536f, 0.5302095f,
+        0.53229284f, 0.5343855f, 0.5364876f, 0.53859925f, 0.5407207f, 0.5428519f, 0.5449931f, 0.5471445f,
+        0.5493061f, 0.55147815f, 0.55366075f, 0.555854f, 0.55805826f, 0.5602735f, 0.5625f, 0.56473786f,
+        0.5669873f, 0.5692485f, 0.5715216f, 0.5738068f, 0.5761044f, 0.57841444f, 0.58073723f, 0.583073f,
+        0.5854219f, 0.5877842f, 0.5901601f, 0.59254986f, 0.5949537f, 0.59737194f, 0.59980476f, 0.6022524f,
+        0.6047153f, 0.6071936f, 0.6096876f, 0.6121977f, 0.6147241f, 0.61726725f, 0.61982733f, 0.6224048f,
+        0.625f, 0.62761325f, 0.63024503f, 0.63289565f, 0.6355655f, 0.6382551f, 0.6409648f, 0.6436952f,
+        0.6464466f, 0.64921963f, 0.65201473f, 0.6548325f, 0.6576734f, 0.66053814f, 0.6634272f, 0.6663413f,
+        0.66928107f, 0.67224723f, 0.67524046f, 0.6782616f, 0.6813113f, 0.6843905f, 0.6875f, 0.6906408f,
+        0.6938138f, 0.69702f, 0.7002605f, 0.70353645f, 0.70684904f, 0.7101994f, 0.713589f, 0.7170192f,
+        0.7204915f, 0.7240075f, 0.7275688f, 0.73117733f, 0.73483497f, 0.73854375f, 0.7423059f, 0.7461238f,
+        0.75f, 0.75393724f, 0.75793856f, 0.7620071f, 0.7661464f, 0.77036035f, 0.774653f, 0.77902913f,
+        0.78349364f, 0.7880522f, 0.79271096f, 0.7974768f, 0.8023577f, 0.8073621f, 0.8125f, 0.81778276f,
+        0.8232233f, 0.8288367f, 0.83464056f, 0.8406556f, 0.8469069f, 0.8534245f, 0.86024576f, 0.86741745f,
+        0.875f, 0.8830732f, 0.8917468f, 0.90117884f, 0.9116117f, 0.92345345f, 0.9375f, 0.95580584f,
+        1.0f,
+      };
+      const float Trigonometric_C1[lut_size+1] =
+      {
+        0.0f, 3.764908e-05f, 0.00015059065f, 0.0003388077f, 0.0006022719f, 0.00094094354f, 0.0013547717f, 0.0018436939f,
+        0.0024076367f, 0.003046515f, 0.0037602326f, 0.0045486824f, 0.005411745f, 0.0063492907f, 0.0073611788f, 0.008447256f,
+        0.00960736f, 0.010841315f, 0.012148935f, 0.013530024f, 0.014984373f, 0.016511764f, 0.018111967f, 0.019784741f,
+        0.021529833f, 0.02334698f, 0.02523591f, 0.027196337f, 0.029227968f, 0.031330492f, 0.0335036f, 0.035746958f,
+        0.038060233f, 0.040443074f, 0.042895123f, 0.04541601f, 0.048005354f, 0.050662767f, 0.05338785f, 0.05618019f,
+        0.05903937f, 0.06196495f, 0.0649565f, 0.06801357f, 0.07113569f, 0.0743224f, 0.07757322f, 0.080887645f,
+        0.084265195f, 0.08770535f, 0.09120759f, 0.0947714f, 0.098396234f, 0.102081545f, 0.10582679f, 0.10963139f,
+        0.113494776f, 0.11741637f, 0.12139558f, 0.1254318f, 0.12952444f, 0.13367286f, 0.13787647f, 0.14213459f,
+        0.14644662f, 0.15081188f, 0.15522973f, 0.1596995f, 0.16422053f, 0.16879211f, 0.17341357f, 0.17808422f,
+        0.18280336f, 0.18757026f, 0.1923842f, 0.19724448f, 0.20215034f, 0.20710108f, 0.2120959f, 0.21713409f,
+        0.22221488f, 0.22733751f, 0.2325012f, 0.23770516f, 0.24294862f, 0.24823081f, 0.25355092f, 0.25890812f,
+        0.26430163f, 0.26973066f, 0.27519435f, 0.2806919f, 0.28622246f, 0.2917852f, 0.29737934f, 0.30300397f,
+        0.30865827f, 0.3143414f, 0.32005247f, 0.32579067f, 0.33155507f, 0.33734486f, 0.34315914f, 0.34899703f,
+        0.35485765f, 0.36074015f, 0.3666436f, 0.37256718f, 0.3785099f, 0.38447094f, 0.39044937f, 0.39644432f,
+        0.40245485f, 0.40848005f, 0.41451904f, 0.42057094f, 0.42663476f, 0.43270963f, 0.43879467f, 0.4448889f,
+        0.45099142f, 0.45710135f, 0.4632177f, 0.46933964f, 0.47546616f, 0.48159638f, 0.4877294f, 0.49386424f,
+        0.5f, 0.50613576f, 0.5122706f, 0.5184036f, 0.5245338f, 0.5306604f, 0.53678226f, 0.54289865f,
+        0.54900855f, 0.5551111f, 0.5612053f, 0.56729037f, 0.5733652f, 0.5794291f, 0.5854809f, 0.59151995f,
+        0.59754515f, 0.6035557f, 0.6095506f, 0.61552906f, 0.62149006f, 0.6274328f, 0.6333564f, 0.6392598f,
+        0.6451423f, 0.651003f, 0.65684086f, 0.6626552f, 0.66844493f, 0.67420936f, 0.6799475f, 0.6856586f,
+        0.6913417f, 0.69699603f, 0.7026207f, 0.70821476f, 0.71377754f, 0.71930814f, 0.72480565f, 0.7302694f,
+        0.73569834f, 0.7410919f, 0.7464491f, 0.7517692f, 0.75705135f, 0.7622948f, 0.7674988f, 0.7726625f,
+        0.7777851f, 0.7828659f, 0.7879041f, 0.79289895f, 0.79784966f, 0.80275553f, 0.8076158f, 0.8124297f,
+        0.81719667f, 0.82191575f, 0.8265864f, 0.8312079f, 0.8357795f, 0.8403005f, 0.84477025f, 0.84918815f,
+        0.8535534f, 0.8578654f, 0.86212355f, 0.8663271f, 0.8704756f, 0.8745682f, 0.8786044f, 0.8825836f,
+        0.88650525f, 0.89036864f, 0.8941732f, 0.89791846f, 0.90160376f, 0.9052286f, 0.90879244f, 0.9122946f,
+        0.9157348f, 0.9191123f, 0.92242676f, 0.9256776f, 0.9288643f, 0.93198645f, 0.9350435f, 0.9380351f,
+        0.94096065f, 0.9438198f, 0.9466122f, 0.94933724f, 0.95199466f, 0.954584f, 0.95710486f, 0.95955694f,
+        0.96193975f, 0.96425307f, 0.9664964f, 0.96866953f, 0.970772f, 0.97280365f, 0.9747641f, 0.97665304f,
+        0.97847015f, 0.98021525f, 0.98188806f, 0.98348826f, 0.98501563f, 0.98647f, 0.9878511f, 0.9891587f,
+        0.9903926f, 0.99155277f, 0.9926388f, 0.99365073f, 0.99458826f, 0.99545133f, 0.9962398f, 0.9969535f,
+        0.9975924f, 0.9981563f, 0.99864525f, 0.9990591f, 0.99939775f, 0.9996612f, 0.99984944f, 0.99996233f,
+        1.0f,
+      };
+      const float Trigonometric_C1_inv[lut_size+1] =
+      {
+        0.0f, 0.039814685f, 0.056343295f, 0.06905143f, 0.079786174f, 0.08926251f, 0.09784688f, 0.10575685f,
+        0.11313408f, 0.12007692f, 0.12665693f, 0.13292812f, 0.1389324f, 0.14470312f, 0.15026729f, 0.15564713f,
+        0.16086125f, 0.16592535f, 0.17085288f, 0.17565542f, 0.18034303f, 0.18492453f, 0.18940772f, 0.19379951f,
+        0.19810604f, 0.20233285f, 0.20648491f, 0.21056674f, 0.2145824f, 0.21853563f, 0.22242986f, 0.22626816f,
+        0.23005345f, 0.23378837f, 0.23747538f, 0.24111675f, 0.24471459f, 0.24827087f, 0.25178742f, 0.25526598f,
+        0.25870812f, 0.2621154f, 0.2654892f, 0.26883087f, 0.27214167f, 0.27542278f, 0.27867535f, 0.28190038f,
+        0.28509897f, 0.288272f, 0.29142043f, 0.29454508f, 0.29764682f, 0.3007264f, 0.3037846f, 0.30682212f,
+        0.30983964f, 0.3128378f, 0.3158173f, 0.31877866f, 0.3217225f, 0.32464936f, 0.32755977f, 0.33045426f,
+        0.33333334f, 0.33619744f, 0.33904704f, 0.3418826f, 0.3447045f, 0.34751323f, 0.35030913f, 0.35309258f,
+        0.355864f, 0.3586237f, 0.3613721f, 0.3641095f, 0.36683622f, 0.36955258f, 0.37225893f, 0.37495553f,
+        0.37764272f, 0.38032073f, 0.3829899f, 0.3856505f, 0.3883027f, 0.3909469f, 0.39358327f, 0.39621207f,
+        0.39883357f, 0.40144798f, 0.40405554f, 0.40665644f, 0.40925097f, 0.41183934f, 0.4144217f, 0.41699833f,
+        0.41956937f, 0.42213508f, 0.42469564f, 0.42725125f, 0.4298021f, 0.43234834f, 0.4348902f, 0.43742788f,
+        0.43996155f, 0.44249135f, 0.4450175f, 0.44754013f, 0.45005944f, 0.45257562f, 0.45508882f, 0.4575992f,
+        0.4601069f, 0.46261215f, 0.46511507f, 0.4676158f, 0.47011456f, 0.47261146f, 0.4751067f, 0.47760037f,
+        0.48009264f, 0.48258373f, 0.48507375f, 0.48756287f, 0.4900512f, 0.49253893f, 0.4950262f, 0.49751318f,
+        0.5f, 0.5024868f, 0.50497377f, 0.5074611f, 0.5099488f, 0.51243716f, 0.51492625f, 0.51741624f,
+        0.51990736f, 0.52239966f, 0.52489334f, 0.5273885f, 0.5298854f, 0.53238416f, 0.5348849f, 0.53738785f,
+        0.5398931f, 0.54240084f, 0.5449112f, 0.5474244f, 0.5499405f, 0.5524599f, 0.55498254f, 0.55750865f,
+        0.56003845f, 0.5625721f, 0.5651098f, 0.5676516f, 0.57019794f, 0.5727488f, 0.5753043f, 0.5778649f,
+        0.5804306f, 0.5830017f, 0.5855783f, 0.5881607f, 0.590749f, 0.59334356f, 0.59594446f, 0.59855205f,
+        0.6011664f, 0.6037879f, 0.6064167f, 0.6090531f, 0.61169726f, 0.61434954f, 0.6170101f, 0.6196793f,
+        0.6223573f, 0.62504447f, 0.6277411f, 0.63044745f, 0.6331638f, 0.6358905f, 0.6386279f, 0.64137626f,
+        0.644136f, 0.6469074f, 0.64969087f, 0.6524868f, 0.6552955f, 0.6581174f, 0.660953f, 0.66380256f,
+        0.6666667f, 0.6695457f, 0.67244023f, 0.67535067f, 0.6782775f, 0.68122137f, 0.6841827f, 0.68716216f,
+        0.6901604f, 0.6931779f, 0.6962154f, 0.6992736f, 0.7023532f, 0.70545495f, 0.7085796f, 0.711728f,
+        0.71490103f, 0.7180996f, 0.7213247f, 0.72457725f, 0.7278583f, 0.7311691f, 0.7345108f, 0.7378846f,
+        0.7412919f, 0.74473405f, 0.7482126f, 0.75172913f, 0.75528544f, 0.75888324f, 0.7625246f, 0.7662116f,
+        0.7699465f, 0.7737318f, 0.7775701f, 0.78146434f, 0.7854176f, 0.78943324f, 0.7935151f, 0.79766715f,
+        0.80189395f, 0.8062005f, 0.8105923f, 0.81507546f, 0.81965697f, 0.8243446f, 0.8291471f, 0.8340746f,
+        0.83913875f, 0.8443529f, 0.8497327f, 0.85529685f, 0.8610676f, 0.86707187f, 0.87334305f, 0.8799231f,
+        0.8868659f, 0.8942431f, 0.90215313f, 0.9107375f, 0.9202138f, 0.93094856f, 0.9436567f, 0.9601853f,
+        1.0f,
+      };
+    };
+
+    template<> struct lut_table<linear> { static const float *data() { return lut_data::linear; } };
+    template<> struct lut_table<easeInQuad> { static const float *data() { return lut_data::easeInQuad; } };
+    template<> struct lut_table<easeOutQuad> { static const float *data() { return lut_data::easeOutQuad; } };
+    template<> struct lut_table<easeInOutQuad> { static const float *data() { return lut_data::easeInOutQuad; } };
+    template<> struct lut_table<easeInCubic> { static const float *data() { return lut_data::easeInCubic; } };
+    template<> struct lut_table<easeOutCubic> { static const float *data() { return lut_data::easeOutCubic; } };
+    template<> struct lut_table<easeInOutCubic> { static const float *data() { return lut_data::easeInOutCubic; } };
+    template<> struct lut_table<easeInQuart> { static const float *data() { return lut_data::easeInQuart; } };
+    template<> struct lut_table<easeOutQuart> { static const float *data() { return lut_data::easeOutQuart; } };
+    template<> struct lut_table<easeInOutQuart> { static const float *data() { return lut_data::easeInOutQuart; } };
+    template<> struct lut_table<easeInQuint> { static const float *data() { return lut_data::easeInQuint; } };
+    template<> struct lut_table<easeOutQuint> { static const float *data() { return lut_data::easeOutQuint; } };
+    template<> struct lut_table<easeInOutQuint> { static const float *data() { return lut_data::easeInOutQuint; } };
+    template<> struct lut_table<easeInSine> { static const float *data() { return lut_data::easeInSine; } };
+    template<> struct lut_table<easeOutSine> { static const float *data() { return lut_data::easeOutSine; } };
+    template<> struct lut_table<easeInOutSine> { static const float *data() { return lut_data::easeInOutSine; } };
+    template<> struct lut_table<easeInExpo> { static const float *data() { return lut_data::easeInExpo; } };
+    template<> struct lut_table<easeOutExpo> { static const float *data() { return lut_data::easeOutExpo; } };
+    template<> struct lut_table<easeInOutExpo> { static const float *data() { return lut_data::easeInOutExpo; } };
+    template<> struct lut_table<easeInCirc> { static const float *data() { return lut_data::easeInCirc; } };
+    template<> struct lut_table<easeOutCirc> { static const float *data() { return lut_data::easeOutCirc; } };
+    template<> struct lut_table<easeInOutCirc> { static const float *data() { return lut_data::easeInOutCirc; } };
+    template<> struct lut_table<easeInBack> { static const float *data() { return lut_data::easeInBack; } };
+    template<> struct lut_table<easeOutBack> { static const float *data() { return lut_data::easeOutBack; } };
+    template<> struct lut_table<easeInOutBack> { static const float *data() { return lut_data::easeInOutBack; } };
+    template<> struct lut_table<easeInElastic> { static const float *data() { return lut_data::easeInElastic; } };
+    template<> struct lut_table<easeOutElastic> { static const float *data() { return lut_data::easeOutElastic; } };
+    template<> struct lut_table<easeInOutElastic> { static const float *data() { return lut_data::easeInOutElastic; } };
+    template<> struct lut_table<easeOutBounce> { static const float *data() { return lut_data::easeOutBounce; } };
+    template<> struct lut_table<easeInBounce> { static const float *data() { return lut_data::easeInBounce; } };
+    template<> struct lut_table<easeInOutBounce> { static const float *data() { return lut_data::easeInOutBounce; } };
+    template<> struct lut_table<smoother::Cubic_Polynomial_C1::smoothstep> { static const float *data() { return lut_data::Cubic_Polynomial_C1; } };
+    template<> struct lut_table<smoother::Cubic_Polynomial_C1::inv_smoothstep> { static const float *data() { return lut_data::Cubic_Polynomial_C1_inv; } };
+    template<> struct lut_table<smoother::Quartic_Polynomial_C1::smoothstep> { static const float *data() { return lut_data::Quartic_Polynomial_C1; } };
+    template<> struct lut_table<smoother::Quartic_Polynomial_C1::inv_smoothstep> { static const float *data() { return lut_data::Quartic_Polynomial_C1_inv; } };
+    template<> struct lut_table<smoother::Quintic_Polynomial_C2::smoothstep> { static const float *data() { return lut_data::Quintic_Polynomial_C2; } };
+    template<> struct lut_table<smoother::Quadratic_Rational_C1::smoothstep> { static const float *data() { return lut_data::Quadratic_Rational_C1; } };
+    template<> struct lut_table<smoother::Quadratic_Rational_C1::inv_smoothstep> { static const float *data() { return lut_data::Quadratic_Rational_C1_inv; } };
+    template<> struct lut_table<smoother::Cubic_Rational_C2::smoothstep> { static const float *data() { return lut_data::Cubic_Rational_C2; } };
+    template<> struct lut_table<smoother::Cubic_Rational_C2::inv_smoothstep> { static const float *data() { return lut_data::Cubic_Rational_C2_inv; } };
+    template<> struct lut_table<smoother::Cubic_Rational_C2::inv_smoothstep_alternate> { static const float *data() { return lut_data::Cubic_Rational_C2_inv_alt; } };
+    template<> struct lut_table<smoother::Piecewise_Quadratic_C1::smoothstep> { static const float *data() { return lut_data::Piecewise_Quadratic_C1; } };
+    template<> struct lut_table<smoother::Piecewise_Quadratic_C1::inv_smoothstep> { static const float *data() { return lut_data::Piecewise_Quadratic_C1_inv; } };
+    template<> struct lut_table<smoother::Trigonometric_C1::smoothstep> { static const float *data() { return lut_data::Trigonometric_C1; } };
+    template<> struct lut_table<smoother::Trigonometric_C1::inv_smoothstep> { static const float *data() { return lut_data::Trigonometric_C1_inv; } };
+
+    const easingFuncDesc_t lut_functions[] =
+    {
+      { "linear",                     lut<linear> },
+      { "easeInQuad",                 lut<easeInQuad> },
+      { "easeOutQuad",                lut<easeOutQuad> },
+      { "easeInOutQuad",              lut<easeInOutQuad> },
+      { "easeInCubic",                lut<easeInCubic> },
+      { "easeOutCubic",               lut<easeOutCubic> },
+      { "easeInOutCubic",             lut<easeInOutCubic> },
+      { "easeInQuart",                lut<easeInQuart> },
+      { "easeOutQuart",               lut<easeOutQuart> },
+      { "easeInOutQuart",             lut<easeInOutQuart> },
+      { "easeInQuint",                lut<easeInQuint> },
+      { "easeOutQuint",               lut<easeOutQuint> },
+      { "easeInOutQuint",             lut<easeInOutQuint> },
+      { "easeInSine",                 lut<easeInSine> },
+      { "easeOutSine",                lut<easeOutSine> },
+      { "easeInOutSine",              lut<easeInOutSine> },
+      { "easeInExpo",                 lut<easeInExpo> },
+      { "easeOutExpo",                lut<easeOutExpo> },
+      { "easeInOutExpo",              lut<easeInOutExpo> },
+      { "easeInCirc",                 lut<easeInCirc> },
+      { "easeOutCirc",                lut<easeOutCirc> },
+      { "easeInOutCirc",              lut<easeInOutCirc> },
+      { "easeInBack",                 lut<easeInBack> },
+      { "easeOutBack",                lut<easeOutBack> },
+      { "easeInOutBack",              lut<easeInOutBack> },
+      { "easeInElastic",              lut<easeInElastic> },
+      { "easeOutElastic",             lut<easeOutElastic> },
+      { "easeInOutElastic",           lut<easeInOutElastic> },
+      { "easeOutBounce",              lut<easeOutBounce> },
+      { "easeInBounce",               lut<easeInBounce> },
+      { "easeInOutBounce",            lut<easeInOutBounce> },
+      { "Cubic_Polynomial_C1",        lut<smoother::Cubic_Polynomial_C1::smoothstep> },
+      { "Cubic_Polynomial_C1 inv",    lut<smoother::Cubic_Polynomial_C1::inv_smoothstep> },
+      { "Quartic_Polynomial_C1",      lut<smoother::Quartic_Polynomial_C1::smoothstep> },
+      { "Quartic_Polynomial_C1 inv",  lut<smoother::Quartic_Polynomial_C1::inv_smoothstep> },
+      { "Quintic_Polynomial_C2",      lut<smoother::Quintic_Polynomial_C2::smoothstep> },
+      { "Quadratic_Rational_C1",      lut<smoother::Quadratic_Rational_C1::smoothstep> },
+      { "Quadratic_Rational_C1 inv",  lut<smoother::Quadratic_Rational_C1::inv_smoothstep> },
+      { "Cubic_Rational_C2",          lut<smoother::Cubic_Rational_C2::smoothstep> },
+      { "Cubic_Rational_C2 inv",      lut<smoother::Cubic_Rational_C2::inv_smoothstep> },
+      { "Cubic_Rational_C2 inv alt",  lut<smoother::Cubic_Rational_C2::inv_smoothstep_alternate> },
+      { "Piecewise_Quadratic_C1",     lut<smoother::Piecewise_Quadratic_C1::smoothstep> },
+      { "Piecewise_Quadratic_C1 inv", lut<smoother::Piecewise_Quadratic_C1::inv_smoothstep> },
+      { "Trigonometric_C1",           lut<smoother::Trigonometric_C1::smoothstep> },
+      { "Trigonometric_C1 inv",       lut<smoother::Trigonometric_C1::inv_smoothstep> }
+    };
+
+  };
+
+};
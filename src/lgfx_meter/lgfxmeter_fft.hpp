@@ -0,0 +1,441 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <math.h>
+#include <stdlib.h>
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace fft
+  {
+   /*
+    * Real input FFT for spectrum displays.
+    *
+    * N real samples are packed as N/2 complex values (even samples in the real part,
+    * odd samples in the imaginary part), transformed with a N/2 points complex FFT,
+    * and split into the N/2 bins of the real spectrum. The window and all twiddles
+    * are precomputed, power() returns |X|² so bar graphs can compare squared
+    * thresholds without sqrtf.
+    *
+    *   fft::Real_FFT fft( 256 );
+    *   fft.exec( stereo_samples ); // 256 interleaved L/R frames, mono mixed + windowed
+    *   for( size_t i=0; i<fft.bins(); i++ ) draw( i, fft.get( i ) );
+    *
+    * Real_FFT_Q15 is the same transform in fixed point (Q15 data, 32 bits products,
+    * one bit of scaling per stage) for cores where float throughput is the bottleneck.
+    * Quiet blocks are normalized before the transform (block exponent) so the
+    * per stage scaling doesn't eat their dynamic range.
+    * Define LGFXMETER_FFT_FIXED to make fft::Spectrum_FFT use it.
+    *
+    */
+
+
+    // integer square root, floor(sqrt(x))
+    uint32_t isqrt32( uint32_t x )
+    {
+      uint32_t res = 0;
+      uint32_t bit = 1UL << 30;
+      while( bit > x ) bit >>= 2;
+      while( bit ) {
+        if( x >= res + bit ) {
+          x  -= res + bit;
+          res = ( res >> 1 ) + bit;
+        } else {
+          res >>= 1;
+        }
+        bit >>= 2;
+      }
+      return res;
+    }
+
+
+    // log2(x) in Q8 (256 == 1.0), the mantissa is linearly approximated (max error 0.086, ~0.26dB)
+    uint32_t log2q8( uint32_t x )
+    {
+      if( x == 0 ) return 0;
+      uint32_t exponent = 31 - __builtin_clz( x );
+      uint32_t mantissa = exponent >= 8 ? ( x >> ( exponent-8 ) ) & 0xff : ( x << ( 8-exponent ) ) & 0xff;
+      return ( exponent << 8 ) | mantissa;
+    }
+
+
+    class Real_FFT
+    {
+    public:
+
+      Real_FFT( size_t size = 256 );
+      ~Real_FFT();
+
+      bool ready() { return _ready; }
+      size_t size() { return n; }
+      size_t bins() { return n/2; }
+
+      // interleaved stereo int16, n frames, mixed to mono
+      void exec( const int16_t *stereo );
+      // mono float, n samples
+      void exec( const float *mono );
+
+      // squared magnitude, no sqrt
+      float power( size_t bin ) { return bin < n/2 ? outr[bin]*outr[bin] + outi[bin]*outi[bin] : 0; }
+      float magnitude( size_t bin ) { return sqrtf( power( bin ) ); }
+      uint32_t get( size_t bin ) { return (uint32_t)magnitude( bin ); }
+
+    private:
+
+      size_t n    = 0;  // real input size
+      size_t m    = 0;  // complex transform size, n/2
+      bool _ready = false;
+
+      float    *window = nullptr; // n/2, mirrored: w[n-1-j] == w[j]
+      float    *twr    = nullptr; // n/2, cos(2*PI*k/n)
+      float    *twi    = nullptr; // n/2, -sin(2*PI*k/n)
+      uint16_t *bitrev = nullptr; // m
+      float    *zr     = nullptr; // m, work buffer
+      float    *zi     = nullptr;
+      float    *outr   = nullptr; // n/2, spectrum
+      float    *outi   = nullptr;
+
+      void load( size_t j, float even, float odd ) { zr[bitrev[j]] = even; zi[bitrev[j]] = odd; }
+      void transform();
+      void split();
+
+    };
+
+
+    Real_FFT::Real_FFT( size_t size )
+    {
+      if( size < 4 || ( size & (size-1) ) != 0 || size > 65536 ) {
+        log_e("FFT size must be a power of two between 4 and 65536, got %d", int(size) );
+        return;
+      }
+      n = size;
+      m = size/2;
+
+      window = (float*)malloc( m*sizeof(float) );
+      twr    = (float*)malloc( m*sizeof(float) );
+      twi    = (float*)malloc( m*sizeof(float) );
+      bitrev = (uint16_t*)malloc( m*sizeof(uint16_t) );
+      zr     = (float*)malloc( m*sizeof(float) );
+      zi     = (float*)malloc( m*sizeof(float) );
+      outr   = (float*)malloc( m*sizeof(float) );
+      outi   = (float*)malloc( m*sizeof(float) );
+
+      if( !window || !twr || !twi || !bitrev || !zr || !zi || !outr || !outi ) {
+        log_e("Not enough memory for a %d points FFT", int(n) );
+        return;
+      }
+
+      const float omega = 2.0f * M_PI / n;
+      for( size_t k=0; k<m; k++ ) {
+        window[k] = 0.5f * ( 1.0f - cosf( omega*k ) ); // hann
+        twr[k]    =  cosf( omega*k );
+        twi[k]    = -sinf( omega*k );
+      }
+
+      size_t bits = 0;
+      while( ( size_t(1) << bits ) < m ) bits++;
+      for( size_t j=0; j<m; j++ ) {
+        size_t r = 0;
+        for( size_t b=0; b<bits; b++ ) if( j & ( size_t(1) << b ) ) r |= size_t(1) << ( bits-1-b );
+        bitrev[j] = r;
+      }
+
+      _ready = true;
+    }
+
+
+    Real_FFT::~Real_FFT()
+    {
+      free( window ); free( twr ); free( twi ); free( bitrev );
+      free( zr ); free( zi ); free( outr ); free( outi );
+    }
+
+
+    void Real_FFT::exec( const int16_t *stereo )
+    {
+      if( !_ready ) return;
+      for( size_t j=0; j<m; j++ ) {
+        // x[2j] and x[2j+1] with the mirrored window, 0.5 for the stereo mix
+        size_t e = 2*j, o = 2*j+1;
+        float we = e < m ? window[e] : window[n-1-e];
+        float wo = o < m ? window[o] : window[n-1-o];
+        load( j, 0.5f*we*( stereo[e*2] + stereo[e*2+1] ), 0.5f*wo*( stereo[o*2] + stereo[o*2+1] ) );
+      }
+      transform();
+      split();
+    }
+
+
+    void Real_FFT::exec( const float *mono )
+    {
+      if( !_ready ) return;
+      for( size_t j=0; j<m; j++ ) {
+        size_t e = 2*j, o = 2*j+1;
+        float we = e < m ? window[e] : window[n-1-e];
+        float wo = o < m ? window[o] : window[n-1-o];
+        load( j, we*mono[e], wo*mono[o] );
+      }
+      transform();
+      split();
+    }
+
+
+    // in place radix-2 on bit reversed input, W_len^j == W_n^(j*n/len)
+    void Real_FFT::transform()
+    {
+      for( size_t len=2; len<=m; len<<=1 ) {
+        size_t half = len/2;
+        size_t step = n/len;
+        for( size_t i=0; i<m; i+=len ) {
+          for( size_t j=0, k=0; j<half; j++, k+=step ) {
+            size_t a = i+j, b = a+half;
+            float vr = zr[b]*twr[k] - zi[b]*twi[k];
+            float vi = zr[b]*twi[k] + zi[b]*twr[k];
+            zr[b] = zr[a] - vr;
+            zi[b] = zi[a] - vi;
+            zr[a] += vr;
+            zi[a] += vi;
+          }
+        }
+      }
+    }
+
+
+    // X[k] = E[k] + W_n^k * O[k], E = ( Z[k] + conj(Z[m-k]) )/2, O = ( Z[k] - conj(Z[m-k]) )/2i
+    void Real_FFT::split()
+    {
+      for( size_t k=0; k<m; k++ ) {
+        size_t c  = k ? m-k : 0;
+        float ar  = zr[k], ai = zi[k];
+        float br  = zr[c], bi = -zi[c];
+        float er  = 0.5f*( ar + br ), ei = 0.5f*( ai + bi );
+        float or_ = 0.5f*( ai - bi ), oi = -0.5f*( ar - br );
+        outr[k] = er + twr[k]*or_ - twi[k]*oi;
+        outi[k] = ei + twr[k]*oi  + twi[k]*or_;
+      }
+    }
+
+
+    class Real_FFT_Q15
+    {
+    public:
+
+      Real_FFT_Q15( size_t size = 256 );
+      ~Real_FFT_Q15();
+
+      bool ready() { return _ready; }
+      size_t size() { return n; }
+      size_t bins() { return n/2; }
+
+      // interleaved stereo int16, n frames, mixed to mono
+      void exec( const int16_t *stereo );
+
+      // raw |X/n|² * 4^exponent(), up to 2^30
+      uint32_t powerQ( size_t bin ) { return bin < n/2 ? uint32_t( outr[bin]*outr[bin] + outi[bin]*outi[bin] ) : 0; }
+      // block normalization of the last exec()
+      uint8_t exponent() { return blockExp; }
+      // same units as Real_FFT
+      float power( size_t bin ) { return ldexpf( float( powerQ( bin ) ), 2*( int( log2n ) - blockExp ) ); }
+      uint32_t magnitude( size_t bin );
+      uint32_t get( size_t bin ) { return magnitude( bin ); }
+      // log2 of power() in Q8, e.g. dB = log2Power()*3.0103/256
+      uint32_t log2Power( size_t bin );
+
+    private:
+
+      size_t  n     = 0;
+      size_t  m     = 0;
+      uint8_t log2n = 0;
+      uint8_t blockExp = 0;
+      bool   _ready = false;
+
+      int16_t  *window = nullptr; // n/2, Q15
+      int16_t  *twr    = nullptr; // n/2, Q15 cos(2*PI*k/n)
+      int16_t  *twi    = nullptr; // n/2, Q15 -sin(2*PI*k/n)
+      uint16_t *bitrev = nullptr; // m
+      int16_t  *zr     = nullptr; // m, work buffer, scaled by 1/n after transform()
+      int16_t  *zi     = nullptr;
+      int32_t  *outr   = nullptr; // n/2, spectrum scaled by 2^blockExp/n, windowed input during exec()
+      int32_t  *outi   = nullptr;
+
+      void transform();
+      void split();
+
+    };
+
+
+    Real_FFT_Q15::Real_FFT_Q15( size_t size )
+    {
+      if( size < 4 || ( size & (size-1) ) != 0 || size > 65536 ) {
+        log_e("FFT size must be a power of two between 4 and 65536, got %d", int(size) );
+        return;
+      }
+      n = size;
+      m = size/2;
+      while( ( size_t(1) << log2n ) < n ) log2n++;
+
+      window = (int16_t*)malloc( m*sizeof(int16_t) );
+      twr    = (int16_t*)malloc( m*sizeof(int16_t) );
+      twi    = (int16_t*)malloc( m*sizeof(int16_t) );
+      bitrev = (uint16_t*)malloc( m*sizeof(uint16_t) );
+      zr     = (int16_t*)malloc( m*sizeof(int16_t) );
+      zi     = (int16_t*)malloc( m*sizeof(int16_t) );
+      outr   = (int32_t*)malloc( m*sizeof(int32_t) );
+      outi   = (int32_t*)malloc( m*sizeof(int32_t) );
+
+      if( !window || !twr || !twi || !bitrev || !zr || !zi || !outr || !outi ) {
+        log_e("Not enough memory for a %d points FFT", int(n) );
+        return;
+      }
+
+      const float omega = 2.0f * M_PI / n;
+      for( size_t k=0; k<m; k++ ) {
+        window[k] = lroundf( 32767.0f * 0.5f * ( 1.0f - cosf( omega*k ) ) );
+        twr[k]    = lroundf(  32767.0f * cosf( omega*k ) );
+        twi[k]    = lroundf( -32767.0f * sinf( omega*k ) );
+      }
+
+      for( size_t j=0; j<m; j++ ) {
+        size_t r = 0;
+        for( size_t b=0; b<size_t(log2n-1); b++ ) if( j & ( size_t(1) << b ) ) r |= size_t(1) << ( log2n-2-b );
+        bitrev[j] = r;
+      }
+
+      _ready = true;
+    }
+
+
+    Real_FFT_Q15::~Real_FFT_Q15()
+    {
+      free( window ); free( twr ); free( twi ); free( bitrev );
+      free( zr ); free( zi ); free( outr ); free( outi );
+    }
+
+
+    void Real_FFT_Q15::exec( const int16_t *stereo )
+    {
+      if( !_ready ) return;
+      uint32_t peak = 0;
+      for( size_t j=0; j<m; j++ ) {
+        size_t e = 2*j, o = 2*j+1;
+        int32_t we = e < m ? window[e] : window[n-1-e];
+        int32_t wo = o < m ? window[o] : window[n-1-o];
+        // (L+R) * w, Q15
+        outr[j] = ( int32_t( stereo[e*2] ) + stereo[e*2+1] ) * we;
+        outi[j] = ( int32_t( stereo[o*2] ) + stereo[o*2+1] ) * wo;
+        peak |= uint32_t( outr[j] < 0 ? -outr[j] : outr[j] ) | uint32_t( outi[j] < 0 ? -outi[j] : outi[j] );
+      }
+      // >>17 gives (L+R)/2*w/2, the halving keeps |xe + i.xo| below 1.0;
+      // quiet blocks are shifted less, as long as components stay below 0.5
+      blockExp = 0;
+      while( blockExp < 16 && ( peak >> ( 16-blockExp ) ) < 16384 ) blockExp++;
+      const uint8_t shift = 17 - blockExp;
+      const int32_t round = 1 << ( shift-1 );
+      for( size_t j=0; j<m; j++ ) {
+        zr[bitrev[j]] = ( outr[j] + round ) >> shift;
+        zi[bitrev[j]] = ( outi[j] + round ) >> shift;
+      }
+      transform();
+      split();
+    }
+
+
+    uint32_t Real_FFT_Q15::magnitude( size_t bin )
+    {
+      uint32_t mag = isqrt32( powerQ( bin ) );
+      return log2n >= blockExp ? mag << ( log2n-blockExp ) : mag >> ( blockExp-log2n );
+    }
+
+
+    uint32_t Real_FFT_Q15::log2Power( size_t bin )
+    {
+      uint32_t p = powerQ( bin );
+      if( !p ) return 0;
+      int32_t l = int32_t( log2q8( p ) ) + ( int32_t( log2n ) - blockExp ) * 512;
+      return l > 0 ? l : 0;
+    }
+
+
+    // same butterflies as Real_FFT::transform(), halved at each stage so int16 never overflows
+    void Real_FFT_Q15::transform()
+    {
+      for( size_t len=2; len<=m; len<<=1 ) {
+        size_t half = len/2;
+        size_t step = n/len;
+        for( size_t i=0; i<m; i+=len ) {
+          for( size_t j=0, k=0; j<half; j++, k+=step ) {
+            size_t a = i+j, b = a+half;
+            int32_t vr = ( int32_t( zr[b] )*twr[k] - int32_t( zi[b] )*twi[k] + ( 1 << 14 ) ) >> 15;
+            int32_t vi = ( int32_t( zr[b] )*twi[k] + int32_t( zi[b] )*twr[k] + ( 1 << 14 ) ) >> 15;
+            int32_t ar = zr[a], ai = zi[a];
+            zr[b] = ( ar - vr + 1 ) >> 1;
+            zi[b] = ( ai - vi + 1 ) >> 1;
+            zr[a] = ( ar + vr + 1 ) >> 1;
+            zi[a] = ( ai + vi + 1 ) >> 1;
+          }
+        }
+      }
+    }
+
+
+    // same split as Real_FFT::split(), |X/n| <= 1.0 so the result fits in Q15
+    void Real_FFT_Q15::split()
+    {
+      for( size_t k=0; k<m; k++ ) {
+        size_t c    = k ? m-k : 0;
+        int32_t ar  = zr[k], ai = zi[k];
+        int32_t br  = zr[c], bi = -zi[c];
+        int32_t er  = ( ar + br + 1 ) >> 1, ei = ( ai + bi + 1 ) >> 1;
+        int32_t or_ = ( ai - bi + 1 ) >> 1, oi = ( br - ar + 1 ) >> 1;
+        int32_t wr  = ( or_*twr[k] - oi*twi[k] + ( 1 << 14 ) ) >> 15;
+        int32_t wi  = ( oi*twr[k] + or_*twi[k] + ( 1 << 14 ) ) >> 15;
+        outr[k] = er + wr;
+        outi[k] = ei + wi;
+      }
+    }
+
+
+    #if defined LGFXMETER_FFT_FIXED
+      typedef Real_FFT_Q15 Spectrum_FFT;
+    #else
+      typedef Real_FFT Spectrum_FFT;
+    #endif
+
+
+  }; // end namespace fft
+
+}; // end namespace LGFXMeter
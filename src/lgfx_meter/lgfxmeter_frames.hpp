@@ -0,0 +1,214 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <string.h>
+#include <math.h>
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace frames
+  {
+
+    using namespace utils;
+
+   /*
+    * Pre-rotated needle frames, produced by tools/needle_frames.py and read in place
+    * (e.g. from flash): every frame is a list of row spans, opaque spans are plain RGB565
+    * copies and antialiased edges are RGB565 + A8 spans blended into the destination.
+    *
+    * Little endian, header and frames are 4 bytes aligned:
+    *
+    *   header
+    *     0  char[4]  magic "LGNF"
+    *     4  uint8    version
+    *     5  uint8    flags, see flag_shadow
+    *     6  uint16   frames count
+    *     8  float    first angle, lgfx rotation (degrees clockwise, 0 = needle pointing up)
+    *     12 float    angle step, degrees
+    *     16 uint32   frame offsets[count], from the start of the asset
+    *   frame
+    *     0  int16    x, y: top left corner relative to the pivot
+    *     4  uint16   w, h
+    *     8  uint32   colors count, even
+    *     12 uint32   alphas count
+    *     16 uint16   colors[], RGB565 of every run pixel in row order
+    *        uint8    alphas[], one per pixel of the RUN_ALPHA runs
+    *        rows[h], padded to 4 bytes
+    *   row
+    *     0  uint8    runs count
+    *     1  runs
+    *   run
+    *     0  uint8    x skip from the end of the previous run (or the frame left edge)
+    *     1  uint8    len, px (run_max) | RUN_ALPHA
+    *
+    */
+
+    const uint8_t version     = 2;
+    const uint8_t flag_shadow = 0x01; // drop shadow is baked in the frames
+    const uint8_t run_max     = 0x7f;
+
+    enum run_type_t
+    {
+      RUN_OPAQUE = 0x00, // rgb565 pixels
+      RUN_ALPHA  = 0x80  // rgb565 pixels + alpha plane
+    };
+
+
+    class Needle_Frames
+    {
+    public:
+
+      Needle_Frames( const uint8_t *_data = nullptr );
+
+      bool valid() { return data != nullptr; }
+      uint16_t count() { return framesCount; }
+      bool hasShadow() { return flags & flag_shadow; }
+      // nearest frame for a lgfx rotation angle, clamped to the closest end of the range
+      int index( float angle );
+      // frame bounds when the pivot is at pivot_x/pivot_y
+      clipRect_t bounds( int idx, int32_t pivot_x, int32_t pivot_y );
+      // spans are clipped by the dst clip rect
+      void blit( LovyanGFX *dst, int32_t pivot_x, int32_t pivot_y, int idx );
+
+    private:
+
+      const uint8_t *data = nullptr;
+      uint16_t framesCount = 0;
+      uint8_t  flags = 0;
+      float    first = 0;
+      float    step  = 1;
+
+      static uint16_t read16( const uint8_t *p ) { uint16_t v; memcpy( &v, p, 2 ); return v; }
+      static uint32_t read32( const uint8_t *p ) { uint32_t v; memcpy( &v, p, 4 ); return v; }
+      const uint8_t *frameAt( int idx ) { return data + read32( data + 16 + idx*4 ); }
+
+    };
+
+
+    Needle_Frames::Needle_Frames( const uint8_t *_data )
+    {
+      if( !_data ) return;
+      if( memcmp( _data, "LGNF", 4 ) != 0 || _data[4] != version ) {
+        log_e("Invalid needle frames (magic/version)");
+        return;
+      }
+      if( ( uintptr_t(_data) & 3 ) != 0 ) {
+        log_e("Needle frames must be 4 bytes aligned");
+        return;
+      }
+      flags       = _data[5];
+      framesCount = read16( _data + 6 );
+      memcpy( &first, _data + 8,  4 );
+      memcpy( &step,  _data + 12, 4 );
+      if( framesCount == 0 || step <= 0 ) {
+        log_e("Empty needle frames");
+        return;
+      }
+      data = _data;
+      log_d("Needle frames: %d frames from %.1f step %.2f deg%s", framesCount, first, step, hasShadow() ? ", shadow" : "" );
+    }
+
+
+    int Needle_Frames::index( float angle )
+    {
+      if( !data ) return -1;
+      float a = fmodf( angle - first, 360.0f );
+      if( a < 0 ) a += 360.0f;
+      float last = ( framesCount-1 )*step;
+      if( a > last + step*0.5f ) {
+        if( framesCount*step >= 360.0f ) return 0; // full circle, wrapped
+        return a > last + ( 360.0f-last )*0.5f ? 0 : framesCount-1;
+      }
+      int idx = int( a/step + 0.5f );
+      return idx < framesCount ? idx : framesCount-1;
+    }
+
+
+    clipRect_t Needle_Frames::bounds( int idx, int32_t pivot_x, int32_t pivot_y )
+    {
+      if( !data || idx < 0 ) return { pivot_x, pivot_y, 0, 0 };
+      const uint8_t *frame = frameAt( idx );
+      return {
+        pivot_x + int16_t( read16( frame ) ),
+        pivot_y + int16_t( read16( frame+2 ) ),
+        read16( frame+4 ),
+        read16( frame+6 )
+      };
+    }
+
+
+    void Needle_Frames::blit( LovyanGFX *dst, int32_t pivot_x, int32_t pivot_y, int idx )
+    {
+      if( !data || idx < 0 ) return;
+      const uint8_t *frame = frameAt( idx );
+      int32_t x0 = pivot_x + int16_t( read16( frame ) );
+      int32_t y  = pivot_y + int16_t( read16( frame+2 ) );
+      uint16_t h = read16( frame+6 );
+      const lgfx::rgb565_t *color = (const lgfx::rgb565_t*)( frame + 16 );
+      const uint8_t *alpha = frame + 16 + read32( frame+8 )*2;
+      const uint8_t *row   = alpha + read32( frame+12 );
+      lgfx::argb8888_t blend[run_max];
+      for( uint16_t j=0; j<h; j++, y++ ) {
+        uint8_t runs = *row++;
+        int32_t x = x0;
+        for( uint8_t i=0; i<runs; i++, row+=2 ) {
+          x += row[0];
+          uint8_t len = row[1] & run_max;
+          if( row[1] & RUN_ALPHA ) {
+            for( uint8_t k=0; k<len; k++ ) {
+              uint16_t c = color[k].raw;
+              uint8_t r = c >> 11, g = ( c >> 5 ) & 0x3f, b = c & 0x1f;
+              blend[k].r = ( r << 3 ) | ( r >> 2 );
+              blend[k].g = ( g << 2 ) | ( g >> 4 );
+              blend[k].b = ( b << 3 ) | ( b >> 2 );
+              blend[k].a = alpha[k];
+            }
+            dst->pushAlphaImage( x, y, len, 1, blend );
+            alpha += len;
+          } else if( len ) {
+            dst->pushImage( x, y, len, 1, color );
+          }
+          color += len;
+          x     += len;
+        }
+      }
+    }
+
+
+  }; // end namespace frames
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,214 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_memory.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace layers
+  {
+   /*
+    * Layer stack.
+    *
+    * LAYER_BACKGROUND, LAYER_FACE: static, flattened once into a canvas, the canvas is what
+    *                               dynamic layers are restored from.
+    * LAYER_DYNAMIC, LAYER_OVERLAY: re-rendered over the flattened canvas for every dirty region.
+    *
+    * The background renderer is expected to cover the whole canvas, without one the canvas
+    * content is kept as the background (e.g. a canvas provided by the user).
+    *
+    * invalidate() re-flattens from the given static layer upward. A static layer can also keep
+    * a snapshot of the flattened result (see cache()), so invalidating the layer above it doesn't
+    * re-render it, e.g. a new gauge face doesn't decode the background image again.
+    *
+    */
+
+    enum layer_id_t
+    {
+      LAYER_BACKGROUND,
+      LAYER_FACE,
+      LAYER_DYNAMIC,
+      LAYER_OVERLAY,
+      LAYERS_COUNT
+    };
+
+    // dst (0,0) is at originX/originY in the layer stack coords
+    typedef void (*layerRender_t)( LovyanGFX *dst, int32_t originX, int32_t originY, void *ctx );
+
+    struct layer_t
+    {
+      layerRender_t render;
+      void          *ctx;
+      ICS_Sprite    *snapshot; // flattened result up to this layer, static layers only
+    };
+
+
+    class Layer_Stack
+    {
+    public:
+
+      Layer_Stack( ICS_Sprite *_canvas )
+      {
+        assert( _canvas );
+        canvas = _canvas;
+        for( int i=0; i<LAYERS_COUNT; i++ ) stack[i] = { nullptr, nullptr, nullptr };
+      };
+
+      ~Layer_Stack()
+      {
+        for( int i=0; i<LAYERS_COUNT; i++ ) dropSnapshot( (layer_id_t)i );
+      }
+
+      static bool isStatic( layer_id_t layer ) { return layer < LAYER_DYNAMIC; }
+
+      void setLayer( layer_id_t layer, layerRender_t render, void *ctx = nullptr );
+      // keep a copy of the flattened static layers up to this one (re-flattens now), false if out of memory
+      bool cache( layer_id_t layer, placement_t place = PLACE_DEFAULT );
+      // static layers are re-flattened on next flatten(), dynamic layers are per-region anyway
+      void invalidate( layer_id_t layer );
+      bool dirty() { return staleFrom < LAYER_DYNAMIC; }
+      // re-render the stale static layers into the canvas
+      void flatten();
+      // canvas + dynamic layers, dst (0,0) is at originX/originY
+      void compose( LovyanGFX *dst, int32_t originX, int32_t originY );
+      // a single layer, nothing if it has no renderer
+      void render( layer_id_t layer, LovyanGFX *dst, int32_t originX, int32_t originY );
+
+      void setTransparent( bool _transparent, uint32_t color ) { transparent = _transparent; transparent_color = color; }
+      ICS_Sprite *getCanvas() { return canvas; }
+
+    private:
+
+      ICS_Sprite *canvas;
+      layer_t    stack[LAYERS_COUNT];
+      int        staleFrom = LAYER_BACKGROUND; // lowest static layer to re-render, LAYER_DYNAMIC when clean
+
+      bool       transparent = false; // canvas has holes, pushed with transparent_color
+      uint32_t   transparent_color = 0;
+
+      void dropSnapshot( layer_id_t layer );
+
+    };
+
+
+    void Layer_Stack::setLayer( layer_id_t layer, layerRender_t render, void *ctx )
+    {
+      if( layer >= LAYERS_COUNT ) return;
+      stack[layer].render = render;
+      stack[layer].ctx    = ctx;
+      invalidate( layer );
+    }
+
+
+    bool Layer_Stack::cache( layer_id_t layer, placement_t place )
+    {
+      if( !isStatic( layer ) ) return false;
+      if( stack[layer].snapshot ) return true;
+      ICS_Sprite *snapshot = new ICS_Sprite( canvas );
+      snapshot->setColorDepth( canvas->getColorDepth() );
+      // only read when a layer above is invalidated
+      if( !memory::createSprite( snapshot, canvas->width(), canvas->height(), memory::HEAT_COLD, "snapshot", nullptr, false, place ) ) {
+        log_e("Not enough memory to cache layer #%d", layer );
+        delete snapshot;
+        return false;
+      }
+      stack[layer].snapshot = snapshot;
+      invalidate( layer ); // the snapshot is taken while flattening
+      flatten();           // now, so the stack isn't left dirty
+      return true;
+    }
+
+
+    void Layer_Stack::dropSnapshot( layer_id_t layer )
+    {
+      if( !stack[layer].snapshot ) return;
+      stack[layer].snapshot->deleteSprite();
+      delete stack[layer].snapshot;
+      stack[layer].snapshot = nullptr;
+    }
+
+
+    void Layer_Stack::invalidate( layer_id_t layer )
+    {
+      if( isStatic( layer ) && layer < staleFrom ) staleFrom = layer;
+    }
+
+
+    void Layer_Stack::flatten()
+    {
+      if( !dirty() ) return;
+      int from = LAYER_BACKGROUND;
+      // restart from the nearest clean snapshot below the stale layer
+      for( int i=staleFrom-1; i>=LAYER_BACKGROUND; i-- ) {
+        if( stack[i].snapshot ) {
+          stack[i].snapshot->pushSprite( canvas, 0, 0 );
+          from = i+1;
+          break;
+        }
+      }
+      for( int i=from; i<LAYER_DYNAMIC; i++ ) {
+        render( (layer_id_t)i, canvas, 0, 0 );
+        if( stack[i].snapshot ) canvas->pushSprite( stack[i].snapshot, 0, 0 );
+      }
+      staleFrom = LAYER_DYNAMIC;
+    }
+
+
+    void Layer_Stack::compose( LovyanGFX *dst, int32_t originX, int32_t originY )
+    {
+      flatten();
+      if( transparent ) {
+        canvas->pushSprite( dst, -originX, -originY, transparent_color );
+      } else {
+        canvas->pushSprite( dst, -originX, -originY );
+      }
+      for( int i=LAYER_DYNAMIC; i<LAYERS_COUNT; i++ ) {
+        render( (layer_id_t)i, dst, originX, originY );
+      }
+    }
+
+
+    void Layer_Stack::render( layer_id_t layer, LovyanGFX *dst, int32_t originX, int32_t originY )
+    {
+      if( layer >= LAYERS_COUNT || !stack[layer].render ) return;
+      stack[layer].render( dst, originX, originY, stack[layer].ctx );
+    }
+
+
+  }; // end namespace layers
+
+}; // end namespace LGFXMeter
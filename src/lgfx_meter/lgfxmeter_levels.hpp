@@ -0,0 +1,239 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include <math.h>
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_channel.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace levels
+  {
+   /*
+    * Windowed level aggregator.
+    *
+    * The audio side feeds interleaved int16 or float blocks at audio rate, every
+    * sample updates the running detectors in O(1):
+    *
+    *   - peak: max absolute value since the previous take()
+    *   - rms:  square root of the exponential moving average of x², time constant rms_ms
+    *   - vu:   rectified average reaching 99% of a steady level in vu_ms
+    *   - ppm:  quasi-peak, integration time ppm_attack_ms, falls back by ppm_release dB/s
+    *
+    * Values are normalized to full scale (1.0 == 0 dBFS). Each block publishes a
+    * snapshot through a channel::Value_Channel, the renderer takes the latest one
+    * once per frame, so the audio rate and the frame rate are unrelated.
+    *
+    *   levels::Level_Meter meter( { 44100, 2, 300, 300, 10, 11.8 } );
+    *
+    *   // audio task
+    *   meter.process( samples, frames );
+    *
+    *   // render loop
+    *   levels::level_t frame;
+    *   if( meter.take( frame ) ) gauge->setNeedle( frame.mean( frame.vu ) * 90.0f );
+    *
+    */
+
+    const uint8_t max_channels = 2;
+
+    struct level_cfg_t
+    {
+      uint32_t sample_rate;   // Hz
+      uint8_t  channels;      // interleaved channels, up to max_channels
+      float    rms_ms;        // rms time constant
+      float    vu_ms;         // vu rise time to 99%
+      float    ppm_attack_ms; // ppm integration time
+      float    ppm_release;   // ppm fall back, dB per second
+    };
+
+    const level_cfg_t default_cfg =
+    {
+      .sample_rate   = 44100,
+      .channels      = 2,
+      .rms_ms        = 300.0f,
+      .vu_ms         = 300.0f,
+      .ppm_attack_ms = 10.0f,
+      .ppm_release   = 11.8f // IEC 60268-10 type I: 20dB in 1.7s
+    };
+
+
+    struct level_t
+    {
+      float    peak[max_channels];
+      float    rms[max_channels];
+      float    vu[max_channels];
+      float    ppm[max_channels];
+      uint8_t  channels;
+      uint32_t samples; // frames aggregated since the previous take()
+
+      float mean( const float *values ) const
+      {
+        float sum = 0;
+        for( uint8_t c=0; c<channels; c++ ) sum += values[c];
+        return channels ? sum/channels : 0;
+      }
+
+      // channel::Value_Channel aggregate: peaks of every block, detectors of the latest one
+      void reset() { samples = 0; }
+
+      void add( const level_t &block )
+      {
+        for( uint8_t c=0; c<block.channels; c++ ) {
+          if( samples == 0 || block.peak[c] > peak[c] ) peak[c] = block.peak[c];
+          rms[c] = block.rms[c];
+          vu[c]  = block.vu[c];
+          ppm[c] = block.ppm[c];
+        }
+        channels = block.channels;
+        samples += block.samples;
+      }
+    };
+
+
+    // 1.0 => 0 dBFS, silence is clamped to -120 dB
+    float toDb( float level )
+    {
+      return level > 1e-6f ? 20.0f*log10f( level ) : -120.0f;
+    }
+
+
+    class Level_Meter
+    {
+    public:
+
+      Level_Meter( level_cfg_t _cfg = default_cfg )
+      {
+        cfg = _cfg;
+        if( cfg.channels > max_channels ) {
+          log_e("Level meter supports up to %d channels, got %d", max_channels, cfg.channels );
+          cfg.channels = max_channels;
+        }
+        reset();
+        setSampleRate( cfg.sample_rate );
+      };
+
+      // audio side: interleaved blocks of `frames` samples per channel
+      void process( const int16_t *samples, size_t frames ) { processBlock( samples, frames, 1.0f/32768.0f ); }
+      void process( const float *samples, size_t frames )   { processBlock( samples, frames, 1.0f ); }
+      // recompute the detector coefficients, cheap when the rate is unchanged
+      void setSampleRate( uint32_t sample_rate );
+      void reset();
+
+      // render side, returns false when no block was processed since the last call
+      bool take( level_t &out ) { return snapshots.take( out ); }
+
+    private:
+
+      level_cfg_t cfg;
+
+      // detector coefficients
+      float rmsCoeff     = 0;
+      float vuCoeff      = 0;
+      float attackCoeff  = 0;
+      float releaseCoeff = 1;
+
+      // detectors state, producer owned
+      float meanSquare[max_channels];
+      float vuState[max_channels];
+      float ppmState[max_channels];
+
+      channel::Value_Channel<level_t, level_t> snapshots; // one per block, merged until taken
+
+      template<typename T> void processBlock( const T *samples, size_t frames, float scale );
+
+    };
+
+
+    void Level_Meter::setSampleRate( uint32_t sample_rate )
+    {
+      if( sample_rate == 0 ) return;
+      if( sample_rate == cfg.sample_rate && rmsCoeff != 0 ) return;
+      cfg.sample_rate = sample_rate;
+      float fs = sample_rate;
+      // one pole: y += a*(x-y), a = 1-exp(-1/(tau*fs))
+      rmsCoeff     = 1.0f - expf( -1000.0f / ( cfg.rms_ms * fs ) );
+      vuCoeff      = 1.0f - expf( -1000.0f*logf( 100.0f ) / ( cfg.vu_ms * fs ) ); // 99% after vu_ms
+      attackCoeff  = 1.0f - expf( -1000.0f / ( cfg.ppm_attack_ms * fs ) );
+      releaseCoeff = powf( 10.0f, -cfg.ppm_release / ( 20.0f * fs ) );
+    }
+
+
+    void Level_Meter::reset()
+    {
+      for( uint8_t c=0; c<max_channels; c++ ) {
+        meanSquare[c] = vuState[c] = ppmState[c] = 0;
+      }
+    }
+
+
+    template<typename T> void Level_Meter::processBlock( const T *samples, size_t frames, float scale )
+    {
+      if( !samples || frames == 0 ) return;
+      const uint8_t channels = cfg.channels;
+      level_t block;
+      block.channels = channels;
+      block.samples  = frames;
+      for( uint8_t c=0; c<channels; c++ ) {
+        // detectors are kept in registers for the whole block
+        float ms   = meanSquare[c];
+        float vu   = vuState[c];
+        float ppm  = ppmState[c];
+        float peak = 0;
+        const T *in = samples + c;
+        for( size_t n=0; n<frames; n++, in += channels ) {
+          float x = fabsf( float( *in ) * scale );
+          if( x > peak ) peak = x;
+          ms += rmsCoeff * ( x*x - ms );
+          vu += vuCoeff  * ( x - vu );
+          if( x > ppm ) ppm += attackCoeff * ( x - ppm );
+          else          ppm *= releaseCoeff;
+        }
+        meanSquare[c] = ms;
+        vuState[c]    = vu;
+        ppmState[c]   = ppm;
+        block.peak[c] = peak;
+        block.rms[c]  = sqrtf( ms );
+        block.vu[c]   = vu;
+        block.ppm[c]  = ppm;
+      }
+      snapshots.push( block );
+    }
+
+
+  }; // end namespace levels
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,290 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+
+#if defined ESP_PLATFORM
+  #include <esp_heap_caps.h>
+  #include <esp_idf_version.h>
+  #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+    #define LGFXMETER_HEAP_LOCAL_MINIMUM // minimum free size can be reset per phase
+  #endif
+#endif
+
+
+namespace LGFXMeter
+{
+
+  namespace memory
+  {
+   /*
+    * Construction profiler.
+    *
+    * The gauge and needle report the duration of each setup phase and every
+    * allocation they make into a gauge_report_t, along with the lowest free
+    * heap seen during construction, transient peaks included (e.g. a decoder
+    * buffer inside drawImage). The same report can be produced without
+    * allocating anything (dry run) to check a configuration against a board.
+    *
+    */
+
+    const size_t max_allocs = 10;
+    const size_t max_phases = 8;
+
+   /*
+    * Sprite placement policy.
+    *
+    * Buffers are classified by how often they are accessed, and each class
+    * has a preferred memory type. When the preferred memory is exhausted
+    * (or absent) the other one is tried, and the actual placement is recorded.
+    *
+    */
+
+    enum heat_t : uint8_t
+    {
+      HEAT_HOT,  // read/written every frame (needle, shadow, clip)
+      HEAT_WARM, // read every frame to restore the background, written when a static layer changes (gauge canvas)
+      HEAT_COLD  // setup only, or read when a static layer changes (mask, layer snapshot)
+    };
+
+    struct placement_policy_t
+    {
+      bool psram[3];  // prefer psram for [hot, warm, cold] buffers
+      bool fallback;  // try the other memory type when allocation fails
+    };
+
+    // cold buffers go to psram, hot and warm buffers are read by every frame and stay in dram
+    const placement_policy_t default_policy = { { false, false, true }, true };
+    // opt-in: warm buffers in psram too, saves dram but every background restore reads psram
+    const placement_policy_t psram_policy   = { { false, true, true }, true };
+
+    placement_policy_t policy = default_policy;
+
+    const char *heat_names[] = { "hot", "warm", "cold" };
+
+
+    // allocation record
+    struct alloc_t
+    {
+      const char *name;  // e.g. "mask"
+      uint32_t   bytes;  // requested buffer size
+      bool       psram;  // requested memory type
+      bool       ok;     // allocation succeeded (always true in dry run)
+      bool       transient; // released after setup (mask) or after each frame (clip)
+      heat_t     heat;   // access frequency class
+      bool       fallback; // landed in the non preferred memory type
+    };
+
+    // setup phase duration
+    struct phase_t
+    {
+      const char *name;
+      uint32_t   us;
+    };
+
+    // construction report
+    struct gauge_report_t
+    {
+      alloc_t  allocs[max_allocs];
+      size_t   allocs_count;
+      phase_t  phases[max_phases];
+      size_t   phases_count;
+      uint32_t total_bytes;     // sum of all successful allocations
+      uint32_t live_bytes;      // currently held by the gauge
+      uint32_t peak_bytes;      // high-water mark of live_bytes
+      uint32_t dram_low_water;  // lowest free DRAM observed during construction
+      uint32_t psram_low_water; // lowest free PSRAM observed during construction
+      uint32_t total_us;        // sum of phases duration
+      bool     dry_run;         // nothing was allocated, sizes are computed
+      bool     failed;          // at least one allocation failed
+      uint32_t phase_start;     // internal: start time of the running phase
+      uint32_t dram_min_start;  // internal: heap minimum free size when the phase started
+      uint32_t psram_min_start;
+    };
+
+
+    // buffer size of a LGFX sprite, bit packed rows are byte aligned, palette included
+    uint32_t spriteBytes( int32_t w, int32_t h, uint8_t bit_depth )
+    {
+      if( w <= 0 || h <= 0 ) return 0;
+      uint32_t rowBytes = ( uint32_t(w) * bit_depth + 7 ) / 8;
+      uint32_t palBytes = bit_depth <= 8 ? ( 1 << bit_depth ) * 3 : 0;
+      return rowBytes * h + palBytes;
+    }
+
+
+    uint32_t freeDram()  { return ESP.getFreeHeap(); }
+    uint32_t freePsram() { return psramInit() ? ESP.getFreePsram() : 0; }
+    // heap minimum free size, since boot or since the phase started (LGFXMETER_HEAP_LOCAL_MINIMUM)
+    uint32_t minFreeDram()  { return ESP.getMinFreeHeap(); }
+    uint32_t minFreePsram() { return psramInit() ? ESP.getMinFreePsram() : 0; }
+
+
+    // the current free size misses what was allocated and released in between (e.g. by a decoder),
+    // the heap minimum free size does not: when it moved during the phase, the new minimum is from this phase
+    void sampleHeap( gauge_report_t *report )
+    {
+      if( !report || report->dry_run ) return;
+      uint32_t dram_min  = minFreeDram();
+      uint32_t psram_min = minFreePsram();
+      report->dram_low_water  = min( report->dram_low_water,  freeDram() );
+      report->psram_low_water = min( report->psram_low_water, freePsram() );
+      if( dram_min < report->dram_min_start )   report->dram_low_water  = min( report->dram_low_water,  dram_min );
+      if( psram_min < report->psram_min_start ) report->psram_low_water = min( report->psram_low_water, psram_min );
+    }
+
+
+    void resetReport( gauge_report_t *report, bool dry_run = false )
+    {
+      if( !report ) return;
+      memset( report, 0, sizeof(gauge_report_t) );
+      report->dry_run         = dry_run;
+      report->dram_low_water  = dry_run ? 0 : freeDram();
+      report->psram_low_water = dry_run ? 0 : freePsram();
+    }
+
+
+    void beginPhase( gauge_report_t *report, const char *name )
+    {
+      if( !report || report->phases_count >= max_phases ) return;
+      report->phases[report->phases_count] = { name, 0 };
+      if( !report->dry_run ) {
+        #if defined LGFXMETER_HEAP_LOCAL_MINIMUM
+          heap_caps_monitor_local_minimum_free_size_stop(); // harmless when not started
+          heap_caps_monitor_local_minimum_free_size_start();
+        #endif
+        report->dram_min_start  = minFreeDram();
+        report->psram_min_start = minFreePsram();
+      }
+      report->phase_start = micros();
+    }
+
+
+    void endPhase( gauge_report_t *report )
+    {
+      if( !report || report->phases_count >= max_phases ) return;
+      uint32_t us = report->dry_run ? 0 : micros() - report->phase_start;
+      report->phases[report->phases_count++].us = us;
+      report->total_us += us;
+      sampleHeap( report );
+      report->dram_min_start  = 0; // outside a phase only the current free size is sampled
+      report->psram_min_start = 0;
+      #if defined LGFXMETER_HEAP_LOCAL_MINIMUM
+        if( !report->dry_run ) heap_caps_monitor_local_minimum_free_size_stop();
+      #endif
+    }
+
+
+    void addAlloc( gauge_report_t *report, const char *name, uint32_t bytes, bool psram, bool ok = true, bool transient = false, heat_t heat = HEAT_HOT, bool fallback = false )
+    {
+      if( !report ) return;
+      if( report->allocs_count < max_allocs ) {
+        report->allocs[report->allocs_count++] = { name, bytes, psram, ok, transient, heat, fallback };
+      }
+      if( ok ) {
+        report->total_bytes += bytes;
+        report->live_bytes  += bytes;
+        report->peak_bytes   = max( report->peak_bytes, report->live_bytes );
+      } else {
+        report->failed = true;
+      }
+      sampleHeap( report );
+    }
+
+
+    void addFree( gauge_report_t *report, uint32_t bytes )
+    {
+      if( !report ) return;
+      report->live_bytes = report->live_bytes > bytes ? report->live_bytes - bytes : 0;
+    }
+
+
+    // preferred memory type for a given heat class, unless explicitely placed
+    bool prefersPsram( heat_t heat, placement_t place = PLACE_DEFAULT )
+    {
+      if( place != PLACE_DEFAULT ) return place == PLACE_PSRAM && psramInit();
+      return psramInit() && policy.psram[heat];
+    }
+
+
+    // create a sprite according to the placement policy, the actual placement is recorded when a report is given
+    bool createSprite( ICS_Sprite *sprite, int32_t w, int32_t h, heat_t heat, const char *name = nullptr, gauge_report_t *report = nullptr, bool transient = false, placement_t place = PLACE_DEFAULT )
+    {
+      bool psram    = prefersPsram( heat, place );
+      bool fallback = false;
+      sprite->setPsram( psram );
+      bool ok = sprite->createSprite( w, h );
+      if( !ok && policy.fallback && ( psram || psramInit() ) ) {
+        psram    = !psram;
+        fallback = true;
+        sprite->setPsram( psram );
+        ok = sprite->createSprite( w, h );
+        if( ok && name ) log_w("%s sprite (%s) fell back to %s", name, heat_names[heat], psram ? "psram" : "dram" );
+      }
+      if( name ) {
+        addAlloc( report, name, spriteBytes( w, h, sprite->getColorDepth() ), psram, ok, transient, heat, fallback );
+      }
+      return ok;
+    }
+
+
+    void printReport( const gauge_report_t *report )
+    {
+      if( !report ) return;
+      log_i("Gauge %s: %d bytes total, %d bytes peak, %d bytes kept, %d us%s",
+        report->dry_run ? "plan" : "report",
+        report->total_bytes,
+        report->peak_bytes,
+        report->live_bytes,
+        report->total_us,
+        report->failed ? " [FAILED]" : ""
+      );
+      for( size_t i=0; i<report->phases_count; i++ ) {
+        log_i("  phase %-10s %8d us", report->phases[i].name, report->phases[i].us );
+      }
+      for( size_t i=0; i<report->allocs_count; i++ ) {
+        const alloc_t *alloc = &report->allocs[i];
+        log_i("  alloc %-10s %8d bytes %-4s %-5s%s%s%s", alloc->name, alloc->bytes, heat_names[alloc->heat], alloc->psram ? "psram" : "dram", alloc->fallback ? " (fallback)" : "", alloc->transient ? " (transient)" : "", alloc->ok ? "" : " [FAILED]" );
+      }
+      if( !report->dry_run ) {
+        log_i("  free heap low water: dram=%d, psram=%d", report->dram_low_water, report->psram_low_water );
+      }
+    }
+
+
+  }; // end namespace memory
+
+  using memory::gauge_report_t;
+
+}; // end namespace LGFXMeter
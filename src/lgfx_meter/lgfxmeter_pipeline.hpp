@@ -0,0 +1,468 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+#include "lgfxmeter_bus.hpp"
+#include "lgfxmeter_memory.hpp"
+
+#if defined ESP_PLATFORM
+  #include <freertos/FreeRTOS.h>
+  #include <freertos/queue.h>
+  #include <freertos/task.h>
+  #include <esp_heap_caps.h>
+#else
+  #include <thread>
+  #include <mutex>
+  #include <condition_variable>
+#endif
+
+
+namespace LGFXMeter
+{
+
+  namespace pipeline
+  {
+   /*
+    * Frame push pipeline.
+    *
+    * PUSH_SYNC: the clip buffer is pushed by the render call itself (default, historical behaviour).
+    * PUSH_TASK: two clip buffers, the render call composites frame N+1 while a task pinned to the
+    *            other core pushes frame N. acquire() blocks when both buffers are in use (backpressure),
+    *            so the frame rate approaches max(raster, push) instead of raster+push.
+    * PUSH_DMA:  two retained clip buffers in DMA capable internal ram, frame N is sent with pushImageDMA()
+    *            while the CPU composites frame N+1. A buffer is only reused after its transfer is fenced
+    *            (waitDMA). The write transaction only lasts for the transfer: it is closed by the fence,
+    *            taken as soon as the transfer is over, so other devices on the bus get it between frames.
+    *
+    * While frames are in flight the display belongs to the pipeline, anything else drawing on the
+    * display must call waitIdle() first.
+    *
+    * Clip buffers are allocated once for the largest frame (max_w*max_h pixels, e.g. the needle
+    * bounds over a few degrees of motion), each frame reshapes them to its own size. A larger frame
+    * is refused by acquire(), the caller renders it synchronously.
+    *
+    */
+
+    enum push_mode_t
+    {
+      PUSH_SYNC,
+      PUSH_TASK,
+      PUSH_DMA
+    };
+
+    // called when a frame has left its buffer, from the push task in PUSH_TASK mode
+    typedef void (*frameCallback_t)( clipRect_t rect, void *ctx );
+
+    const uint8_t max_slots  = 2;
+    const uint8_t stop_slot  = 0xff; // sentinel to terminate the push task
+    const int8_t  no_slot    = -1;
+
+    // one clip buffer
+    struct frame_slot_t
+    {
+      ICS_Sprite *sprite; // wraps buffer, resized per frame
+      uint8_t    *buffer;
+      clipRect_t rect;    // display coords
+    };
+
+
+    // blocking queue of slot indexes
+    #if defined ESP_PLATFORM
+
+      struct slot_queue_t
+      {
+        QueueHandle_t handle = nullptr;
+        bool init( size_t len ) { handle = xQueueCreate( len, sizeof(uint8_t) ); return handle != nullptr; }
+        void deinit()           { if( handle ) vQueueDelete( handle ); handle = nullptr; }
+        void put( uint8_t idx ) { xQueueSend( handle, &idx, portMAX_DELAY ); }
+        uint8_t get()           { uint8_t idx; xQueueReceive( handle, &idx, portMAX_DELAY ); return idx; }
+        size_t size()           { return uxQueueMessagesWaiting( handle ); }
+      };
+
+    #else // host build
+
+      struct slot_queue_t
+      {
+        std::mutex              lock;
+        std::condition_variable cond;
+        uint8_t items[max_slots+1];
+        size_t  head = 0, count = 0;
+        bool init( size_t len ) { head = count = 0; return len <= max_slots+1; }
+        void deinit() { }
+        void put( uint8_t idx )
+        {
+          std::unique_lock<std::mutex> lk( lock );
+          items[(head+count)%(max_slots+1)] = idx;
+          count++;
+          cond.notify_all();
+        }
+        uint8_t get()
+        {
+          std::unique_lock<std::mutex> lk( lock );
+          cond.wait( lk, [this]{ return count > 0; } );
+          uint8_t idx = items[head];
+          head = (head+1)%(max_slots+1);
+          count--;
+          cond.notify_all();
+          return idx;
+        }
+        size_t size() { std::unique_lock<std::mutex> lk( lock ); return count; }
+      };
+
+    #endif
+
+
+    class Push_Pipeline
+    {
+    public:
+
+      // max_w/max_h: largest frame, display size when 0
+      Push_Pipeline( LovyanGFX *_display, uint8_t _color_depth, push_mode_t _mode = PUSH_TASK, int _core = 0, int32_t max_w = 0, int32_t max_h = 0, placement_t _placement = PLACE_DEFAULT )
+      {
+        display     = _display;
+        color_depth = _color_depth;
+        mode        = _mode;
+        core        = _core;
+        placement   = _placement;
+        capacity    = slotBytes( max_w > 0 ? max_w : display->width(), max_h > 0 ? max_h : display->height(), color_depth );
+        begin();
+      };
+
+      // frame buffers held for a mode, 0 when the mode (or the color depth) has none, see gauge::plan()
+      static uint32_t buffersBytes( push_mode_t mode, int32_t max_w, int32_t max_h, uint8_t color_depth )
+      {
+        if( mode == PUSH_SYNC || ( color_depth != 8 && color_depth != 16 && color_depth != 24 ) ) return 0;
+        return max_slots * slotBytes( max_w, max_h, color_depth );
+      }
+
+      ~Push_Pipeline() { end(); }
+
+      // get a clip buffer of the given size, blocks until one is free, nullptr if larger than reserved
+      ICS_Sprite *acquire( int32_t w, int32_t h );
+      // hand the acquired buffer over for push at the given display coords
+      void submit( clipRect_t rect );
+      // block until every submitted frame has been pushed
+      void waitIdle();
+      // true while a frame is still being transferred
+      bool busy();
+      // completion callback
+      void onFrameDone( frameCallback_t cb, void *ctx = nullptr ) { frameCallback = cb; frameCallbackCtx = ctx; }
+
+      push_mode_t getMode() { return mode; }
+      bool ready() { return _ready; }
+
+    private:
+
+      LovyanGFX    *display = nullptr;
+      uint8_t      color_depth;
+      uint32_t     capacity = 0; // bytes per slot
+      push_mode_t  mode;
+      int          core;
+      placement_t  placement; // non DMA buffers
+      bool         _ready = false;
+
+      frame_slot_t slots[max_slots];
+      uint8_t      slots_count = 1;
+      uint8_t      current     = 0; // acquired slot
+      int8_t       inflight    = no_slot; // slot being sent by DMA
+      bool         writing     = false;   // DMA mode holds a write transaction until the transfer is fenced
+
+      frameCallback_t frameCallback    = nullptr;
+      void            *frameCallbackCtx = nullptr;
+
+      slot_queue_t freeSlots;
+      slot_queue_t readySlots;
+
+      #if defined ESP_PLATFORM
+        TaskHandle_t taskHandle = nullptr;
+      #else
+        std::thread  *taskThread = nullptr;
+      #endif
+
+      static uint32_t slotBytes( int32_t w, int32_t h, uint8_t color_depth ) { return uint32_t( w ) * h * ( color_depth/8 ); }
+      bool begin();
+      void end();
+      bool allocSlots();
+      void releaseSlots( uint8_t from );
+      void push( frame_slot_t *slot );
+      void pushDMA( frame_slot_t *slot );
+      void fence();
+      void done( frame_slot_t *slot ) { if( frameCallback ) frameCallback( slot->rect, frameCallbackCtx ); }
+      static void pushTask( void *param );
+
+    };
+
+
+    bool Push_Pipeline::begin()
+    {
+      for( uint8_t i=0; i<max_slots; i++ ) slots[i] = { nullptr, nullptr, { 0, 0, 0, 0 } };
+
+      if( color_depth != 8 && color_depth != 16 && color_depth != 24 ) {
+        log_e("Frame pipeline needs a 8/16/24 bits canvas (got %d)", color_depth );
+        mode        = PUSH_SYNC;
+        slots_count = 0;
+        return false; // not ready, the caller renders synchronously
+      }
+
+      slots_count = mode == PUSH_SYNC ? 1 : max_slots;
+
+      if( !allocSlots() ) {
+        log_e("Unable to allocate %d bytes %sframe buffers, falling back to sync push", capacity, mode == PUSH_DMA ? "DMA capable " : "" );
+        releaseSlots( 0 );
+        mode        = PUSH_SYNC;
+        slots_count = 1;
+        if( !allocSlots() ) {
+          releaseSlots( 0 );
+          slots_count = 0;
+          return false; // not ready, the caller renders synchronously
+        }
+      }
+
+      if( mode == PUSH_SYNC || mode == PUSH_DMA ) {
+        if( mode == PUSH_DMA ) display->initDMA();
+        _ready = true;
+        return true;
+      }
+
+      bool queues = freeSlots.init( slots_count+1 );
+      queues = readySlots.init( slots_count+1 ) && queues;
+      bool task = false;
+
+      if( queues ) {
+        for( uint8_t i=0; i<slots_count; i++ ) freeSlots.put( i );
+        #if defined ESP_PLATFORM
+          task = xTaskCreatePinnedToCore( pushTask, "lgfxmeter_push", 4096, this, 2, &taskHandle, core ) == pdPASS;
+        #else
+          taskThread = new std::thread( pushTask, this );
+          task = true;
+        #endif
+      }
+
+      if( !task ) {
+        log_e("Unable to create the push %s, falling back to sync push", queues ? "task" : "queues" );
+        freeSlots.deinit();
+        readySlots.deinit();
+        releaseSlots( 1 );
+        mode        = PUSH_SYNC;
+        slots_count = 1;
+      }
+
+      _ready = true;
+      return mode != PUSH_SYNC;
+    }
+
+
+    // DMA buffers must be in internal ram, the others follow the memory policy for hot buffers
+    bool Push_Pipeline::allocSlots()
+    {
+      for( uint8_t i=0; i<slots_count; i++ ) {
+        #if defined ESP_PLATFORM
+          if( mode == PUSH_DMA ) {
+            slots[i].buffer = (uint8_t*)heap_caps_malloc( capacity, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL );
+          } else {
+            bool psram = memory::prefersPsram( memory::HEAT_HOT, placement );
+            slots[i].buffer = (uint8_t*)heap_caps_malloc( capacity, psram ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT );
+            if( !slots[i].buffer && memory::policy.fallback && ( psram || psramInit() ) ) {
+              slots[i].buffer = (uint8_t*)heap_caps_malloc( capacity, psram ? MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT : MALLOC_CAP_SPIRAM );
+            }
+          }
+        #else
+          slots[i].buffer = (uint8_t*)malloc( capacity );
+        #endif
+        if( !slots[i].buffer ) return false;
+        slots[i].sprite = new ICS_Sprite( display );
+        slots[i].sprite->setColorDepth( color_depth );
+      }
+      return true;
+    }
+
+
+    void Push_Pipeline::releaseSlots( uint8_t from )
+    {
+      for( uint8_t i=from; i<max_slots; i++ ) {
+        if( slots[i].sprite ) {
+          slots[i].sprite->deleteSprite(); // the buffer isn't owned by the sprite
+          delete slots[i].sprite;
+          slots[i].sprite = nullptr;
+        }
+        if( slots[i].buffer ) {
+          #if defined ESP_PLATFORM
+            heap_caps_free( slots[i].buffer );
+          #else
+            free( slots[i].buffer );
+          #endif
+          slots[i].buffer = nullptr;
+        }
+      }
+    }
+
+
+    void Push_Pipeline::end()
+    {
+      if( mode == PUSH_DMA ) waitIdle();
+      if( mode == PUSH_TASK ) {
+        waitIdle();
+        readySlots.put( stop_slot );
+        #if defined ESP_PLATFORM
+          // the task deletes itself, wait for the acknowledgement
+          while( freeSlots.size() < slots_count+1 ) vTaskDelay( 1 );
+        #else
+          if( taskThread ) { taskThread->join(); delete taskThread; taskThread = nullptr; }
+        #endif
+        freeSlots.deinit();
+        readySlots.deinit();
+      }
+      releaseSlots( 0 );
+      slots_count = 0;
+      _ready = false;
+    }
+
+
+    ICS_Sprite *Push_Pipeline::acquire( int32_t w, int32_t h )
+    {
+      if( !_ready || w <= 0 || h <= 0 ) return nullptr;
+      if( uint32_t( w*h*( color_depth/8 ) ) > capacity ) return nullptr; // larger than reserved
+      switch( mode ) {
+        case PUSH_SYNC: current = 0; break;
+        case PUSH_TASK: current = freeSlots.get(); break; // backpressure
+        case PUSH_DMA:
+          if( inflight != no_slot && !display->dmaBusy() ) fence(); // transfer over: release the bus now
+          current = (current+1)%slots_count;
+          if( inflight == current ) fence(); // never write into a buffer being sent
+        break;
+      }
+      ICS_Sprite *sprite = slots[current].sprite;
+      // no allocation: the slot buffer is reshaped to w*h (8/16/24 bits rows are not padded)
+      sprite->setBuffer( slots[current].buffer, w, h, (lgfx::color_depth_t)color_depth );
+      return sprite;
+    }
+
+
+    void Push_Pipeline::submit( clipRect_t rect )
+    {
+      slots[current].rect = rect;
+      switch( mode ) {
+        case PUSH_SYNC: push( &slots[current] ); done( &slots[current] ); break;
+        case PUSH_TASK: readySlots.put( current ); break;
+        case PUSH_DMA:  pushDMA( &slots[current] ); break;
+      }
+    }
+
+
+    void Push_Pipeline::waitIdle()
+    {
+      if( mode == PUSH_DMA ) {
+        fence();
+        return;
+      }
+      if( mode != PUSH_TASK ) return;
+      while( freeSlots.size() < slots_count ) {
+        #if defined ESP_PLATFORM
+          vTaskDelay( 1 );
+        #else
+          std::this_thread::yield();
+        #endif
+      }
+    }
+
+
+    bool Push_Pipeline::busy()
+    {
+      switch( mode ) {
+        case PUSH_TASK: return freeSlots.size() < slots_count;
+        case PUSH_DMA:  return inflight != no_slot && display->dmaBusy();
+        default: return false;
+      }
+    }
+
+
+    // wait for the transfer in flight, then release its buffer
+    void Push_Pipeline::fence()
+    {
+      if( inflight == no_slot ) return;
+      display->waitDMA();
+      if( writing ) {
+        display->endWrite(); // the bus is free until the next frame
+        writing = false;
+      }
+      int8_t idx = inflight;
+      inflight   = no_slot;
+      done( &slots[idx] );
+    }
+
+
+    void Push_Pipeline::pushDMA( frame_slot_t *slot )
+    {
+      fence(); // one transfer at a time
+      display->startWrite(); // closed by fence(), endWrite() would wait for the transfer
+      writing = true;
+      ICS_Sprite *sprite = slot->sprite;
+      void *buffer = sprite->getBuffer();
+      switch( color_depth ) {
+        case 8:  display->pushImageDMA( slot->rect.x, slot->rect.y, sprite->width(), sprite->height(), (lgfx::rgb332_t*)buffer );  break;
+        case 16: display->pushImageDMA( slot->rect.x, slot->rect.y, sprite->width(), sprite->height(), (lgfx::swap565_t*)buffer ); break;
+        case 24: display->pushImageDMA( slot->rect.x, slot->rect.y, sprite->width(), sprite->height(), (lgfx::bgr888_t*)buffer );  break;
+      }
+      bus::record( slot->rect );
+      inflight = slot - slots;
+    }
+
+
+    void Push_Pipeline::push( frame_slot_t *slot )
+    {
+      slot->sprite->pushSprite( display, slot->rect.x, slot->rect.y );
+      bus::record( slot->rect );
+    }
+
+
+    void Push_Pipeline::pushTask( void *param )
+    {
+      Push_Pipeline *self = (Push_Pipeline*)param;
+      while( true ) {
+        uint8_t idx = self->readySlots.get();
+        if( idx == stop_slot ) break;
+        self->push( &self->slots[idx] );
+        self->done( &self->slots[idx] );
+        self->freeSlots.put( idx );
+      }
+      #if defined ESP_PLATFORM
+        self->freeSlots.put( stop_slot );
+        vTaskDelete( nullptr );
+      #endif
+    }
+
+
+  }; // end namespace pipeline
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,198 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "Gauge_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace planner
+  {
+   /*
+    * Memory budget planner.
+    *
+    * Given a gauge config and the available DRAM/PSRAM, try every combination
+    * of mask scale (cfg.zoomAA), canvas bit depth, needle bit depth, needle
+    * shadow, clip buffer and mask placement, and keep the best looking one that
+    * fits. Memory usage is computed with gauge::plan() so nothing gets
+    * allocated while planning. Without psram in the budget every buffer is
+    * placed in dram (cfg.placement), even on boards with psram.
+    *
+    * The needle sprites are not resized: their size is the needle image (or the
+    * configured needle shape), only their bit depth is planned.
+    *
+    *   auto budget = planner::available();
+    *   auto result = planner::fit( cfg, budget ); // pass the push mode given to setPushMode(), if any
+    *   if( result.feasible ) ICSGauge = new Gauge_Class( result.cfg );
+    *
+    */
+
+    struct memory_budget_t
+    {
+      uint32_t dram;  // bytes
+      uint32_t psram; // bytes, 0 = no psram
+    };
+
+    struct budget_plan_t
+    {
+      bool           feasible;
+      gauge_cfg_t    cfg;         // adjusted config
+      gauge_report_t report;      // per component memory
+      uint32_t       dram_bytes;  // peak dram usage
+      uint32_t       psram_bytes; // peak psram usage
+      uint32_t       score;       // quality score, higher is better
+    };
+
+    // candidates, best quality first
+    const float   zoom_levels[]    = { 0.25f, 0.5f, 0.75f, 1.0f };
+    const uint8_t canvas_depths[]  = { 0, 8 }; // 0 = keep the configured depth
+    const uint8_t needle_depths[]  = { 0, 8 }; // 0 = keep the image depth
+
+    const size_t zoom_levels_count   = sizeof(zoom_levels)/sizeof(float);
+    const size_t canvas_depths_count = sizeof(canvas_depths)/sizeof(uint8_t);
+    const size_t needle_depths_count = sizeof(needle_depths)/sizeof(uint8_t);
+
+    // keep some headroom for fragmentation and the rest of the application
+    const float default_headroom = 0.9f;
+
+
+    // largest allocatable blocks right now
+    memory_budget_t available( float headroom = default_headroom )
+    {
+      return
+      {
+        /*.dram  =*/ uint32_t( ESP.getMaxAllocHeap() * headroom ),
+        /*.psram =*/ psramInit() ? uint32_t( ESP.getMaxAllocPsram() * headroom ) : 0
+      };
+    }
+
+
+    // peak usage per memory type: persistent buffers + the largest transient one (mask and clip never coexist)
+    void getPeakUsage( const gauge_report_t *report, uint32_t *dram, uint32_t *psram )
+    {
+      uint32_t persistent[2] = {0,0}, transient[2] = {0,0};
+      for( size_t i=0; i<report->allocs_count; i++ ) {
+        const memory::alloc_t *alloc = &report->allocs[i];
+        int type = alloc->psram ? 1 : 0;
+        if( alloc->transient ) transient[type] = max( transient[type], alloc->bytes );
+        else                   persistent[type] += alloc->bytes;
+      }
+      *dram  = persistent[0] + transient[0];
+      *psram = persistent[1] + transient[1];
+    }
+
+
+    budget_plan_t fit( gauge_cfg_t _cfg, memory_budget_t budget, pipeline::push_mode_t push_mode = pipeline::PUSH_SYNC )
+    {
+      if( !budget.psram ) { // psram may exist, it's just not ours
+        _cfg.placement         = PLACE_DRAM;
+        _cfg.mask_placement    = PLACE_DRAM;
+        _cfg.needle.clip_psram = false;
+      }
+
+      budget_plan_t best;
+      memset( &best, 0, sizeof(budget_plan_t) );
+      best.cfg = _cfg;
+
+      bool has_image_needle = _cfg.needle.img != nullptr;
+      bool can_shadow       = _cfg.needle.drop_shadow && ( !has_image_needle || _cfg.needle.shadow );
+      bool has_mask         = _cfg.gauge.items && _cfg.gauge.items_count > 0;
+      // with psram in the budget the mask goes where it fits, dram first
+      const placement_t mask_places[] = { PLACE_DRAM, PLACE_PSRAM };
+      size_t mask_places_count = has_mask && budget.psram ? 2 : 1;
+
+      for( size_t z=0; z<zoom_levels_count; z++ ) {
+        if( !has_mask && z>0 ) break; // zoom level is irrelevant without rulers
+        for( size_t c=0; c<canvas_depths_count; c++ ) {
+          if( _cfg.dstCanvas && c>0 ) break; // provided canvas, not ours to change
+          for( size_t n=0; n<needle_depths_count; n++ ) {
+            if( !has_image_needle && n>0 ) break; // default needle is always 4bpp
+            for( int shadow=can_shadow?1:0; shadow>=0; shadow-- ) {
+              for( int clip_psram=0; clip_psram<=(budget.psram?1:0); clip_psram++ ) {
+                for( size_t m=0; m<mask_places_count; m++ ) {
+
+                  gauge_cfg_t candidate = _cfg;
+                  candidate.zoomAA             = has_mask ? zoom_levels[z] : _cfg.zoomAA;
+                  candidate.bit_depth          = canvas_depths[c] ? canvas_depths[c] : _cfg.bit_depth;
+                  candidate.needle.bit_depth   = needle_depths[n] ? needle_depths[n] : _cfg.needle.bit_depth;
+                  candidate.needle.drop_shadow = shadow;
+                  candidate.needle.clip_psram  = clip_psram;
+                  candidate.mask_placement     = mask_places_count > 1 ? mask_places[m] : _cfg.mask_placement;
+
+                  gauge_report_t report = gauge::plan( candidate, push_mode );
+                  uint32_t dram, psram;
+                  getPeakUsage( &report, &dram, &psram );
+                  if( dram > budget.dram || psram > budget.psram ) continue;
+
+                  // weights: canvas depth > antialias > shadow > needle depth > clip speed, mask speed
+                  uint32_t score = ( canvas_depths_count-c ) * 1000
+                                 + ( zoom_levels_count-z )   * 100
+                                 + shadow                    * 20
+                                 + ( needle_depths_count-n ) * 5
+                                 + ( clip_psram ? 0 : 1 )
+                                 + ( candidate.mask_placement == PLACE_PSRAM ? 0 : 1 );
+
+                  if( !best.feasible || score > best.score || ( score == best.score && dram+psram < best.dram_bytes+best.psram_bytes ) ) {
+                    best = { true, candidate, report, dram, psram, score };
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      if( best.feasible ) {
+        log_d("Planned gauge: zoomAA=%.2f, canvas=%dbpp, needle=%dbpp, shadow=%s, clip=%s, mask=%s, dram=%d, psram=%d",
+          best.cfg.zoomAA,
+          gauge::canvasBitDepth( best.cfg ),
+          best.cfg.needle.bit_depth,
+          best.cfg.needle.drop_shadow ? "on" : "off",
+          best.cfg.needle.clip_psram ? "psram" : "dram",
+          memory::prefersPsram( memory::HEAT_COLD, gauge::maskPlacement( best.cfg ) ) ? "psram" : "dram",
+          best.dram_bytes,
+          best.psram_bytes
+        );
+      } else {
+        log_e("No gauge configuration fits in dram=%d psram=%d", budget.dram, budget.psram );
+      }
+
+      return best;
+    }
+
+
+  }; // end namespace planner
+
+}; // end namespace LGFXMeter
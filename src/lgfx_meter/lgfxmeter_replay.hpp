@@ -0,0 +1,123 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "Gauge_Class.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace timing
+  {
+   /*
+    * Deterministic replay of a capture made with timing::Input_Recorder.
+    *
+    * Gauge calls are dispatched in their recorded order and the needle clock
+    * is replaced by the recorded clock values, so the same angles are computed
+    * and the same frames are rendered regardless of the actual timing.
+    *
+    *   timing::replay( VUMeterGauge, capture, sizeof(capture)/sizeof(capture[0]) );
+    *
+    */
+
+    // replay cursor, consumed by replayClock()
+    struct replay_state_t
+    {
+      const input_event_t *events;
+      size_t              count;
+      size_t              pos;
+      uint32_t            last;   // last clock value served
+      bool                desync; // clock was read when the capture didn't expect it
+    };
+
+    replay_state_t replayState = { nullptr, 0, 0, 0, false };
+
+    // keeps time moving when the capture is exhausted, so pending animations terminate
+    const uint32_t desync_step = 1000;
+
+
+    uint32_t replayClock()
+    {
+      replay_state_t *st = &replayState;
+      if( st->pos < st->count && st->events[st->pos].type == INPUT_CLOCK ) {
+        st->last = st->events[st->pos++].value;
+      } else {
+        st->desync = true;
+        st->last  += desync_step;
+      }
+      return st->last;
+    }
+
+
+    // optional callback after each replayed call, e.g. to checksum the display or count frames
+    typedef void (*replayCallback_t)( const input_event_t *event );
+
+
+    // returns false if the replay diverged from the capture
+    bool replay( Gauge_Class *gauge, const input_event_t *events, size_t count, replayCallback_t onEvent = nullptr )
+    {
+      if( !gauge || !events ) return false;
+
+      replayState = { events, count, 0, 0, false };
+      gauge->setClock( replayClock );
+
+      uint32_t skipped = 0;
+
+      while( replayState.pos < count ) {
+        const input_event_t *event = &events[replayState.pos++];
+        switch( event->type ) {
+          case INPUT_SET:     gauge->setNeedle( event->angle ); break;
+          case INPUT_EASE:    gauge->easeNeedle( event->value, easingFunc( event->flags ) ); break;
+          case INPUT_DRAW:    gauge->drawNeedle( event->angle, event->flags ); break;
+          case INPUT_ANIMATE: gauge->animateNeedle( event->angle, event->flags ); break;
+          case INPUT_SPRING:  gauge->setNeedleSpring( event->value ); break;
+          case INPUT_EASING:  gauge->setNeedleEasing(); break;
+          case INPUT_CLOCK:   skipped++; continue; // not consumed by the needle, capture and library are out of sync
+        }
+        if( onEvent ) onEvent( event );
+      }
+
+      gauge->setClock( systemClock );
+
+      bool in_sync = !replayState.desync && skipped == 0;
+      if( !in_sync ) {
+        log_w("Replay diverged from capture (%d unused clock events, %s)", skipped, replayState.desync ? "clock over-read" : "clock in sync" );
+      }
+      return in_sync;
+    }
+
+
+  }; // end namespace timing
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,139 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace spans
+  {
+   /*
+    * Bars with a peak-hold marker, shared by the bar meter and the spectrum columns.
+    *
+    * Positions are px along the bar from its origin. The peak is held for `hold`
+    * updates then falls by `decay` px per update until it meets the bar. A hold
+    * of 0 disables the marker. drawChanges() compares the bar and marker with what
+    * is on screen and hands over the positions whose color changed, grouped in spans,
+    * so the widget only maps a span to the display and sends it.
+    *
+    */
+
+    const int32_t peak_marker = 2; // px
+
+    enum pixel_t { PIXEL_BG, PIXEL_BAR, PIXEL_PEAK };
+
+    struct peak_bar_t
+    {
+      int16_t bar;       // px
+      float   peak;      // px
+      uint8_t age;       // updates since the peak was set
+      int16_t drawnBar;  // what is on screen
+      int16_t drawnPeak;
+    };
+
+
+    void reset( peak_bar_t *b )
+    {
+      *b = { 0, 0, 0, 0, 0 };
+    }
+
+
+    // peak hold, then linear fall back
+    void setBar( peak_bar_t *b, int16_t bar, uint8_t hold, float decay )
+    {
+      b->bar = bar;
+      if( bar >= b->peak || hold == 0 ) {
+        b->peak = bar;
+        b->age  = 0;
+      } else if( b->age < hold ) {
+        b->age++;
+      } else {
+        b->peak -= decay;
+        if( b->peak < bar ) b->peak = bar;
+      }
+    }
+
+
+    pixel_t pixelAt( int32_t pos, int32_t bar, int32_t peak, uint8_t hold )
+    {
+      if( pos < bar ) return PIXEL_BAR;
+      if( hold && peak > 0 && pos >= peak && pos < peak+peak_marker ) return PIXEL_PEAK;
+      return PIXEL_BG;
+    }
+
+
+    // part of the drawn marker that is not under the drawn bar, false if none
+    bool drawnPeakSpan( const peak_bar_t *b, int32_t length, uint8_t hold, int32_t *pos0, int32_t *pos1 )
+    {
+      if( !hold || b->drawnPeak <= 0 ) return false;
+      *pos0 = max( int32_t( b->drawnPeak ), int32_t( b->drawnBar ) );
+      *pos1 = min( int32_t( b->drawnPeak+peak_marker ), length );
+      return *pos1 > *pos0;
+    }
+
+
+    // drawSpan( pos0, pos1, kind ) is called for each run of changed positions, then the bar is marked as drawn
+    template<typename D> void drawChanges( peak_bar_t *b, int32_t length, uint8_t hold, D drawSpan )
+    {
+      int32_t newPeak = int32_t( b->peak );
+      if( b->bar == b->drawnBar && newPeak == b->drawnPeak ) return;
+
+      int32_t spanStart = -1;
+      pixel_t spanKind  = PIXEL_BG;
+      for( int32_t pos=0; pos<=length; pos++ ) {
+        bool changed = false;
+        pixel_t kind = PIXEL_BG;
+        if( pos < length ) {
+          kind    = pixelAt( pos, b->bar, newPeak, hold );
+          changed = kind != pixelAt( pos, b->drawnBar, b->drawnPeak, hold );
+        }
+        if( spanStart >= 0 && ( !changed || kind != spanKind ) ) {
+          drawSpan( spanStart, pos, spanKind );
+          spanStart = -1;
+        }
+        if( changed && spanStart < 0 ) {
+          spanStart = pos;
+          spanKind  = kind;
+        }
+      }
+      b->drawnBar  = b->bar;
+      b->drawnPeak = newPeak;
+    }
+
+
+  }; // end namespace spans
+
+}; // end namespace LGFXMeter
@@ -0,0 +1,187 @@
+/*\
+ *
+ * LGFX ICS Meter Gauge
+ *
+ * A demo inspired by https://github.com/armel/ICSMeter
+ *
+ * Copyright Apr. 2022 tobozo http://github.com/tobozo
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files ("M5Stack SD Updater"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+\*/
+
+
+#pragma once
+
+#include "lgfxmeter_types.hpp"
+
+
+namespace LGFXMeter
+{
+
+  namespace timing
+  {
+   /*
+    * Injectable clock and needle input recorder.
+    *
+    * The needle never calls millis() directly, it reads its clock function
+    * instead. While an Input_Recorder is attached, every gauge input call
+    * (set/ease/draw/animate, motion mode) and every clock value read by the needle are
+    * captured in order. Feeding that stream back to timing::replay()
+    * (see lgfxmeter_replay.hpp) reproduces the exact same angles and frames.
+    *
+    */
+
+    typedef uint32_t (*clockFunc_t)();
+
+    uint32_t systemClock() { return millis(); }
+
+
+    enum input_event_type_t : uint8_t
+    {
+      INPUT_CLOCK,   // clock value read by the needle
+      INPUT_SET,     // Gauge_Class::setNeedle()
+      INPUT_EASE,    // Gauge_Class::easeNeedle()
+      INPUT_DRAW,    // Gauge_Class::drawNeedle()
+      INPUT_ANIMATE, // Gauge_Class::animateNeedle()
+      INPUT_SPRING,  // Gauge_Class::setNeedleSpring()
+      INPUT_EASING   // Gauge_Class::setNeedleEasing()
+    };
+
+    // recorded event
+    struct input_event_t
+    {
+      input_event_type_t type;
+      uint8_t            flags; // render_value for draw/animate, easing function index for ease
+      uint32_t           value; // clock value for INPUT_CLOCK, duration for INPUT_EASE, settle time for INPUT_SPRING
+      float              angle;
+    };
+
+    const uint8_t unknown_easing = 0xff;
+    const uint8_t lut_easing     = 0x80; // flag for easing::lut_functions[] indexes
+
+
+    // find the index of an easing function in easing::functions[] or easing::lut_functions[]
+    uint8_t easingIndex( easing::easingFunc_t func )
+    {
+      const size_t count = sizeof(easing::functions)/sizeof(easing::easingFuncDesc_t);
+      for( size_t i=0; i<count; i++ ) {
+        if( easing::functions[i].func == func ) return i;
+        if( easing::lut_functions[i].func == func ) return i | lut_easing;
+      }
+      return unknown_easing;
+    }
+
+
+    easing::easingFunc_t easingFunc( uint8_t index )
+    {
+      const size_t count = sizeof(easing::functions)/sizeof(easing::easingFuncDesc_t);
+      if( index == unknown_easing ) return easing::easeInOutQuart;
+      if( index & lut_easing ) {
+        index &= ~lut_easing;
+        return index < count ? easing::lut_functions[index].func : easing::easeInOutQuart;
+      }
+      return index < count ? easing::functions[index].func : easing::easeInOutQuart;
+    }
+
+
+    class Input_Recorder
+    {
+    public:
+
+      Input_Recorder( size_t _capacity = 1024 )
+      {
+        capacity = _capacity;
+        events = (input_event_t*)calloc( capacity, sizeof(input_event_t) );
+        if( !events ) {
+          log_e("Unable to allocate %d input events", int(capacity) );
+          capacity = 0;
+        }
+      };
+
+      ~Input_Recorder() { if( events ) free( events ); }
+
+      // owns events
+      Input_Recorder( const Input_Recorder& ) = delete;
+      Input_Recorder& operator=( const Input_Recorder& ) = delete;
+
+      void begin() { count = 0; overflow = false; _recording = true; }
+      void end()   { _recording = false; }
+      bool recording() { return _recording; }
+      bool overflowed() { return overflow; }
+
+      void add( input_event_type_t type, float angle = 0.0f, uint32_t value = 0, uint8_t flags = 0 );
+
+      const input_event_t *getEvents() { return events; }
+      size_t getCount() { return count; }
+
+      // dump the capture as a C array, to be pasted into a replay sketch
+      void print( Print *out, const char *name = "capture" );
+
+    private:
+
+      input_event_t *events = nullptr;
+      size_t capacity  = 0;
+      size_t count     = 0;
+      bool overflow    = false;
+      bool _recording  = false;
+
+    };
+
+
+    // recorder receiving the gauge inputs, nullptr = disabled
+    Input_Recorder *recorder = nullptr;
+
+
+    void record( input_event_type_t type, float angle = 0.0f, uint32_t value = 0, uint8_t flags = 0 )
+    {
+      if( recorder && recorder->recording() ) recorder->add( type, angle, value, flags );
+    }
+
+
+    void Input_Recorder::add( input_event_type_t type, float angle, uint32_t value, uint8_t flags )
+    {
+      if( count >= capacity ) {
+        if( !overflow ) log_w("Input capture full (%d events), further events are dropped", int(capacity) );
+        overflow = true;
+        return;
+      }
+      events[count++] = { type, flags, value, angle };
+    }
+
+
+    void Input_Recorder::print( Print *out, const char *name )
+    {
+      out->printf("const timing::input_event_t %s[] = {\n", name );
+      for( size_t i=0; i<count; i++ ) {
+        // 9 significant digits are enough to restore the exact float
+        out->printf("  { timing::input_event_type_t(%d), %3d, %10u, %.9ef },\n", events[i].type, events[i].flags, unsigned(events[i].value), events[i].angle );
+      }
+      out->printf("};\n");
+    }
+
+
+  }; // end namespace timing
+
+  using timing::clockFunc_t;
+
+}; // end namespace LGFXMeter
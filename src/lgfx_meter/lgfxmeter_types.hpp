@@ -60,13 +60,23 @@ namespace LGFXMeter
     IMAGE_JPG,
     IMAGE_BMP,
     IMAGE_QOI,
-    IMAGE_RAW
+    IMAGE_RAW,
+    IMAGE_PACKED // tools/image_pack.py output: palettized 1/2/4/8bpp or 16bpp swapped rgb565, see utils::packedInfo()
+  };
+
+  // memory type of a buffer, PLACE_DEFAULT follows memory::policy
+  enum placement_t : uint8_t
+  {
+    PLACE_DEFAULT,
+    PLACE_DRAM,
+    PLACE_PSRAM
   };
 
   // image data/len holder
   struct image_t
   {
-    uint8_t       bit_depth; // Note: this is NOT the image bit depth but the minimal *canvas* recommended bit depth (e.g. 24bit image can be rendered as 16bit)
+    uint8_t       bit_depth; // Note: this is NOT the image bit depth but the minimal *canvas* recommended bit depth (e.g. 24bit image can be rendered as 16bit),
+                             // except for IMAGE_RAW where it is the pixel format of the rows: 8 rgb332, 16 big endian rgb565, 24 r,g,b
     const uint8_t *data;
     uint32_t      len;
     image_type_t  type;
@@ -154,6 +164,18 @@ namespace LGFXMeter
   };
 
   // gauge needle config
+  // peak-hold tick on the arc, drawn under the needle in the same frames
+  struct peak_marker_cfg_t
+  {
+    bool     enabled;
+    float    radius0;  // [0...1] inner end, fraction of axis.y
+    float    radius1;  // [0...1] outer end
+    float    width;    // px
+    uint32_t color;
+    uint32_t hold_ms;  // time before the marker starts falling back
+    float    decay;    // degrees per second
+  };
+
   struct needle_cfg_t
   {
     ICS_Display   *display;          // output media (tft or sprite)
@@ -175,6 +197,11 @@ namespace LGFXMeter
     float         shadowOffY;        // [0.0...1.0]  shadow offset Y, % relative to needle width
     float         radius;            // [0...1] // needle max radius
     float         scaleX;            // horizontal scale
+    uint8_t       bit_depth;         // needle/shadow sprite bit depth for image needles, 0 = use image bit_depth
+    bool          clip_psram;        // allocate the per-frame clip buffer in psram (slower, saves dram)
+    placement_t   placement;         // needle, shadow and clip buffers, set from gauge_cfg_t::placement
+    peak_marker_cfg_t peak;          // optional peak-hold marker
+    const uint8_t *frames;           // optional pre-rotated needle asset (tools/needle_frames.py), read in place
   };
 
   // gauge config
@@ -188,6 +215,89 @@ namespace LGFXMeter
     const image_t         *bgImage;   // background png image
     needle_cfg_t          needle;     // needle config
     const gauge_palette_t *palette;
+    uint8_t               bit_depth;  // gauge canvas bit depth, 0 = use bgImage bit_depth
+    placement_t           placement;      // every gauge buffer, PLACE_DEFAULT follows memory::policy
+    placement_t           mask_placement; // setup-only antialias mask, PLACE_DEFAULT follows placement, see planner::fit()
+  };
+
+  // spectrum bars config
+  struct spectrum_cfg_t
+  {
+    ICS_Display *display;     // output media
+    clipRect_t  clipRect;     // bars area in output media
+    ICS_Sprite  *bgSprite;    // optional shared background, e.g. the gauge canvas
+    coord_t     bgPos;        // bgSprite top left corner in output media
+    uint32_t    bg_color;     // background color when there is no bgSprite
+    uint32_t    bar_color;
+    uint32_t    peak_color;
+    uint16_t    bands;        // number of columns
+    uint8_t     gap;          // px between columns
+    uint32_t    sample_rate;  // Hz, to place FFT bins on the frequency axis
+    float       min_freq;     // lowest band edge, Hz
+    float       ref_level;    // magnitude drawn at full height
+    float       floor_db;     // magnitude drawn at zero height, dB relative to ref_level
+    uint8_t     peak_hold;    // frames before the peak marker starts falling, 0 = no marker
+    float       peak_decay;   // px per frame
+  };
+
+  // waveform (oscilloscope) config
+  struct waveform_cfg_t
+  {
+    ICS_Display *display;     // output media
+    clipRect_t  clipRect;     // trace area in output media, one column per px
+    ICS_Sprite  *bgSprite;    // optional shared background
+    coord_t     bgPos;        // bgSprite top left corner in output media
+    uint32_t    bg_color;     // background color when there is no bgSprite
+    uint32_t    wave_color;
+    uint8_t     channels;     // interleaved channels in the input blocks
+    uint8_t     channel;      // channel to display, or waveform::mix_channels
+  };
+
+  // numeric readout config
+  struct readout_cfg_t
+  {
+    ICS_Display       *display;   // output media
+    coord_t           pos;        // top left corner of the first cell in output media
+    uint8_t           cells;      // max characters, text is right aligned
+    const lgfx::IFont *font;
+    float             fontSize;
+    const char        *charset;   // glyphs rendered in the atlas, other characters are blank
+    ICS_Sprite        *bgSprite;  // optional background (e.g. the gauge canvas), glyphs are then blitted with transparency
+    coord_t           bgPos;      // bgSprite top left corner in output media
+    uint32_t          bg_color;   // background color when there is no bgSprite
+    uint32_t          text_color;
+    uint8_t           bit_depth;  // atlas (solid background) and cell sprite
+  };
+
+  enum bar_orientation_t
+  {
+    BAR_HORIZONTAL, // grows to the right, rulers below the bar
+    BAR_VERTICAL    // grows up, rulers left of the bar
+  };
+
+  // bar meter config, rulers are laid on a straight axis: ruler/unit angles are values relative
+  // to min, radius is the distance from the bar, width the ruler thickness
+  struct bar_cfg_t
+  {
+    ICS_Display         *display;     // output media
+    clipRect_t          clipRect;     // widget area (face) in output media
+    clipRect_t          barRect;      // bar track, relative to clipRect
+    bar_orientation_t   orientation;
+    const ruler_item_t  *items;       // optional rulers
+    size_t              items_count;
+    const gauge_palette_t *palette;   // ruler colors (by color_index), transparent_color
+    float               min;          // value at the start of the bar
+    float               max;          // value at the end of the bar
+    ICS_Sprite          *bgSprite;    // optional shared background
+    coord_t             bgPos;        // bgSprite top left corner in output media
+    uint32_t            bg_color;     // background color when there is no bgSprite
+    uint32_t            track_color;  // empty bar
+    uint32_t            bar_color;
+    uint32_t            peak_color;
+    uint8_t             peak_hold;    // updates before the peak marker starts falling, 0 = no marker
+    float               peak_decay;   // px per update
+    float               zoomAA;       // rulers antialias scale, see gauge_cfg_t
+    uint8_t             bit_depth;    // face sprite
   };
 
 
@@ -284,6 +394,240 @@ namespace LGFXMeter
 
 
 
+    // restore a display area from a background sprite whose top left corner is at bg_x/bg_y (display coords)
+    void restoreRect( LovyanGFX* dst, ICS_Sprite *bg, int32_t bg_x, int32_t bg_y, clipRect_t rect )
+    {
+      int32_t cx, cy, cw, ch;
+      dst->getClipRect( &cx, &cy, &cw, &ch );
+      clipRect_t clip = constrainClipRect( rect, { cx, cy, cw, ch } );
+      if( clip.w <= 0 || clip.h <= 0 ) return;
+      dst->setClipRect( clip.x, clip.y, clip.w, clip.h );
+      bg->pushSprite( dst, bg_x, bg_y ); // only the clipped area is sent
+      dst->setClipRect( cx, cy, cw, ch ); // restore the caller's clip
+    }
+
+
+
+    // clamp a crop (w/h <= 0: up to the image edge) to the image bounds, false if empty
+    bool cropImage( int32_t img_w, int32_t img_h, int32_t *w, int32_t *h, int32_t *offX, int32_t *offY )
+    {
+      if( *offX < 0 ) { *w += *offX; *offX = 0; } // only happens with explicit sizes
+      if( *offY < 0 ) { *h += *offY; *offY = 0; }
+      if( *w <= 0 || *offX + *w > img_w ) *w = img_w - *offX;
+      if( *h <= 0 || *offY + *h > img_h ) *h = img_h - *offY;
+      return *w > 0 && *h > 0;
+    }
+
+
+    // RAW: rows of image_t.bit_depth pixels (8: rgb332, 16: big endian rgb565, 24: r,g,b),
+    // the cropped rows are pushed straight from the data, rows outside the crop are not read
+    void drawRawRows( LovyanGFX* dst, const image_t *img, int32_t x, int32_t y, int32_t w, int32_t h, int32_t offX, int32_t offY )
+    {
+      int32_t bpp    = img->bit_depth/8;
+      int32_t stride = img->width*bpp;
+      if( bpp < 1 || bpp > 3 || img->height <= 0 || img->len < uint32_t( stride*img->height ) ) {
+        log_e("Invalid RAW image (%dbpp, %dx%d, %d bytes)", img->bit_depth, img->width, img->height, img->len );
+        return;
+      }
+      if( !cropImage( img->width, img->height, &w, &h, &offX, &offY ) ) return;
+      // full width rows are contiguous: a single push
+      int32_t rows = w == img->width ? h : 1;
+      for( int32_t row=0; row<h; row+=rows ) {
+        const uint8_t *src = img->data + ( offY+row )*stride + offX*bpp;
+        switch( bpp ) {
+          case 1: dst->pushImage( x, y+row, w, rows, (const lgfx::rgb332_t*)src );  break;
+          case 2: dst->pushImage( x, y+row, w, rows, (const lgfx::swap565_t*)src ); break;
+          case 3: dst->pushImage( x, y+row, w, rows, (const lgfx::bgr888_t*)src );  break;
+        }
+      }
+    }
+
+
+    // QOI without alpha: decoded in a single pass, only the cropped part of a row is converted
+    // and pushed, decoding stops after the last cropped row. False if the image has an alpha
+    // channel (transparent pixels can't be skipped in a row push).
+    bool drawQoiRows( LovyanGFX* dst, const image_t *img, int32_t x, int32_t y, int32_t w, int32_t h, int32_t offX, int32_t offY )
+    {
+      const uint8_t *p = img->data, *end = img->data + img->len;
+      if( img->len < 22 || memcmp( p, "qoif", 4 ) != 0 || p[12] != 3 ) return false;
+      int32_t img_w = ( p[4] << 24 ) | ( p[5] << 16 ) | ( p[6] << 8 ) | p[7];
+      int32_t img_h = ( p[8] << 24 ) | ( p[9] << 16 ) | ( p[10] << 8 ) | p[11];
+      if( !cropImage( img_w, img_h, &w, &h, &offX, &offY ) ) return true;
+
+      lgfx::bgr888_t *row = (lgfx::bgr888_t*)malloc( w*sizeof(lgfx::bgr888_t) );
+      if( !row ) return false;
+
+      uint8_t index[64][3];
+      memset( index, 0, sizeof(index) );
+      uint8_t r = 0, g = 0, b = 0;
+      int32_t run = 0;
+      int32_t lastRow = offY+h;
+      p += 14;
+
+      for( int32_t py=0; py<lastRow; py++ ) {
+        for( int32_t px=0; px<img_w; px++ ) {
+          if( run > 0 ) {
+            run--;
+          } else if( p < end ) {
+            uint8_t op = *p++;
+            int32_t payload = op == 0xfe ? 3 : op == 0xff ? 4 : ( op >> 6 ) == 2 ? 1 : 0;
+            if( end - p < payload ) {
+              log_e("Truncated QOI image");
+              p = end; // the remaining pixels keep the last color
+            } else if( op == 0xfe ) { // QOI_OP_RGB
+              r = p[0]; g = p[1]; b = p[2]; p += 3;
+            } else if( op == 0xff ) { // QOI_OP_RGBA, alpha ignored
+              r = p[0]; g = p[1]; b = p[2]; p += 4;
+            } else switch( op >> 6 ) {
+              case 0: r = index[op][0]; g = index[op][1]; b = index[op][2]; break; // QOI_OP_INDEX
+              case 1: r += ( ( op >> 4 ) & 3 ) - 2; g += ( ( op >> 2 ) & 3 ) - 2; b += ( op & 3 ) - 2; break; // QOI_OP_DIFF
+              case 2: { // QOI_OP_LUMA
+                int8_t dg = ( op & 0x3f ) - 32;
+                uint8_t op2 = *p++;
+                r += dg - 8 + ( op2 >> 4 );
+                g += dg;
+                b += dg - 8 + ( op2 & 0x0f );
+              } break;
+              case 3: run = op & 0x3f; break; // QOI_OP_RUN, this pixel + run
+            }
+            uint8_t *slot = index[ ( r*3 + g*5 + b*7 + 255*11 ) & 63 ];
+            slot[0] = r; slot[1] = g; slot[2] = b;
+          }
+          if( py >= offY && px >= offX && px < offX+w ) {
+            lgfx::bgr888_t *out = &row[px-offX];
+            out->r = r; out->g = g; out->b = b;
+          }
+        }
+        if( py >= offY ) dst->pushImage( x, y+py-offY, w, 1, row );
+      }
+      free( row );
+      return true;
+    }
+
+
+    // IMAGE_PACKED layout, little endian:
+    //   0 "LGPK", 4 u8 version, 5 u8 bpp (1/2/4/8: palettized, 16: big endian rgb565), 6 u16 palette entries,
+    //   8 u16 width, 10 u16 height, 12 u8 flags, 13 3 bytes reserved,
+    //   16 palette entries as r,g,b,0 then rows of (width*bpp+7)/8 bytes, leftmost pixel in the high bits
+    const uint8_t  PACKED_VERSION     = 1;
+    const uint8_t  PACKED_TRANSPARENT = 0x01; // palette index 0 is transparent
+    const uint32_t PACKED_HEADER_SIZE = 16;
+
+    struct packed_info_t
+    {
+      uint8_t bpp;
+      uint8_t flags;
+      uint16_t colors;
+      int32_t width;
+      int32_t height;
+      uint32_t stride;
+      const uint8_t *palette; // colors*4 bytes
+      const uint8_t *pixels;
+    };
+
+
+    bool packedInfo( const image_t *img, packed_info_t *info )
+    {
+      const uint8_t *p = img->data;
+      if( img->len < PACKED_HEADER_SIZE || memcmp( p, "LGPK", 4 ) != 0 || p[4] != PACKED_VERSION ) return false;
+      info->bpp     = p[5];
+      info->colors  = p[6] | ( p[7] << 8 );
+      info->width   = p[8] | ( p[9] << 8 );
+      info->height  = p[10] | ( p[11] << 8 );
+      info->flags   = p[12];
+      info->stride  = ( info->width*info->bpp + 7 ) / 8;
+      info->palette = p + PACKED_HEADER_SIZE;
+      info->pixels  = info->palette + info->colors*4;
+      bool palettized = info->bpp == 1 || info->bpp == 2 || info->bpp == 4 || info->bpp == 8;
+      if( ( !palettized && info->bpp != 16 ) || ( palettized && ( info->colors == 0 || info->colors > ( 1 << info->bpp ) ) ) ) return false;
+      return img->len >= uint32_t( info->pixels - p ) + info->stride*info->height;
+    }
+
+
+    lgfx::color_depth_t packedDepth( uint8_t bpp )
+    {
+      switch( bpp ) {
+        case 1:  return lgfx::palette_1bit;
+        case 2:  return lgfx::palette_2bit;
+        case 4:  return lgfx::palette_4bit;
+        default: return lgfx::palette_8bit;
+      }
+    }
+
+
+    // copy a packed image into a sprite of the same bit depth (palette included), no conversion: rows are
+    // copied as is, starting at row y. An 8bpp sprite gets a palette. False when the depths differ, use
+    // drawImage() instead. flags (optional) receives the image flags, e.g. PACKED_TRANSPARENT.
+    bool loadPacked( ICS_Sprite *sprite, const image_t *img, int32_t y = 0, uint8_t *flags = nullptr )
+    {
+      packed_info_t info;
+      if( img->type != IMAGE_PACKED || !packedInfo( img, &info ) ) return false;
+      if( !sprite->getBuffer() || ( sprite->getColorDepth() & lgfx::color_depth_t::bit_mask ) != info.bpp ) return false;
+      if( sprite->width() < info.width || sprite->height() <= y ) return false;
+      bool palettized = info.bpp < 16;
+      bool has_palette = sprite->getColorDepth() & lgfx::color_depth_t::has_palette;
+      if( palettized && !has_palette && ( info.bpp != 8 || !sprite->createPalette() ) ) return false; // 8bpp sprites are rgb332 by default
+      if( !palettized && has_palette ) return false;
+      uint8_t *buf = (uint8_t*)sprite->getBuffer();
+      uint32_t stride = sprite->bufferLength() / sprite->height(); // lgfx pads sprite rows
+      int32_t rows = min( info.height, sprite->height()-y );
+      for( int32_t row=0; row<rows; row++ ) {
+        memcpy( buf + ( y+row )*stride, info.pixels + row*info.stride, info.stride );
+      }
+      for( uint16_t i=0; i<info.colors && palettized; i++ ) {
+        const uint8_t *c = info.palette + i*4;
+        sprite->setPaletteColor( i, c[0], c[1], c[2] );
+      }
+      if( flags ) *flags = info.flags;
+      return true;
+    }
+
+
+    // packed image: 16bpp rows are pushed as RAW, palettized rows are pushed with their palette and
+    // cropped by a clip rect (a crop may not start on a byte), index 0 is skipped when transparent
+    void drawPackedRows( LovyanGFX* dst, const image_t *img, int32_t x, int32_t y, int32_t w, int32_t h, int32_t offX, int32_t offY )
+    {
+      packed_info_t info;
+      if( !packedInfo( img, &info ) ) {
+        log_e("Invalid packed image (%d bytes)", img->len );
+        return;
+      }
+      if( !cropImage( info.width, info.height, &w, &h, &offX, &offY ) ) return;
+
+      if( info.bpp == 16 ) {
+        int32_t rows = w == info.width ? h : 1;
+        for( int32_t row=0; row<h; row+=rows ) {
+          dst->pushImage( x, y+row, w, rows, (const lgfx::swap565_t*)( info.pixels + ( offY+row )*info.stride + offX*2 ) );
+        }
+        return;
+      }
+
+      lgfx::bgr888_t palette[256];
+      for( uint16_t i=0; i<info.colors; i++ ) {
+        palette[i].r = info.palette[i*4];
+        palette[i].g = info.palette[i*4+1];
+        palette[i].b = info.palette[i*4+2];
+      }
+      lgfx::color_depth_t depth = packedDepth( info.bpp );
+      bool transparent = info.flags & PACKED_TRANSPARENT;
+
+      int32_t cx, cy, cw, ch;
+      dst->getClipRect( &cx, &cy, &cw, &ch );
+      clipRect_t clip = constrainClipRect( { x, y, w, h }, { cx, cy, cw, ch } );
+      if( clip.w <= 0 || clip.h <= 0 ) return;
+      dst->setClipRect( clip.x, clip.y, clip.w, clip.h );
+      for( int32_t row=0; row<h; row++ ) {
+        const uint8_t *src = info.pixels + ( offY+row )*info.stride;
+        if( transparent ) dst->pushImage( x-offX, y+row, info.width, 1, src, 0, depth, palette );
+        else              dst->pushImage( x-offX, y+row, info.width, 1, src, depth, palette );
+      }
+      dst->setClipRect( cx, cy, cw, ch );
+    }
+
+
+    // draw the w*h area of an image starting at offX/offY, at x/y in dst (w/h <= 0: up to the image edge).
+    // PNG/JPG are decoded by LGFX and cropped at output (rows above the crop bottom are inflated anyway),
+    // RAW, PACKED and QOI (no alpha) only read/convert what is needed, prefer them for large backgrounds.
     void drawImage( LovyanGFX* dst, const image_t *img, int32_t x = 0, int32_t y = 0, int32_t maxWidth = 0, int32_t maxHeight = 0, int32_t offX = 0, int32_t offY = 0 )
     {
       float scale_x = 1.0f;
@@ -293,8 +637,13 @@ namespace LGFXMeter
         case IMAGE_PNG: dst->drawPng( img->data, img->len, x, y, maxWidth, maxHeight, offX, offY, scale_x, scale_y ); break;
         case IMAGE_JPG: dst->drawJpg( img->data, img->len, x, y, maxWidth, maxHeight, offX, offY, scale_x, scale_y ); break;
         case IMAGE_BMP: dst->drawBmp( img->data, img->len, x, y, maxWidth, maxHeight, offX, offY, scale_x, scale_y ); break;
-        case IMAGE_QOI: dst->drawQoi( img->data, img->len, x, y, maxWidth, maxHeight, offX, offY, scale_x, scale_y ); break;
-        case IMAGE_RAW: dst->pushImage( -offX, -offY, maxWidth, maxHeight, img->data, img->len );   break;
+        case IMAGE_QOI:
+          if( !drawQoiRows( dst, img, x, y, maxWidth, maxHeight, offX, offY ) ) {
+            dst->drawQoi( img->data, img->len, x, y, maxWidth, maxHeight, offX, offY, scale_x, scale_y );
+          }
+        break;
+        case IMAGE_RAW: drawRawRows( dst, img, x, y, maxWidth, maxHeight, offX, offY ); break;
+        case IMAGE_PACKED: drawPackedRows( dst, img, x, y, maxWidth, maxHeight, offX, offY ); break;
       }
     }
 
@@ -302,6 +651,75 @@ namespace LGFXMeter
 
   };
 
+  namespace smoother
+  {
+   /*
+    * Frequently used functions during procedural texturing and modeling.
+    * https://iquilezles.org/articles/smoothsteps/
+    *
+    * C1/C2/C(n-1)=Continuity
+    *
+    */
+
+    namespace Cubic_Polynomial_C1
+    {
+      float smoothstep( float x ) { return x*x*(3.0f-2.0f*x); }
+      float inv_smoothstep( float x ) { return 0.5f-sin(asin(1.0f-2.0f*x)/3.0f); }
+    }
+
+    namespace Quartic_Polynomial_C1
+    {
+      float smoothstep( float x ) { return x*x*(2.0f-x*x); }
+      float inv_smoothstep( float x ) { return sqrt(1.0f-sqrt(1.0f-x)); }
+    }
+
+    namespace Quintic_Polynomial_C2
+    {
+      float smoothstep( float x ) { return x*x*x*(x*(x*6.0f-15.0f)+10.0f); }
+    }
+
+    namespace Quadratic_Rational_C1
+    {
+      float smoothstep( float x ) { return x*x/(2.0f*x*x-2.0f*x+1.0f); }
+      float inv_smoothstep( float x ) { return x<=0.0f ? 0.0f : x/(x+sqrt(x*(1.0f-x))); } // (x-sqrt(x*(1-x)))/(2x-1) without the 0/0 at x=0.5
+    }
+
+    namespace Cubic_Rational_C2
+    {
+      float smoothstep( float x ) { return x*x*x/(3.0f*x*x-3.0f*x+1.0f); }
+      float inv_smoothstep( float x ) { float a = pow(    x,1.0f/3.0f); float b = pow(1.0f-x,1.0f/3.0f); return a/(a+b); }
+      float inv_smoothstep_alternate( float x ) { if( x<=0.0f || x>=1.0f ) return x; float w=2.0f*sqrt(x*(1.0f-x)); float t=(x*(3.0f-2.0f*x)-1.0f)/(w*(1.0f-x)); return x-w*sinh(asinh(t)/3.0f); }
+    }
+
+    namespace Rational_C1
+    {
+      float smoothstep( float x, float n ) { return pow(x,n)/(pow(x,n)+pow(1.0f-x,n)) ; }
+      float inv_smoothstep( float x, float n ) { return smoothstep( x, 1.0f/n ); }
+    }
+
+    namespace Piecewise_Quadratic_C1
+    {
+      float smoothstep( float x ) { return (x<0.5f) ? 2.0f*x*x: 2.0f*x*(2.0f-x)-1.0f; }
+      float inv_smoothstep( float x ) { return (x<0.5f) ? sqrt(0.5f*x): 1.0f-sqrt(0.5f-0.5f*x); }
+    }
+
+    namespace Piecewise_Polynomial_C // (n-1)
+    {
+      float smoothstep( float x, float n ) { return (x<0.5f) ? 0.5f*pow(2.0f* x, n): 1.0f-0.5f*pow(2.0f*(1.0f-x), n); }
+      float inv_smoothstep( float x, float n ) { return (x<0.5f) ? 0.5f*pow(2.0f*     x, 1.0f/n): 1.0f-0.5f*pow(2.0f*(1.0f-x),1.0f/n); }
+    }
+
+    namespace Trigonometric_C1
+    {
+      float smoothstep( float x ) { return 0.5f-0.5f*cos(PI*x); }
+      float inv_smoothstep( float x ) { return acos(1.0f-2.0f*x)/PI; }
+    }
+
+
+
+  };
+
+
   namespace easing
   {
    /*
@@ -391,85 +809,77 @@ namespace LGFXMeter
       { "easeInOutElastic", easeInOutElastic },
       { "easeOutBounce",    easeOutBounce    },
       { "easeInBounce",     easeInBounce     },
-      { "easeInOutBounce",  easeInOutBounce  }
+      { "easeInOutBounce",  easeInOutBounce  },
+      // smoothsteps, only the single parameter ones
+      { "Cubic_Polynomial_C1",        smoother::Cubic_Polynomial_C1::smoothstep },
+      { "Cubic_Polynomial_C1 inv",    smoother::Cubic_Polynomial_C1::inv_smoothstep },
+      { "Quartic_Polynomial_C1",      smoother::Quartic_Polynomial_C1::smoothstep },
+      { "Quartic_Polynomial_C1 inv",  smoother::Quartic_Polynomial_C1::inv_smoothstep },
+      { "Quintic_Polynomial_C2",      smoother::Quintic_Polynomial_C2::smoothstep },
+      { "Quadratic_Rational_C1",      smoother::Quadratic_Rational_C1::smoothstep },
+      { "Quadratic_Rational_C1 inv",  smoother::Quadratic_Rational_C1::inv_smoothstep },
+      { "Cubic_Rational_C2",          smoother::Cubic_Rational_C2::smoothstep },
+      { "Cubic_Rational_C2 inv",      smoother::Cubic_Rational_C2::inv_smoothstep },
+      { "Cubic_Rational_C2 inv alt",  smoother::Cubic_Rational_C2::inv_smoothstep_alternate },
+      { "Piecewise_Quadratic_C1",     smoother::Piecewise_Quadratic_C1::smoothstep },
+      { "Piecewise_Quadratic_C1 inv", smoother::Piecewise_Quadratic_C1::inv_smoothstep },
+      { "Trigonometric_C1",           smoother::Trigonometric_C1::smoothstep },
+      { "Trigonometric_C1 inv",       smoother::Trigonometric_C1::inv_smoothstep }
     };
 
 
-
-  };
-
-
-  namespace smoother
-  {
    /*
-    * Frequently used functions during procedural texturing and modeling.
-    * https://iquilezles.org/articles/smoothsteps/
+    * Lookup table versions of the easing functions, for cores where pow/sin/sqrt are slow.
+    * Each table has lut_size segments with linear interpolation, tables are generated ahead of
+    * time by tools/easing_lut.py (lgfxmeter_easing_lut.hpp) and cost (lut_size+1)*4 bytes of
+    * flash each, no heap. Usage:
     *
-    * C1/C2/C(n-1)=Continuity
+    *   gauge->easeNeedle( 300, easing::lut<easing::easeOutElastic> );
+    *   gauge->easeNeedle( 300, easing::lut<smoother::Quintic_Polynomial_C2::smoothstep> );
     *
     */
+    const size_t lut_size = 256;
 
-    namespace Cubic_Polynomial_C1
-    {
-      float smoothstep( float x ) { return x*x*(3.0f-2.0f*x); }
-      float inv_smoothstep( float x ) { return 0.5f-sin(asin(1.0f-2.0f*x)/3.0f); }
-    }
-
-    namespace Quartic_Polynomial_C1
-    {
-      float smoothstep( float x ) { return x*x*(2.0f-x*x); }
-      float inv_smoothstep( float x ) { return sqrt(1.0f-sqrt(1.0f-x)); }
-    }
-
-    namespace Quintic_Polynomial_C2
-    {
-      float smoothstep( float x ) { return x*x*x*(x*(x*6.0f-15.0f)+10.0f); }
-    }
-
-    namespace Quadratic_Rational_C1
-    {
-      float smoothstep( float x ) { return x*x/(2.0f*x*x-2.0f*x+1.0f); }
-      float inv_smoothstep( float x ) { return (x-sqrt(x*(1.0f-x)))/(2.0f*x-1.0f); }
-    }
+    // specialized for every easing::functions[] entry, an incomplete type means there is no table for F
+    template<easingFunc_t F> struct lut_table;
 
-    namespace Cubic_Rational_C2
+    template<easingFunc_t F> float lut( float t )
     {
-      float smoothstep( float x ) { return x*x*x/(3.0f*x*x-3.0f*x+1.0f); }
-      float inv_smoothstep( float x ) { float a = pow(    x,1.0f/3.0f); float b = pow(1.0f-x,1.0f/3.0f); return a/(a+b); }
-      float inv_smoothstep_alternate( float x ) { float w=2.0f*sqrt(x*(1.0f-x)); float t=(x*(3.0f-2.0f*x)-1.0f)/(w*(1.0f-x)); return x-w*sinh(asinh(t)/3.0f); }
+      const float *table = lut_table<F>::data();
+      if( t <= 0.0f ) return table[0];
+      if( t >= 1.0f ) return table[lut_size];
+      float pos  = t*lut_size;
+      size_t idx = pos;
+      float frac = pos - idx;
+      return table[idx] + ( table[idx+1]-table[idx] ) * frac;
     }
 
-    namespace Rational_C1
-    {
-      float smoothstep( float x, float n ) { return pow(x,n)/(pow(x,n)+pow(1.0f-x,n)) ; }
-      float inv_smoothstep( float x, float n ) { return smoothstep( x, 1.0f/n ); }
-    }
 
-    namespace Piecewise_Quadratic_C1
+    // max absolute error between two easing functions over [0...1]
+    float maxError( easingFunc_t reference, easingFunc_t approx, size_t samples = 4096, float *at = nullptr )
     {
-      float smoothstep( float x ) { return (x<0.5f) ? 2.0f*x*x: 2.0f*x*(2.0f-x)-1.0f; }
-      float inv_smoothstep( float x ) { return (x<0.5f) ? sqrt(0.5f*x): 1.0f-sqrt(0.5f-0.5f*x); }
+      float max_err = 0.0f;
+      for( size_t i=0; i<=samples; i++ ) {
+        float t   = float(i)/float(samples);
+        float err = fabsf( reference(t) - approx(t) );
+        if( err > max_err ) {
+          max_err = err;
+          if( at ) *at = t;
+        }
+      }
+      return max_err;
     }
 
-    namespace Piecewise_Polynomial_C // (n-1)
-    {
-      float smoothstep( float x, float n ) { return (x<0.5f) ? 0.5f*pow(2.0f* x, n): 1.0f-0.5f*pow(2.0f*(1.0f-x), n); }
-      float inv_smoothstep( float x, float n ) { return (x<0.5f) ? 0.5f*pow(2.0f*     x, 1.0f/n): 1.0f-0.5f*pow(2.0f*(1.0f-x),1.0f/n); }
-    }
 
-    namespace Trigonometric_C1
-    {
-      float smoothstep( float x ) { return 0.5f-0.5f*cos(PI*x); }
-      float inv_smoothstep( float x ) { return acos(1.0f-2.0f*x)/PI; }
-    }
 
+  };
 
 
-  };
 
 
 
 };
 
 
-
+// easing::lut_table<F> specializations and easing::lut_functions[]
+#include "lgfxmeter_easing_lut.hpp"
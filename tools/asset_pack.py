@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+ asset_pack.py: asset pack builder for LGFXMeter
+
+ Bundles images and other assets into the pack read by assets::Asset_Store
+ (layout documented in src/lgfx_meter/lgfxmeter_assets.hpp). Write the pack to a
+ flash data partition, or use it as a file on the host. Each asset is
+ 4 bytes aligned and used in place.
+
+ Inputs are [name=]path[:WxH[xBITS]]. The name defaults to the file name without
+ its extension (at most 31 chars).
+
+ The type and size are read from the file:
+   .png .jpg .jpeg .bmp .qoi   images
+   image_pack.py output        IMAGE_PACKED (magic LGPK)
+   .raw                        IMAGE_RAW, needs :WxHxBITS (8, 16 or 24)
+   anything else               raw data (e.g. needle_frames.py .bin), see getData()
+
+ Usage:
+
+   python3 tools/asset_pack.py bg=assets/bg.png assets/clock_arrow.png \\
+     needle=clock_arrow_packed.bin frames=clock_arrow_frames.bin -o assets.bin
+
+   # partitions.csv: assets, data, 0x40, , 1M
+   parttool.py write_partition --partition-name assets --input assets.bin
+
+ Only the standard library is used.
+
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+
+MAGIC       = b"LGAS"
+VERSION     = 1
+HEADER_SIZE = 16
+ENTRY_SIZE  = 48
+NAME_LEN    = 32
+BLOB        = 0xff
+
+# image_type_t
+IMAGE_PNG, IMAGE_JPG, IMAGE_BMP, IMAGE_QOI, IMAGE_RAW, IMAGE_PACKED = range(6)
+
+
+def jpg_size(data):
+    pos = 2
+    while pos + 9 < len(data):
+        if data[pos] != 0xff:
+            pos += 1
+            continue
+        marker = data[pos+1]
+        if marker in (0xd8, 0x01) or 0xd0 <= marker <= 0xd7:
+            pos += 2
+            continue
+        length = struct.unpack(">H", data[pos+2:pos+4])[0]
+        if 0xc0 <= marker <= 0xcf and marker not in (0xc4, 0xc8, 0xcc):
+            h, w = struct.unpack(">HH", data[pos+5:pos+9])
+            return w, h
+        pos += 2 + length
+    sys.exit("jpg: no frame header")
+
+
+def identify(path, data, geometry, depth):
+    """ returns (type, bit_depth, width, height) """
+    ext = os.path.splitext(path)[1].lower()
+    if data[:8] == b"\x89PNG\r\n\x1a\n":
+        w, h = struct.unpack(">II", data[16:24])
+        return IMAGE_PNG, depth, w, h
+    if data[:4] == b"qoif":
+        w, h = struct.unpack(">II", data[4:12])
+        return IMAGE_QOI, depth, w, h
+    if data[:4] == b"LGPK":
+        bpp, _, w, h = struct.unpack("<BHHH", data[5:12])
+        return IMAGE_PACKED, bpp, w, h
+    if data[:2] == b"\xff\xd8":
+        w, h = jpg_size(data)
+        return IMAGE_JPG, depth, w, h
+    if data[:2] == b"BM":
+        w, h = struct.unpack("<ii", data[18:26])
+        return IMAGE_BMP, depth, w, abs(h)
+    if ext == ".raw":
+        if not geometry or len(geometry) != 3:
+            sys.exit("%s: raw images need :WxHxBITS" % path)
+        w, h, bits = geometry
+        if bits not in (8, 16, 24) or len(data) < w * h * bits // 8:
+            sys.exit("%s: invalid raw geometry" % path)
+        return IMAGE_RAW, bits, w, h
+    return BLOB, 0, 0, 0
+
+
+def parse_input(text):
+    name, path = text.split("=", 1) if "=" in text else (None, text)
+    geometry = None
+    base, _, spec = path.rpartition(":")
+    if base and spec and spec[0].isdigit():
+        path, geometry = base, [int(v) for v in spec.lower().split("x")]
+    if not name:
+        name = os.path.splitext(os.path.basename(path))[0]
+    if len(name.encode()) >= NAME_LEN:
+        sys.exit("%s: name longer than %d chars" % (name, NAME_LEN - 1))
+    return name, path, geometry
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Asset pack builder for LGFXMeter")
+    parser.add_argument("inputs", nargs="+", help="[name=]path[:WxH[xBITS]]")
+    parser.add_argument("--bit-depth", type=int, default=16, help="image_t.bit_depth of decoded images (default 16)")
+    parser.add_argument("-o", "--output", required=True, help="pack file")
+    args = parser.parse_args()
+
+    assets = {}
+    for text in args.inputs:
+        name, path, geometry = parse_input(text)
+        if name in assets:
+            sys.exit("duplicate name: %s" % name)
+        with open(path, "rb") as f:
+            data = f.read()
+        assets[name] = (data,) + identify(path, data, geometry, args.bit_depth)
+
+    names = sorted(assets, key=lambda n: n.encode())  # strncmp order
+    offset = HEADER_SIZE + ENTRY_SIZE * len(names)
+    index, blobs = b"", b""
+    for name in names:
+        data, kind, depth, w, h = assets[name]
+        pad = (-(offset + len(blobs))) & 3
+        blobs += b"\0" * pad
+        index += struct.pack("<32sIIBBHHH", name.encode(), offset + len(blobs), len(data), kind, depth, 0, w, h)
+        blobs += data
+        print("  %-31s %6d bytes  %s" % (name, len(data), "%dx%d" % (w, h) if kind != BLOB else "data"))
+    size = offset + len(blobs)
+    pack = MAGIC + struct.pack("<BBHII", VERSION, 0, len(names), size, 0) + index + blobs
+
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print("%s: %d assets, %d bytes" % (args.output, len(names), size))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""
+ easing_lut.py: easing lookup table generator for LGFXMeter
+
+ Samples every function of easing::functions[] (src/lgfx_meter/lgfxmeter_types.hpp)
+ at lut_size+1 points and writes src/lgfx_meter/lgfxmeter_easing_lut.hpp: one const
+ table per function, the easing::lut_table<F> specializations used by easing::lut<F>
+ and easing::lut_functions[].
+
+ The tables are built ahead of time so they live in flash and cost neither heap nor
+ time on the render path. The functions below mirror the C++ ones, run this again
+ after adding or changing an easing function, then check the max error reported by
+ examples/HostChecks and examples/Benchmark.
+
+ Usage:
+
+   python3 tools/easing_lut.py -o src/lgfx_meter/lgfxmeter_easing_lut.hpp
+
+ Only the standard library is used.
+
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+
+PI = math.pi
+# for trigo
+c1 = 1.70158
+c2 = c1 * 1.525
+c3 = c1 + 1
+c4 = (2 * PI) / 3
+c5 = (2 * PI) / 4.5
+# for bounce
+n1 = 7.5625
+d1 = 2.75
+
+
+def out_bounce(t):
+    if t < 1 / d1:
+        return n1 * t * t
+    if t < 2 / d1:
+        t -= 1.5 / d1
+        return n1 * t * t + 0.75
+    if t < 2.5 / d1:
+        t -= 2.25 / d1
+        return n1 * t * t + 0.9375
+    t -= 2.625 / d1
+    return n1 * t * t + 0.984375
+
+
+def in_out_elastic(t):
+    if t == 0 or t == 1:
+        return t
+    if t < 0.5:
+        return -(2 ** (20 * t - 10) * math.sin((20 * t - 11.125) * c5)) / 2
+    return (2 ** (-20 * t + 10) * math.sin((20 * t - 11.125) * c5)) / 2 + 1
+
+
+def inv_cubic_rational_alt(x):
+    if x <= 0 or x >= 1:
+        return x
+    w = 2 * math.sqrt(x * (1 - x))
+    t = (x * (3 - 2 * x) - 1) / (w * (1 - x))
+    return x - w * math.sinh(math.asinh(t) / 3)
+
+
+# (C++ name, easing::functions[] name, function), same order as easing::functions[]
+FUNCTIONS = [
+    ("linear",           "linear",           lambda t: t),
+    ("easeInQuad",       "easeInQuad",       lambda t: t ** 2),
+    ("easeOutQuad",      "easeOutQuad",      lambda t: t * (2 - t)),
+    ("easeInOutQuad",    "easeInOutQuad",    lambda t: 2 * t ** 2 if t < .5 else -1 + (4 - 2 * t) * t),
+    ("easeInCubic",      "easeInCubic",      lambda t: t ** 3),
+    ("easeOutCubic",     "easeOutCubic",     lambda t: (t - 1) ** 3 + 1),
+    ("easeInOutCubic",   "easeInOutCubic",   lambda t: 4 * t ** 3 if t < .5 else (t - 1) * (2 * t - 2) ** 2 + 1),
+    ("easeInQuart",      "easeInQuart",      lambda t: t ** 4),
+    ("easeOutQuart",     "easeOutQuart",     lambda t: 1 - (t - 1) ** 4),
+    ("easeInOutQuart",   "easeInOutQuart",   lambda t: 8 * t ** 4 if t < .5 else 1 - 8 * (t - 1) ** 4),
+    ("easeInQuint",      "easeInQuint",      lambda t: t ** 5),
+    ("easeOutQuint",     "easeOutQuint",     lambda t: 1 + (t - 1) ** 5),
+    ("easeInOutQuint",   "easeInOutQuint",   lambda t: 16 * t ** 5 if t < .5 else 1 + 16 * (t - 1) ** 5),
+    ("easeInSine",       "easeInSine",       lambda t: 1 - math.cos((t * PI) / 2)),
+    ("easeOutSine",      "easeOutSine",      lambda t: math.sin((t * PI) / 2)),
+    ("easeInOutSine",    "easeInOutSine",    lambda t: -(math.cos(PI * t) - 1) / 2),
+    ("easeInExpo",       "easeInExpo",       lambda t: 0 if t == 0 else 2 ** (10 * t - 10)),
+    ("easeOutExpo",      "easeOutExpo",      lambda t: 1 if t == 1 else 1 - 2 ** (-10 * t)),
+    ("easeInOutExpo",    "easeInOutExpo",    lambda t: t if t in (0, 1) else 2 ** (20 * t - 10) / 2 if t < .5 else (2 - 2 ** (-20 * t + 10)) / 2),
+    ("easeInCirc",       "easeInCirc",       lambda t: 1 - math.sqrt(1 - t ** 2)),
+    ("easeOutCirc",      "easeOutCirc",      lambda t: math.sqrt(1 - (t - 1) ** 2)),
+    ("easeInOutCirc",    "easeInOutCirc",    lambda t: (1 - math.sqrt(1 - (2 * t) ** 2)) / 2 if t < .5 else (math.sqrt(1 - (-2 * t + 2) ** 2) + 1) / 2),
+    ("easeInBack",       "easeInBack",       lambda t: c3 * t ** 3 - c1 * t ** 2),
+    ("easeOutBack",      "easeOutBack",      lambda t: 1 + c3 * (t - 1) ** 3 + c1 * (t - 1) ** 2),
+    ("easeInOutBack",    "easeInOutBack",    lambda t: ((2 * t) ** 2 * ((c2 + 1) * 2 * t - c2)) / 2 if t < .5 else ((2 * t - 2) ** 2 * ((c2 + 1) * (t * 2 - 2) + c2) + 2) / 2),
+    ("easeInElastic",    "easeInElastic",    lambda t: t if t in (0, 1) else -2 ** (10 * t - 10) * math.sin((t * 10 - 10.75) * c4)),
+    ("easeOutElastic",   "easeOutElastic",   lambda t: t if t in (0, 1) else 2 ** (-10 * t) * math.sin((t * 10 - 0.75) * c4) + 1),
+    ("easeInOutElastic", "easeInOutElastic", in_out_elastic),
+    ("easeOutBounce",    "easeOutBounce",    out_bounce),
+    ("easeInBounce",     "easeInBounce",     lambda t: 1 - out_bounce(1 - t)),
+    ("easeInOutBounce",  "easeInOutBounce",  lambda t: (1 - out_bounce(1 - 2 * t)) / 2 if t < .5 else (1 + out_bounce(2 * t - 1)) / 2),
+    ("smoother::Cubic_Polynomial_C1::smoothstep",           "Cubic_Polynomial_C1",           lambda x: x * x * (3 - 2 * x)),
+    ("smoother::Cubic_Polynomial_C1::inv_smoothstep",       "Cubic_Polynomial_C1 inv",       lambda x: 0.5 - math.sin(math.asin(1 - 2 * x) / 3)),
+    ("smoother::Quartic_Polynomial_C1::smoothstep",         "Quartic_Polynomial_C1",         lambda x: x * x * (2 - x * x)),
+    ("smoother::Quartic_Polynomial_C1::inv_smoothstep",     "Quartic_Polynomial_C1 inv",     lambda x: math.sqrt(1 - math.sqrt(1 - x))),
+    ("smoother::Quintic_Polynomial_C2::smoothstep",         "Quintic_Polynomial_C2",         lambda x: x * x * x * (x * (x * 6 - 15) + 10)),
+    ("smoother::Quadratic_Rational_C1::smoothstep",         "Quadratic_Rational_C1",         lambda x: x * x / (2 * x * x - 2 * x + 1)),
+    ("smoother::Quadratic_Rational_C1::inv_smoothstep",     "Quadratic_Rational_C1 inv",     lambda x: 0 if x <= 0 else x / (x + math.sqrt(x * (1 - x)))),
+    ("smoother::Cubic_Rational_C2::smoothstep",             "Cubic_Rational_C2",             lambda x: x ** 3 / (3 * x * x - 3 * x + 1)),
+    ("smoother::Cubic_Rational_C2::inv_smoothstep",         "Cubic_Rational_C2 inv",         lambda x: x ** (1 / 3) / (x ** (1 / 3) + (1 - x) ** (1 / 3))),
+    ("smoother::Cubic_Rational_C2::inv_smoothstep_alternate", "Cubic_Rational_C2 inv alt",   inv_cubic_rational_alt),
+    ("smoother::Piecewise_Quadratic_C1::smoothstep",        "Piecewise_Quadratic_C1",        lambda x: 2 * x * x if x < .5 else 2 * x * (2 - x) - 1),
+    ("smoother::Piecewise_Quadratic_C1::inv_smoothstep",    "Piecewise_Quadratic_C1 inv",    lambda x: math.sqrt(0.5 * x) if x < .5 else 1 - math.sqrt(0.5 - 0.5 * x)),
+    ("smoother::Trigonometric_C1::smoothstep",              "Trigonometric_C1",              lambda x: 0.5 - 0.5 * math.cos(PI * x)),
+    ("smoother::Trigonometric_C1::inv_smoothstep",          "Trigonometric_C1 inv",          lambda x: math.acos(1 - 2 * x) / PI),
+]
+
+
+def f32(v):
+    """ shortest text that reads back as the same float """
+    v = struct.unpack("f", struct.pack("f", v))[0]
+    for digits in range(6, 10):
+        text = "%.*g" % (digits, v)
+        if struct.unpack("f", struct.pack("f", float(text)))[0] == v:
+            break
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Easing lookup table generator for LGFXMeter")
+    parser.add_argument("--size", type=int, default=256, help="segments per table, must match easing::lut_size (default 256)")
+    parser.add_argument("-o", "--output", required=True, help=".hpp file")
+    args = parser.parse_args()
+
+    out = []
+    out.append("// generated by easing_lut.py %s, do not edit" % " ".join(sys.argv[1:]))
+    out.append("// %d tables of %d floats, included at the end of lgfxmeter_types.hpp" % (len(FUNCTIONS), args.size + 1))
+    out.append("")
+    out.append("#pragma once")
+    out.append("")
+    out.append("namespace LGFXMeter")
+    out.append("{")
+    out.append("")
+    out.append("  namespace easing")
+    out.append("  {")
+    out.append("")
+    out.append("    static_assert( lut_size == %d, \"regenerate with tools/easing_lut.py --size\" );" % args.size)
+    out.append("")
+    out.append("    namespace lut_data")
+    out.append("    {")
+    for _, desc, func in FUNCTIONS:
+        table = desc.replace(" ", "_")
+        values = [f32(func(i / args.size)) for i in range(args.size + 1)]
+        for v in values:
+            if "nan" in v or "inf" in v:
+                sys.exit("%s: not finite over [0...1]" % table)
+        out.append("      const float %s[lut_size+1] =" % table)
+        out.append("      {")
+        for i in range(0, len(values), 8):
+            out.append("        " + ", ".join(values[i:i+8]) + ",")
+        out.append("      };")
+    out.append("    };")
+    out.append("")
+    for name, desc, _ in FUNCTIONS:
+        out.append("    template<> struct lut_table<%s> { static const float *data() { return lut_data::%s; } };" % (name, desc.replace(" ", "_")))
+    out.append("")
+    out.append("    const easingFuncDesc_t lut_functions[] =")
+    out.append("    {")
+    width = max(len(n) for _, n, _ in FUNCTIONS) + 3
+    for i, (name, desc, _) in enumerate(FUNCTIONS):
+        out.append("      { %-*s lut<%s> }%s" % (width, '"%s",' % desc, name, "," if i + 1 < len(FUNCTIONS) else ""))
+    out.append("    };")
+    out.append("")
+    out.append("  };")
+    out.append("")
+    out.append("};")
+    out.append("")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out))
+    print("%s: %d tables, %d bytes of flash" % (args.output, len(FUNCTIONS), len(FUNCTIONS) * (args.size + 1) * 4))
+
+
+if __name__ == "__main__":
+    main()
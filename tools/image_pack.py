@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+ image_pack.py: packed image converter for LGFXMeter
+
+ Quantizes a PNG to a 1/2/4/8bpp palette or converts it to 16bpp big endian rgb565,
+ and writes the IMAGE_PACKED asset described in src/lgfx_meter/lgfxmeter_types.hpp
+ (utils::packedInfo) as a C header or a raw binary file.
+
+ Packed images are pushed without decoding. When the target sprite has the same
+ bit depth (needles and shadows use image_t.bit_depth), the rows and palette are
+ copied as is.
+
+ Palettized images: pixels with alpha below --alpha are transparent and use
+ palette index 0. The needle replaces that entry with its transparent_color.
+ Other pixels are matted on --matte (if given) and quantized by median cut.
+
+ Usage:
+
+   python3 tools/image_pack.py assets/clock_arrow.png --bpp 4 -o clock_arrow_packed.h
+
+   then:
+
+   #include "clock_arrow_packed.h"
+   const image_t vuMeterArrow = { 4, clock_arrow_packed, clock_arrow_packed_len, IMAGE_PACKED, 16, 144 };
+
+ Only the standard library is used (PNG reader shared with needle_frames.py).
+
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from needle_frames import read_png
+
+
+MAGIC            = b"LGPK"
+VERSION          = 1
+FLAG_TRANSPARENT = 0x01
+HEADER_SIZE      = 16
+
+
+def median_cut(colors, count):
+    """ colors: {(r,g,b): occurrences}, returns at most count (r,g,b) """
+    boxes = [list(colors.items())]
+    while len(boxes) < count:
+        # split the box with the widest channel range, weighted by its population
+        best, best_score = None, 0
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            ranges = [max(c[0][k] for c in box) - min(c[0][k] for c in box) for k in range(3)]
+            score = max(ranges) * sum(c[1] for c in box)
+            if score > best_score:
+                best, best_score = i, score
+        if best is None:
+            break
+        box = boxes.pop(best)
+        ranges = [max(c[0][k] for c in box) - min(c[0][k] for c in box) for k in range(3)]
+        axis = ranges.index(max(ranges))
+        box.sort(key=lambda c: c[0][axis])
+        total, acc, cut = sum(c[1] for c in box), 0, 1
+        for j, c in enumerate(box[:-1]):
+            acc += c[1]
+            if acc * 2 >= total:
+                cut = j + 1
+                break
+        boxes += [box[:cut], box[cut:]]
+    palette = []
+    for box in boxes:
+        n = sum(c[1] for c in box)
+        palette.append(tuple((sum(c[0][k] * c[1] for c in box) + n // 2) // n for k in range(3)))
+    return palette
+
+
+def nearest(palette, rgb, first):
+    best, best_d = first, None
+    for i in range(first, len(palette)):
+        p = palette[i]
+        d = (p[0]-rgb[0])**2 * 3 + (p[1]-rgb[1])**2 * 4 + (p[2]-rgb[2])**2 * 2
+        if best_d is None or d < best_d:
+            best, best_d = i, d
+    return best
+
+
+def pack_rows(rows, bpp):
+    out = b""
+    for row in rows:
+        line, acc, bits = bytearray(), 0, 0
+        for index in row:
+            acc = (acc << bpp) | index
+            bits += bpp
+            if bits == 8:
+                line.append(acc)
+                acc, bits = 0, 0
+        if bits:
+            line.append(acc << (8 - bits))
+        out += bytes(line)
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packed image converter for LGFXMeter")
+    parser.add_argument("image", help="source PNG")
+    parser.add_argument("--bpp", type=int, default=4, choices=[1, 2, 4, 8, 16], help="1/2/4/8: palettized, 16: rgb565 (default 4)")
+    parser.add_argument("--alpha", type=int, default=128, help="alpha threshold, below is transparent (default 128)")
+    parser.add_argument("--matte", help="RRGGBB, semi transparent pixels are blended on this color (default: alpha ignored)")
+    parser.add_argument("--name", help="C array name (default: output file name)")
+    parser.add_argument("-o", "--output", required=True, help=".h (C array) or .bin")
+    args = parser.parse_args()
+
+    width, height, rgba = read_png(args.image)
+    if width > 0xffff or height > 0xffff:
+        sys.exit("image too large")
+    matte = None
+    if args.matte:
+        m = int(args.matte, 16)
+        matte = ((m >> 16) & 0xff, (m >> 8) & 0xff, m & 0xff)
+
+    pixels, transparent = [], False
+    for row in rgba:
+        line = []
+        for x in range(width):
+            r, g, b, a = row[x*4:x*4+4]
+            if a < args.alpha:
+                transparent = True
+                line.append(None)
+                continue
+            if matte:
+                r, g, b = [(c * a + mc * (255 - a) + 127) // 255 for c, mc in zip((r, g, b), matte)]
+            line.append((r, g, b))
+        pixels.append(line)
+
+    flags, palette = 0, []
+    if args.bpp == 16:
+        if transparent:
+            sys.stderr.write("warning: 16bpp has no transparency, transparent pixels are black\n")
+        data = b""
+        for line in pixels:
+            for rgb in line:
+                r, g, b = rgb or (0, 0, 0)
+                data += struct.pack(">H", ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3))
+    else:
+        count = 1 << args.bpp
+        first = 0
+        if transparent:
+            flags |= FLAG_TRANSPARENT
+            palette.append((0, 0, 0))
+            first = 1
+        colors = {}
+        for line in pixels:
+            for rgb in line:
+                if rgb is not None:
+                    colors[rgb] = colors.get(rgb, 0) + 1
+        if count - first < 1:
+            sys.exit("no room left in the palette")
+        palette += median_cut(colors, count - first) if colors else [(0, 0, 0)]
+        cache, indexes = {}, []
+        for line in pixels:
+            out = []
+            for rgb in line:
+                if rgb is None:
+                    out.append(0)
+                    continue
+                if rgb not in cache:
+                    cache[rgb] = nearest(palette, rgb, first)
+                out.append(cache[rgb])
+            indexes.append(out)
+        data = pack_rows(indexes, args.bpp)
+
+    header = MAGIC + struct.pack("<BBHHHB3x", VERSION, args.bpp, len(palette), width, height, flags)
+    assert len(header) == HEADER_SIZE
+    blob = header + b"".join(struct.pack("BBBx", *c) for c in palette) + data
+
+    if args.output.endswith(".bin"):
+        with open(args.output, "wb") as f:
+            f.write(blob)
+    else:
+        name = args.name or os.path.splitext(os.path.basename(args.output))[0].replace("-", "_")
+        with open(args.output, "w") as f:
+            f.write("// generated by image_pack.py %s\n" % " ".join(sys.argv[1:]))
+            f.write("// %dx%d %dbpp, %d colors, %d bytes\n" % (width, height, args.bpp, len(palette), len(blob)))
+            f.write("// const image_t %s_img = { %d, %s, %s_len, IMAGE_PACKED, %d, %d };\n\n#pragma once\n\n" % (name, args.bpp, name, name, width, height))
+            f.write("alignas(4) const uint8_t %s[] = {\n" % name)
+            for i in range(0, len(blob), 16):
+                f.write("  " + ", ".join("0x%02x" % c for c in blob[i:i+16]) + ",\n")
+            f.write("};\n\nconst uint32_t %s_len = %d;\n" % (name, len(blob)))
+    print("%s: %dx%d %dbpp, %d colors, %d bytes" % (args.output, width, height, args.bpp, len(palette), len(blob)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,310 @@
+#!/usr/bin/env python3
+"""
+ needle_frames.py: pre-rotated needle asset generator for LGFXMeter
+
+ Renders a needle image (and an optional drop shadow) at every angle of a range,
+ antialiased by supersampling, trims each frame to its row spans and writes the
+ asset described in src/lgfx_meter/lgfxmeter_frames.hpp, as a C header or a raw
+ binary file. Pixels are stored as RGB565, with an extra alpha byte on the
+ antialiased edges only, and every row costs one byte plus two per run.
+
+ Angles are lgfx rotations: degrees clockwise, 0 = needle pointing up. A gauge
+ needle is rotated by 360 + gauge.start + value, e.g. a -45..45 gauge uses the
+ 315..405 range.
+
+ Usage:
+
+   python3 tools/needle_frames.py assets/clock_arrow.png --shadow assets/clock_arrow_shadow.png \\
+     --length 150 --from 315 --to 405 --step 0.5 -o clock_arrow_frames.h
+
+   then:
+
+   #include "clock_arrow_frames.h"
+   cfg.needle.frames = clock_arrow_frames;
+
+ Only the standard library is used (8 bits PNG, any color type, not interlaced).
+
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+import zlib
+
+
+MAGIC          = b"LGNF"
+VERSION        = 2
+FLAG_SHADOW    = 0x01
+RUN_ALPHA      = 0x80 # run length flag, the run has an alpha plane
+RUN_MAX        = 0x7f
+SKIP_MAX       = 0xff
+ALPHA_MIN      = 4   # below this a pixel is dropped
+ALPHA_OPAQUE   = 250 # above this a pixel is snapped to opaque
+
+
+def read_png(path):
+    """ returns (width, height, rows of [r,g,b,a, ...]) """
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+    pos, idat, palette, trns = 8, b"", None, None
+    width = height = depth = ctype = interlace = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos+8])
+        chunk = data[pos+8:pos+8+length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i+3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    if depth != 8 or interlace:
+        sys.exit("%s: only 8 bits non interlaced PNG are supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    stride = width * channels
+    raw = zlib.decompress(idat)
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        ftype = raw[y*(stride+1)]
+        line = bytearray(raw[y*(stride+1)+1:(y+1)*(stride+1)])
+        for i in range(stride):
+            a = line[i-channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i-channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p-a), abs(p-b), abs(p-c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        prev = line
+        rgba = []
+        for x in range(width):
+            px = line[x*channels:(x+1)*channels]
+            if ctype == 0:
+                rgba += [px[0], px[0], px[0], 255]
+            elif ctype == 2:
+                rgba += [px[0], px[1], px[2], 255]
+            elif ctype == 3:
+                r, g, b = palette[px[0]]
+                rgba += [r, g, b, trns[px[0]] if trns and px[0] < len(trns) else 255]
+            elif ctype == 4:
+                rgba += [px[0], px[0], px[0], px[1]]
+            else:
+                rgba += list(px)
+        rows.append(rgba)
+    return width, height, rows
+
+
+class Layer:
+    """ source image placed around its pivot, sampled in output (rotated) coords """
+
+    def __init__(self, image, pivot, scale, offset=(0.0, 0.0), color=None):
+        self.w, self.h, self.rows = image
+        self.pivot  = pivot
+        self.scale  = scale
+        self.offset = offset # applied after rotation (screen space), like the runtime shadow offset
+        self.color  = color  # silhouette color, None = image colors
+
+    def corners(self, angle):
+        c, s = math.cos(math.radians(angle)), math.sin(math.radians(angle))
+        out = []
+        for x, y in ((0, 0), (self.w, 0), (0, self.h), (self.w, self.h)):
+            dx, dy = (x - self.pivot[0]) * self.scale[0], (y - self.pivot[1]) * self.scale[1]
+            out.append((c*dx - s*dy + self.offset[0], s*dx + c*dy + self.offset[1]))
+        return out
+
+    def sampler(self, angle):
+        c, s = math.cos(math.radians(angle)), math.sin(math.radians(angle))
+        px, py = self.pivot
+        sx, sy = self.scale
+        ox, oy = self.offset
+        w, h, rows, color = self.w, self.h, self.rows, self.color
+
+        def sample(u, v):
+            u, v = u - ox, v - oy
+            x = int(math.floor(( c*u + s*v) / sx + px))
+            y = int(math.floor((-s*u + c*v) / sy + py))
+            if x < 0 or y < 0 or x >= w or y >= h:
+                return None
+            p = rows[y][x*4:x*4+4]
+            if color is not None:
+                return (color[0], color[1], color[2], p[3])
+            return p
+        return sample
+
+
+def render_frame(layers, angle, ss):
+    """ returns (x0, y0, w, h, pixels[y][x] = (r,g,b,a)), coords relative to the pivot """
+    xs, ys = [], []
+    for layer in layers:
+        for x, y in layer.corners(angle):
+            xs.append(x)
+            ys.append(y)
+    x0, y0 = int(math.floor(min(xs))) - 1, int(math.floor(min(ys))) - 1
+    x1, y1 = int(math.ceil(max(xs))) + 1, int(math.ceil(max(ys))) + 1
+    samplers = [layer.sampler(angle) for layer in layers] # bottom to top
+    n = ss * ss
+    pixels = []
+    for v in range(y0, y1):
+        row = []
+        for u in range(x0, x1):
+            r = g = b = a = 0.0
+            for j in range(ss):
+                for i in range(ss):
+                    su, sv = u + (i + 0.5) / ss, v + (j + 0.5) / ss
+                    # "over" compositing of the layers, premultiplied
+                    pr = pg = pb = pa = 0.0
+                    for sample in samplers:
+                        p = sample(su, sv)
+                        if p is None or p[3] == 0:
+                            continue
+                        sa = p[3] / 255.0
+                        pr = p[0]*sa + pr*(1-sa)
+                        pg = p[1]*sa + pg*(1-sa)
+                        pb = p[2]*sa + pb*(1-sa)
+                        pa = sa + pa*(1-sa)
+                    r, g, b, a = r + pr, g + pg, b + pb, a + pa
+            if a > 0:
+                row.append((int(r/a + 0.5), int(g/a + 0.5), int(b/a + 0.5), int(a/n*255 + 0.5)))
+            else:
+                row.append((0, 0, 0, 0))
+        pixels.append(row)
+    return x0, y0, x1 - x0, y1 - y0, pixels
+
+
+def trim(x0, y0, w, h, pixels):
+    keep = [(x, y) for y in range(h) for x in range(w) if pixels[y][x][3] >= ALPHA_MIN]
+    if not keep:
+        return x0, y0, 0, 0, []
+    lx, hx = min(p[0] for p in keep), max(p[0] for p in keep)
+    ly, hy = min(p[1] for p in keep), max(p[1] for p in keep)
+    return x0 + lx, y0 + ly, hx - lx + 1, hy - ly + 1, [row[lx:hx+1] for row in pixels[ly:hy+1]]
+
+
+def encode_frame(x0, y0, w, h, pixels):
+    """ rgb565 plane, alpha plane for the antialiased runs, then u8 runs per row """
+    colors, alphas, spans = b"", b"", bytearray()
+    for y in range(h):
+        runs, x, last = [], 0, 0
+        while x < w:
+            a = pixels[y][x][3]
+            if a < ALPHA_MIN:
+                x += 1
+                continue
+            opaque, start = a >= ALPHA_OPAQUE, x
+            while x < w and x - start < RUN_MAX and pixels[y][x][3] >= ALPHA_MIN and (pixels[y][x][3] >= ALPHA_OPAQUE) == opaque:
+                x += 1
+            skip = start - last
+            while skip > SKIP_MAX:
+                runs.append((SKIP_MAX, 0)) # empty run, only moves x
+                skip -= SKIP_MAX
+            runs.append((skip, (x - start) | (0 if opaque else RUN_ALPHA)))
+            for r, g, b, a in pixels[y][start:x]:
+                colors += struct.pack("<H", ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+                if not opaque:
+                    alphas += bytes((a,))
+            last = x
+        if len(runs) > 0xff:
+            sys.exit("too many runs in a row")
+        spans.append(len(runs))
+        for skip, length in runs:
+            spans += bytes((skip, length))
+    colors += b"\0" * (-len(colors) % 4)
+    body = colors + alphas + bytes(spans)
+    body += b"\0" * (-len(body) % 4)
+    return struct.pack("<hhHHII", x0, y0, w, h, len(colors) // 2, len(alphas)) + body
+
+
+def pair(text, kind=float):
+    a, b = text.split(",")
+    return kind(a), kind(b)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pre-rotated needle asset generator for LGFXMeter")
+    parser.add_argument("image", help="needle PNG, pointing up")
+    parser.add_argument("--shadow", help="shadow PNG, same size as the needle")
+    parser.add_argument("--shadow-offset", type=pair, help="dx,dy shadow offset in px after rotation (default 0,10 when a shadow is used)")
+    parser.add_argument("--shadow-color", default="888888", help="RRGGBB, needle silhouette used when --shadow-offset is given without --shadow")
+    parser.add_argument("--pivot", type=pair, help="x,y rotation center in image px (default: bottom center)")
+    parser.add_argument("--length", type=float, help="rendered needle height in px (sets the vertical scale)")
+    parser.add_argument("--scale", type=float, default=1.0, help="scale (default 1.0)")
+    parser.add_argument("--scale-x", type=float, help="horizontal scale (default: same as vertical)")
+    parser.add_argument("--from", dest="start", type=float, default=0.0, help="first angle (default 0)")
+    parser.add_argument("--to", dest="end", type=float, default=360.0, help="last angle (default 360, full circle)")
+    parser.add_argument("--step", type=float, default=1.0, help="degrees between frames (default 1)")
+    parser.add_argument("--supersample", type=int, default=4, help="antialias subsamples per axis (default 4)")
+    parser.add_argument("--name", help="C array name (default: output file name)")
+    parser.add_argument("-o", "--output", required=True, help=".h (C array) or .bin")
+    args = parser.parse_args()
+
+    image = read_png(args.image)
+    w, h = image[0], image[1]
+    pivot = args.pivot or (w / 2.0, float(h))
+    sy = args.length / h if args.length else args.scale
+    sx = args.scale_x if args.scale_x else sy
+    layers = []
+    flags = 0
+    if args.shadow or args.shadow_offset:
+        offset = args.shadow_offset or (0.0, 10.0)
+        if args.shadow:
+            shadow = read_png(args.shadow)
+            if shadow[:2] != image[:2]:
+                sys.exit("shadow and needle sizes differ")
+            layers.append(Layer(shadow, pivot, (sx, sy), offset))
+        else:
+            rgb = int(args.shadow_color, 16)
+            layers.append(Layer(image, pivot, (sx, sy), offset, ((rgb >> 16) & 0xff, (rgb >> 8) & 0xff, rgb & 0xff)))
+        flags |= FLAG_SHADOW
+    layers.append(Layer(image, pivot, (sx, sy)))
+
+    span = args.end - args.start
+    if args.step <= 0 or span < 0:
+        sys.exit("invalid angle range")
+    count = int(round(360.0 / args.step)) if span >= 360.0 else int(math.floor(span / args.step + 1e-6)) + 1
+
+    frames = []
+    for k in range(count):
+        angle = args.start + k * args.step
+        frames.append(encode_frame(*trim(*render_frame(layers, angle, args.supersample))))
+        sys.stderr.write("\rframe %d/%d" % (k + 1, count))
+    sys.stderr.write("\n")
+
+    header = MAGIC + struct.pack("<BBHff", VERSION, flags, count, args.start, args.step)
+    offset = len(header) + 4 * count
+    offsets = []
+    for frame in frames:
+        offsets.append(offset)
+        offset += len(frame)
+    blob = header + struct.pack("<%dI" % count, *offsets) + b"".join(frames)
+
+    if args.output.endswith(".bin"):
+        with open(args.output, "wb") as f:
+            f.write(blob)
+    else:
+        name = args.name or os.path.splitext(os.path.basename(args.output))[0].replace("-", "_")
+        with open(args.output, "w") as f:
+            f.write("// generated by needle_frames.py %s\n" % " ".join(sys.argv[1:]))
+            f.write("// %d frames from %g step %g deg, %d bytes\n\n#pragma once\n\n" % (count, args.start, args.step, len(blob)))
+            f.write("alignas(4) const uint8_t %s[] = {\n" % name)
+            for i in range(0, len(blob), 16):
+                f.write("  " + ", ".join("0x%02x" % c for c in blob[i:i+16]) + ",\n")
+            f.write("};\n\nconst uint32_t %s_len = %d;\n" % (name, len(blob)))
+    print("%s: %d frames, %d bytes" % (args.output, count, len(blob)))
+
+
+if __name__ == "__main__":
+    main()